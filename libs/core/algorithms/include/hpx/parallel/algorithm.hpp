@@ -29,6 +29,7 @@
 #include <hpx/parallel/algorithms/is_sorted.hpp>
 #include <hpx/parallel/algorithms/lexicographical_compare.hpp>
 #include <hpx/parallel/algorithms/make_heap.hpp>
+#include <hpx/parallel/algorithms/md_algorithms.hpp>
 #include <hpx/parallel/algorithms/merge.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
@@ -0,0 +1,58 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Merge path partitioning: splits the merged sequence of two sorted
+    // sequences of the lengths len1 and len2 at an arbitrary position 'diag'
+    // (a diagonal of the merge matrix). Returns the number of elements of the
+    // first sequence that end up in front of that position, the remaining
+    // (diag - result) elements are taken from the second sequence. Elements
+    // of the first sequence are placed in front of equivalent elements of the
+    // second sequence, which keeps the merge stable.
+    //
+    // Splitting the merged sequence into pieces of equal size gives chunks of
+    // equal amounts of work, independently of the distribution of the values
+    // in the input sequences.
+    template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
+        typename Proj2>
+    constexpr std::size_t merge_path_partition(Iter1 first1, std::size_t len1,
+        Iter2 first2, std::size_t len2, std::size_t diag, Comp&& comp,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        std::size_t lo = diag > len2 ? diag - len2 : 0;
+        std::size_t hi = (std::min)(diag, len1);
+
+        while (lo < hi)
+        {
+            std::size_t const mid = lo + (hi - lo) / 2;
+            if (HPX_INVOKE(comp,
+                    HPX_INVOKE(proj2, *(first2 + (diag - 1 - mid))),
+                    HPX_INVOKE(proj1, *(first1 + mid))))
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+        return lo;
+    }
+
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,364 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/timing/steady_clock.hpp>
+#include <hpx/type_support/identity.hpp>
+#include <hpx/type_support/is_contiguous_iterator.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // sequences shorter than this are sorted using the comparison based
+    // algorithms
+    inline constexpr std::size_t radix_sort_limit = 1 << 16;
+
+    // number of bits sorted by each pass, the per-task histograms stay in
+    // the L1 cache
+    inline constexpr std::size_t radix_sort_bits = 8;
+    inline constexpr std::size_t radix_sort_buckets = 1 << radix_sort_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps arithmetic values onto unsigned integers of the same size that
+    // compare the same way as the values themselves.
+    template <typename T, typename Enable = void>
+    struct radix_key
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool value = true;
+        using type = std::make_unsigned_t<T>;
+
+        static constexpr type get(T t) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                // flip the sign bit to order negative values first
+                return static_cast<type>(static_cast<type>(t) ^
+                    (type(1) << (sizeof(T) * CHAR_BIT - 1)));
+            }
+            else
+            {
+                return t;
+            }
+        }
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool value = true;
+        using type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static type get(T t) noexcept
+        {
+            // -0.0 and 0.0 compare equal, they have to map onto the same key
+            // to keep stable sorts stable
+            if (t == T(0))
+            {
+                t = T(0);
+            }
+
+            type bits;
+            std::memcpy(&bits, &t, sizeof(T));
+
+            // negative values are ordered reversed and before all positive
+            // values
+            constexpr type sign = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (bits & sign) ? static_cast<type>(~bits) : (bits | sign);
+        }
+    };
+
+    template <typename Comp, typename T>
+    inline constexpr bool is_radix_less_v =
+        std::is_same_v<Comp, hpx::parallel::detail::less> ||
+        std::is_same_v<Comp, std::less<>> || std::is_same_v<Comp, std::less<T>>;
+
+    // Sorting a range can use the radix sort if its elements are arithmetic
+    // values stored contiguously and are ordered by operator<.
+    template <typename Iter, typename Comp, typename Proj>
+    inline constexpr bool is_radix_sortable_v =
+        hpx::traits::is_contiguous_iterator_v<Iter> &&
+        radix_key<typename std::iterator_traits<Iter>::value_type>::value &&
+        is_radix_less_v<std::decay_t<Comp>,
+            typename std::iterator_traits<Iter>::value_type> &&
+        std::is_same_v<std::decay_t<Proj>, hpx::identity>;
+
+    // Sorting by key additionally requires the values to be stored
+    // contiguously.
+    template <typename KeyIter, typename ValueIter, typename Comp>
+    inline constexpr bool is_radix_sortable_by_key_v =
+        is_radix_sortable_v<KeyIter, Comp, hpx::identity> &&
+        hpx::traits::is_contiguous_iterator_v<ValueIter> &&
+        std::is_default_constructible_v<
+            typename std::iterator_traits<ValueIter>::value_type> &&
+        std::is_move_assignable_v<
+            typename std::iterator_traits<ValueIter>::value_type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel least significant digit radix sort of the keys (and the
+    // values associated with them, if any). The sort is stable.
+    //
+    // The sequence is statically partitioned into one block per core. Every
+    // pass computes a histogram of the current digit for each block, the
+    // exclusive scan of all histograms (digit-major) gives each block its own
+    // range of positions per digit, the blocks are then scattered into the
+    // other buffer independently of each other. The histograms for all
+    // digits are computed during a single sweep before the first pass, which
+    // allows skipping the passes for digits that are the same for all keys.
+    template <typename Exec, typename K, typename V>
+    void radix_sort_helper(
+        Exec&& exec, K* keys, V* values, std::size_t count, std::size_t cores)
+    {
+        using key_type = typename radix_key<K>::type;
+
+        constexpr std::size_t buckets = radix_sort_buckets;
+        constexpr std::size_t num_digits =
+            sizeof(key_type) * CHAR_BIT / radix_sort_bits;
+        constexpr key_type mask = static_cast<key_type>(buckets - 1);
+
+        std::size_t const chunk_size = (count + cores - 1) / cores;
+        std::size_t const num_chunks = (count + chunk_size - 1) / chunk_size;
+
+        auto const shape = hpx::util::counting_shape(num_chunks);
+
+        // The buffers are left uninitialized for arithmetic types, their
+        // memory is first touched by the tasks scattering into them.
+        std::unique_ptr<K[]> key_buffer(new K[count]);
+        std::unique_ptr<std::conditional_t<std::is_void_v<V>, char, V>[]>
+            value_buffer;
+        if constexpr (!std::is_void_v<V>)
+        {
+            value_buffer.reset(new V[count]);
+        }
+
+        // histograms of all digits of the initial sequence
+        std::vector<std::size_t> histograms(
+            num_chunks * num_digits * buckets, 0);
+
+        execution::bulk_sync_execute(
+            exec,
+            [&](std::size_t chunk) {
+                std::size_t* hist = &histograms[chunk * num_digits * buckets];
+                std::size_t const end = (std::min)(
+                    count, (chunk + 1) * chunk_size);
+                for (std::size_t i = chunk * chunk_size; i != end; ++i)
+                {
+                    key_type const key = radix_key<K>::get(keys[i]);
+                    for (std::size_t d = 0; d != num_digits; ++d)
+                    {
+                        ++hist[d * buckets +
+                            ((key >> (d * radix_sort_bits)) & mask)];
+                    }
+                }
+            },
+            shape);
+
+        K* src = keys;
+        K* dst = key_buffer.get();
+        [[maybe_unused]] V* src_values = values;
+        [[maybe_unused]] V* dst_values = nullptr;
+        if constexpr (!std::is_void_v<V>)
+        {
+            dst_values = value_buffer.get();
+        }
+
+        std::vector<std::size_t> counts(num_chunks * buckets);
+        std::vector<std::size_t> offsets(num_chunks * buckets);
+        bool first_pass = true;
+
+        for (std::size_t d = 0; d != num_digits; ++d)
+        {
+            std::size_t const shift = d * radix_sort_bits;
+
+            // skip the digit if it is the same for all keys
+            bool trivial = false;
+            for (std::size_t b = 0; b != buckets && !trivial; ++b)
+            {
+                std::size_t total = 0;
+                for (std::size_t c = 0; c != num_chunks; ++c)
+                {
+                    total += histograms[(c * num_digits + d) * buckets + b];
+                }
+                trivial = total == count;
+            }
+            if (trivial)
+            {
+                continue;
+            }
+
+            // the initial histograms are valid for the first pass only, the
+            // keys have been moved between the blocks afterwards
+            std::size_t const* hist = &histograms[d * buckets];
+            std::size_t hist_stride = num_digits * buckets;
+            if (!first_pass)
+            {
+                execution::bulk_sync_execute(
+                    exec,
+                    [&](std::size_t chunk) {
+                        std::size_t* chunk_counts = &counts[chunk * buckets];
+                        std::fill(chunk_counts, chunk_counts + buckets, 0);
+
+                        std::size_t const end = (std::min)(
+                            count, (chunk + 1) * chunk_size);
+                        for (std::size_t i = chunk * chunk_size; i != end; ++i)
+                        {
+                            key_type const key = radix_key<K>::get(src[i]);
+                            ++chunk_counts[(key >> shift) & mask];
+                        }
+                    },
+                    shape);
+
+                hist = counts.data();
+                hist_stride = buckets;
+            }
+            first_pass = false;
+
+            // exclusive scan of the histograms, digit-major
+            std::size_t sum = 0;
+            for (std::size_t b = 0; b != buckets; ++b)
+            {
+                for (std::size_t c = 0; c != num_chunks; ++c)
+                {
+                    offsets[c * buckets + b] = sum;
+                    sum += hist[c * hist_stride + b];
+                }
+            }
+
+            execution::bulk_sync_execute(
+                exec,
+                [&](std::size_t chunk) {
+                    std::size_t* offset = &offsets[chunk * buckets];
+                    std::size_t const end = (std::min)(
+                        count, (chunk + 1) * chunk_size);
+                    for (std::size_t i = chunk * chunk_size; i != end; ++i)
+                    {
+                        key_type const key = radix_key<K>::get(src[i]);
+                        std::size_t const pos = offset[(key >> shift) & mask]++;
+                        dst[pos] = src[i];
+                        if constexpr (!std::is_void_v<V>)
+                        {
+                            dst_values[pos] = HPX_MOVE(src_values[i]);
+                        }
+                    }
+                },
+                shape);
+
+            std::swap(src, dst);
+            if constexpr (!std::is_void_v<V>)
+            {
+                std::swap(src_values, dst_values);
+            }
+        }
+
+        // move the result back if it ended up in the buffer
+        if (src != keys)
+        {
+            execution::bulk_sync_execute(
+                exec,
+                [&](std::size_t chunk) {
+                    std::size_t const begin = chunk * chunk_size;
+                    std::size_t const end = (std::min)(
+                        count, (chunk + 1) * chunk_size);
+                    std::copy(src + begin, src + end, keys + begin);
+                    if constexpr (!std::is_void_v<V>)
+                    {
+                        std::move(src_values + begin, src_values + end,
+                            values + begin);
+                    }
+                },
+                shape);
+        }
+    }
+
+    // Sort the keys [first, first + count) and the values following the
+    // given value iterator, if any.
+    template <typename ExPolicy, typename KeyIter, typename... ValueIter>
+    void parallel_radix_sort(ExPolicy&& policy, KeyIter first,
+        std::size_t count, ValueIter... value_first)
+    {
+        static_assert(sizeof...(ValueIter) <= 1);
+
+        std::size_t const cores =
+            execution::processing_units_count(policy.parameters(),
+                policy.executor(), hpx::chrono::null_duration, count);
+
+        auto* keys = std::addressof(*first);
+        if constexpr (sizeof...(ValueIter) == 0)
+        {
+            radix_sort_helper(policy.executor(), keys,
+                static_cast<void*>(nullptr), count, (std::max)(cores,
+                    static_cast<std::size_t>(1)));
+        }
+        else
+        {
+            radix_sort_helper(policy.executor(), keys,
+                std::addressof(*value_first)..., count,
+                (std::max)(cores, static_cast<std::size_t>(1)));
+        }
+    }
+
+    // Radix sort the given sequence and return the given result, the sort is
+    // run asynchronously if the execution policy requires a future.
+    template <typename ExPolicy, typename Result, typename KeyIter,
+        typename... ValueIter>
+    util::detail::algorithm_result_t<ExPolicy, Result>
+    parallel_radix_sort_result(ExPolicy&& policy, Result result,
+        KeyIter first, std::size_t count, ValueIter... value_first)
+    {
+        using algorithm_result =
+            util::detail::algorithm_result<ExPolicy, Result>;
+
+        if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            return algorithm_result::get(execution::async_execute(
+                policy.executor(),
+                [policy, result = HPX_MOVE(result), first, count,
+                    value_first...]() mutable -> Result {
+                    parallel_radix_sort(policy, first, count, value_first...);
+                    return HPX_MOVE(result);
+                }));
+        }
+        else
+        {
+            parallel_radix_sort(policy, first, count, value_first...);
+            return algorithm_result::get(HPX_MOVE(result));
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -12,7 +12,10 @@
 #include <hpx/config.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/adapt_placement_mode.hpp>
@@ -31,6 +34,76 @@
 namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Returns whether the elements starting at it match the needle
+    // [s_first, s_first + diff).
+    template <typename FwdIter, typename FwdIter2, typename Pred,
+        typename Proj1, typename Proj2>
+    constexpr bool search_matches(FwdIter it, FwdIter2 s_first,
+        std::size_t diff, Pred& op, Proj1& proj1, Proj2& proj2)
+    {
+        for (/**/; diff != 0; (void) --diff, ++it, ++s_first)
+        {
+            if (!HPX_INVOKE(
+                    op, HPX_INVOKE(proj1, *it), HPX_INVOKE(proj2, *s_first)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Looks for the needle [s_first, s_first + diff) at all positions of the
+    // partition [it, it + part_size), which has to be followed by at least
+    // diff - 1 elements. The token is cancelled at the first match.
+    template <typename ExPolicy>
+    struct sequential_search_partition_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_search_partition_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Token, typename FwdIter2,
+            typename Pred, typename Proj1, typename Proj2>
+        friend constexpr void tag_fallback_invoke(sequential_search_partition_t,
+            std::size_t base_idx, FwdIter it, std::size_t part_size,
+            Token& tok, FwdIter2 s_first, std::size_t diff, Pred&& op,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            using reference = typename std::iterator_traits<FwdIter>::reference;
+
+            FwdIter curr = it;
+            util::loop_idx_n<ExPolicy>(base_idx, it, part_size, tok,
+                [&](reference v, std::size_t i) -> void {
+                    ++curr;
+                    if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
+                            HPX_INVOKE(proj2, *s_first)) &&
+                        search_matches(curr, std::next(s_first), diff - 1, op,
+                            proj1, proj2))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_search_partition_t<ExPolicy>
+        sequential_search_partition = sequential_search_partition_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Token,
+        typename FwdIter2, typename Pred, typename Proj1, typename Proj2>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void sequential_search_partition(
+        std::size_t base_idx, FwdIter it, std::size_t part_size, Token& tok,
+        FwdIter2 s_first, std::size_t diff, Pred&& op, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        return sequential_search_partition_t<ExPolicy>{}(base_idx, it,
+            part_size, tok, s_first, diff, HPX_FORWARD(Pred, op),
+            HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     // search
     template <typename FwdIter, typename Sent>
@@ -47,18 +120,46 @@ namespace hpx::parallel::detail {
             FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
         {
-            for (;; ++first)
+            if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+            {
+                // look for the first element of the needle in all positions
+                // at once
+                auto const diff = detail::distance(s_first, s_last);
+                auto const count = detail::distance(first, last);
+                if (diff <= 0)
+                    return first;
+                if (diff > count)
+                    return detail::advance_to_sentinel(first, last);
+
+                auto const positions =
+                    static_cast<std::size_t>(count - (diff - 1));
+                util::cancellation_token<std::size_t> tok(positions);
+                sequential_search_partition<ExPolicy>(0, first, positions,
+                    tok, s_first, static_cast<std::size_t>(diff), op, proj1,
+                    proj2);
+
+                std::size_t const found = tok.get_data();
+                if (found == positions)
+                    return detail::advance_to_sentinel(first, last);
+
+                std::advance(first, found);
+                return first;
+            }
+            else
             {
-                FwdIter it1 = first;
-                for (FwdIter2 it2 = s_first;; (void) ++it1, ++it2)
+                for (;; ++first)
                 {
-                    if (it2 == s_last)
-                        return first;
-                    if (it1 == last)
-                        return it1;
-                    if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *it1),
-                            HPX_INVOKE(proj2, *it2)))
-                        break;
+                    FwdIter it1 = first;
+                    for (FwdIter2 it2 = s_first;; (void) ++it1, ++it2)
+                    {
+                        if (it2 == s_last)
+                            return first;
+                        if (it1 == last)
+                            return it1;
+                        if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *it1),
+                                HPX_INVOKE(proj2, *it2)))
+                            break;
+                    }
                 }
             }
         }
@@ -69,7 +170,6 @@ namespace hpx::parallel::detail {
             Sent last, FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
         {
-            using reference = typename std::iterator_traits<FwdIter>::reference;
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
             using s_difference_type =
@@ -124,41 +224,14 @@ namespace hpx::parallel::detail {
                 hpx::parallel::util::partitioner<decltype(policy), FwdIter,
                     void>;
 
-            auto f1 = [diff, count, tok, s_first, op = HPX_FORWARD(Pred, op),
+            auto f1 = [diff, tok, s_first, op = HPX_FORWARD(Pred, op),
                           proj1 = HPX_FORWARD(Proj1, proj1),
                           proj2 = HPX_FORWARD(Proj2, proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                hpx::parallel::util::loop_idx_n<policy_type>(base_idx, it,
-                    part_size, tok,
-                    [diff, count, s_first, &tok, &curr,
-                        op = HPX_FORWARD(Pred, op),
-                        proj1 = HPX_FORWARD(Proj1, proj1),
-                        proj2 = HPX_FORWARD(Proj2, proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
-                                HPX_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0;
-                                 local_count != diff && len != count;
-                                 ++local_count, ++len, ++mid)
-                            {
-                                if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
-                                        HPX_INVOKE(proj2, *++needle)))
-                                    break;
-                            }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
+                sequential_search_partition<policy_type>(base_idx, it,
+                    part_size, tok, s_first, static_cast<std::size_t>(diff), op,
+                    proj1, proj2);
             };
 
             auto f2 = [=](auto&&... data) mutable -> FwdIter {
@@ -11,274 +11,213 @@
 #include <hpx/functional/invoke.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
-#include <hpx/type_support/unused.hpp>
-
-#if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-#include <boost/shared_array.hpp>
-#else
-#include <memory>
-#endif
+#include <hpx/parallel/util/result_types.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename FwdIter>
-    struct set_operations_buffer
+    // Output iterator counting the elements written to it, used for
+    // determining the size of the output of a set operation without storing
+    // it.
+    struct set_operation_counter
     {
-        template <typename T>
-        class rewritable_ref
-        {
-        public:
-            rewritable_ref() = default;
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
 
-            explicit constexpr rewritable_ref(T const& item) noexcept
-              : item_(&item)
-            {
-            }
+        constexpr set_operation_counter& operator*() noexcept
+        {
+            return *this;
+        }
 
-            rewritable_ref& operator=(T const& item)
-            {
-                item_ = &item;
-                return *this;
-            }
+        template <typename T>
+        constexpr set_operation_counter& operator=(T const&) noexcept
+        {
+            return *this;
+        }
 
-            // different versions of clang-format produce different results
-            // clang-format off
-            operator T const&() const
-            {
-                HPX_ASSERT(item_ != nullptr);
-                return *item_;
-            }
-            // clang-format on
+        constexpr set_operation_counter& operator++() noexcept
+        {
+            ++count;
+            return *this;
+        }
 
-        private:
-            T const* item_ = nullptr;
-        };
+        constexpr set_operation_counter operator++(int) noexcept
+        {
+            set_operation_counter tmp = *this;
+            ++count;
+            return tmp;
+        }
 
-        using value_type = typename std::iterator_traits<FwdIter>::value_type;
-        using type = std::conditional_t<std::is_scalar_v<value_type>,
-            value_type, rewritable_ref<value_type>>;
+        std::size_t count = 0;
     };
 
     struct set_chunk_data
     {
-        static constexpr std::size_t uninit_start =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_len = static_cast<std::size_t>(0);
-        static constexpr std::size_t uninit_start_index =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first1 =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first2 =
-            static_cast<std::size_t>(-1);
-
-        std::size_t start = uninit_start;
-        std::size_t len = uninit_len;
-        std::size_t start_index = uninit_start_index;
-        std::size_t first1 = uninit_first1;
-        std::size_t first2 = uninit_first2;
+        std::size_t start1 = 0;
+        std::size_t end1 = 0;
+        std::size_t start2 = 0;
+        std::size_t end2 = 0;
+        std::size_t len = 0;
+        std::size_t start_index = 0;
+        std::size_t first1 = 0;
+        std::size_t first2 = 0;
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // Splits both input sequences such that the merged sequence is split at
+    // (or close to) the given position. The split position is moved to the
+    // beginning of the group of equivalent elements it falls into, this
+    // ensures that all equivalent elements of both sequences are handled by
+    // the same chunk.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    std::pair<std::size_t, std::size_t> set_operation_partition(Iter1 first1,
+        std::size_t len1, Iter2 first2, std::size_t len2, std::size_t diag,
+        F& f, Proj1& proj1, Proj2& proj2)
+    {
+        if (diag >= len1 + len2)
+        {
+            return {len1, len2};
+        }
+
+        std::size_t const pos1 = merge_path_partition(
+            first1, len1, first2, len2, diag, f, proj1, proj2);
+        std::size_t const pos2 = diag - pos1;
+
+        // the first element following the split position is the smaller one
+        // of the two candidates, all elements equivalent to it are moved
+        // behind the split position
+        auto split = [&](auto const& value) {
+            auto const it1 =
+                detail::lower_bound(first1, first1 + pos1, value, f, proj1);
+            auto const it2 =
+                detail::lower_bound(first2, first2 + pos2, value, f, proj2);
+            return std::make_pair(static_cast<std::size_t>(it1 - first1),
+                static_cast<std::size_t>(it2 - first2));
+        };
+
+        if (pos1 == len1 ||
+            (pos2 != len2 &&
+                HPX_INVOKE(f, HPX_INVOKE(proj2, *(first2 + pos2)),
+                    HPX_INVOKE(proj1, *(first1 + pos1)))))
+        {
+            return split(HPX_INVOKE(proj2, *(first2 + pos2)));
+        }
+        return split(HPX_INVOKE(proj1, *(first1 + pos1)));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The set operations are performed in two passes over chunks of (almost)
+    // equal size of the merged input sequences. The first pass determines
+    // the number of elements each of the chunks produces without writing
+    // them, the second pass performs the set operation again writing the
+    // elements directly to their final position in the destination.
     template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
         typename Sent2, typename Iter3, typename F, typename Proj1,
-        typename Proj2, typename Combiner, typename SetOp>
+        typename Proj2, typename SetOp>
     util::detail::algorithm_result_t<ExPolicy,
         util::in_in_out_result<Iter1, Iter2, Iter3>>
     set_operation(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
         Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2,
-        Combiner&& combiner, SetOp&& setop)
+        SetOp&& setop)
     {
         using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
-        using difference_type1 =
-            typename std::iterator_traits<Iter1>::difference_type;
-        using difference_type2 =
-            typename std::iterator_traits<Iter2>::difference_type;
-
-        // allocate intermediate buffers
-        difference_type1 len1 = detail::distance(first1, last1);
-        difference_type2 len2 = detail::distance(first2, last2);
-
-        using buffer_type = typename set_operations_buffer<Iter3>::type;
-
-        std::size_t cores = execution::processing_units_count(
-            policy.parameters(), policy.executor(), hpx::chrono::null_duration,
-            (std::min)(len1, len2));
-
-        std::size_t const step = (len1 + cores - 1) / cores;
+        std::size_t const len1 = detail::distance(first1, last1);
+        std::size_t const len2 = detail::distance(first2, last2);
 
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-        std::shared_ptr<buffer_type[]> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[cores]);
-#else
-        boost::shared_array<buffer_type> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        boost::shared_array<set_chunk_data> chunks(new set_chunk_data[cores]);
-#endif
+        if (len1 + len2 == 0)
+        {
+            return util::detail::algorithm_result<ExPolicy, result_type>::get(
+                result_type{first1, first2, dest});
+        }
 
         // first step, is applied to all partitions
-        auto f1 = [=](set_chunk_data* curr_chunk,
-                      std::size_t const part_size) mutable -> void {
-            HPX_ASSERT(part_size == 1);
-            HPX_UNUSED(part_size);
-
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 =
-                (std::min)(start1 + step, static_cast<std::size_t>(len1));
-
-            if (start1 >= end1)
-            {
-                return;
-            }
-
-            bool const first_partition = start1 == 0;
-            bool const last_partition = end1 == static_cast<std::size_t>(len1);
-
-            auto start_value = HPX_INVOKE(proj1, first1[start1]);
-            auto end_value = HPX_INVOKE(proj1, first1[end1]);
-
-            // all but the last chunk require special handling
-            if (!last_partition)
-            {
-                // this chunk will be handled by the next one if all elements of
-                // this partition are equal
-                if (!HPX_INVOKE(f, start_value, end_value))
-                {
-                    return;
-                }
-
-                // move backwards to find earliest element which is equal to the
-                // last element of the current chunk
-                if (end1 != 0)
-                {
-                    auto end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-
-                    while (!HPX_INVOKE(f, end_value1, end_value) && --end1 != 0)
-                    {
-                        end_value = HPX_MOVE(end_value1);
-                        end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-                    }
-                }
-            }
-
-            // move backwards to find earliest element which is equal to the
-            // first element of the current chunk
-            if (start1 != 0)
-            {
-                auto start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-
-                while (
-                    !HPX_INVOKE(f, start_value1, start_value) && --start1 != 0)
-                {
-                    start_value = HPX_MOVE(start_value1);
-                    start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-                }
-            }
-
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
-            {
-                start2 = detail::lower_bound(
-                             first2, first2 + len2, start_value, f, proj2) -
-                    first2;
-            }
-
-            std::size_t end2 = len2;
-            if (!last_partition)
-            {
-                end2 = detail::lower_bound(first2 + start2, first2 + len2,
-                           end_value, f, proj2) -
-                    first2;
-            }
-
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            auto op_result = setop(first1 + start1, first1 + end1,
-                first2 + start2, first2 + end2, buffer_dest, f);
-            curr_chunk->first1 = op_result.in1 - first1;
-            curr_chunk->first2 = op_result.in2 - first2;
-            curr_chunk->len = op_result.out - buffer_dest;
+        auto f1 = [=](auto part_begin,
+                      std::size_t part_size) mutable -> set_chunk_data {
+            std::size_t const diag = *part_begin;
+
+            set_chunk_data chunk;
+            std::tie(chunk.start1, chunk.start2) = set_operation_partition(
+                first1, len1, first2, len2, diag, f, proj1, proj2);
+            std::tie(chunk.end1, chunk.end2) =
+                set_operation_partition(first1, len1, first2, len2,
+                    diag + part_size, f, proj1, proj2);
+
+            // determine the number of elements generated by this chunk
+            auto op_result = setop(first1 + chunk.start1, first1 + chunk.end1,
+                first2 + chunk.start2, first2 + chunk.end2,
+                set_operation_counter{}, f);
+
+            chunk.first1 = op_result.in1 - first1;
+            chunk.first2 = op_result.in2 - first2;
+            chunk.len = op_result.out.count;
+            return chunk;
         };
 
         // second step, is executed after all partitions are done running
-
-        // different versions of clang-format produce different formatting
-        // clang-format off
-        auto f2 = [buffer, chunks, cores, first1, first2, dest](
-                      auto&& data) -> result_type {
-            // clang-format on
-
-            // make sure iterators embedded in function object that is attached
-            // to futures are invalidated
-            util::detail::clear_container(data);
-
+        auto f2 = [=](auto&& chunks) mutable -> result_type {
             // accumulate real length and rightmost positions in input sequences
             std::size_t first1_pos = 0;
             std::size_t first2_pos = 0;
-
-            set_chunk_data* chunk = chunks.get();
-            chunk->start_index = 0;
-            for (size_t i = 1; i != cores; ++i)
+            std::size_t start_index = 0;
+            for (set_chunk_data& chunk : chunks)
             {
-                set_chunk_data const* curr_chunk = chunk++;
-                chunk->start_index = curr_chunk->start_index + curr_chunk->len;
-                if (curr_chunk->first1 != static_cast<std::size_t>(-1))
-                {
-                    first1_pos = (std::max)(first1_pos, curr_chunk->first1);
-                }
-                if (curr_chunk->first2 != static_cast<std::size_t>(-1))
-                {
-                    first2_pos = (std::max)(first2_pos, curr_chunk->first2);
-                }
+                chunk.start_index = start_index;
+                start_index += chunk.len;
+
+                first1_pos = (std::max)(first1_pos, chunk.first1);
+                first2_pos = (std::max)(first2_pos, chunk.first2);
             }
 
-            // finally, copy data to destination
+            // finally, write the data to the destination
             parallel::util::
                 foreach_partitioner<hpx::execution::parallel_policy>::call(
-                    hpx::execution::par, chunks.get(), cores,
-                    [buffer, dest](
-                        set_chunk_data* ch, std::size_t, std::size_t) {
-                        if (ch->start == set_chunk_data::uninit_start ||
-                            ch->start_index ==
-                                set_chunk_data::uninit_start_index ||
-                            ch->len == set_chunk_data::uninit_len)
+                    hpx::execution::par, chunks.data(), chunks.size(),
+                    [&](set_chunk_data* ch, std::size_t part_size,
+                        std::size_t) {
+                        for (/**/; part_size != 0; --part_size, ++ch)
                         {
-                            return;
+                            if (ch->len != 0)
+                            {
+                                setop(first1 + ch->start1, first1 + ch->end1,
+                                    first2 + ch->start2, first2 + ch->end2,
+                                    std::next(dest, ch->start_index), f);
+                            }
                         }
-                        std::copy(buffer.get() + ch->start,
-                            buffer.get() + ch->start + ch->len,
-                            dest + ch->start_index);
                     },
                     [](set_chunk_data* last) -> set_chunk_data* {
                         return last;
                     });
 
             return {std::next(first1, first1_pos),
-                std::next(first2, first2_pos),
-                std::next(dest, chunk->start_index + chunk->len)};
+                std::next(first2, first2_pos), std::next(dest, start_index)};
         };
 
-        // fill the buffer piecewise
-        return parallel::util::partitioner<ExPolicy, result_type, void>::call(
-            policy, chunks.get(), cores, HPX_MOVE(f1), HPX_MOVE(f2));
+        return parallel::util::partitioner<ExPolicy, result_type,
+            set_chunk_data>::call(HPX_FORWARD(ExPolicy, policy),
+            hpx::util::counting_iterator(std::size_t(0)), len1 + len2,
+            HPX_MOVE(f1), hpx::unwrapping(HPX_MOVE(f2)));
     }
 
     /// \endcond
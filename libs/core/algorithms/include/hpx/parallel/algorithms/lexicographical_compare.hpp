@@ -163,10 +163,13 @@ namespace hpx {
 #include <hpx/config.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/mismatch.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/util/cancellation_token.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -192,6 +195,25 @@ namespace hpx::parallel {
         struct lexicographical_compare
           : public algorithm<lexicographical_compare, bool>
         {
+            // Two elements are equivalent if neither of them is ordered
+            // before the other, the comparison stops at the first pair of
+            // elements that are not.
+            template <typename Pred>
+            struct equivalent_elements
+            {
+                Pred& pred;
+
+                template <typename T1, typename T2>
+                constexpr auto operator()(T1 const& t1, T2 const& t2) const
+                    -> decltype(!(hpx::invoke(pred, t1, t2) ||
+                        hpx::invoke(pred, t2, t1)))
+                {
+                    // gcc10/cuda11 complains about using HPX_INVOKE here
+                    return !(hpx::invoke(pred, t1, t2) ||
+                        hpx::invoke(pred, t2, t1));
+                }
+            };
+
             constexpr lexicographical_compare() noexcept
               : algorithm("lexicographical_compare")
             {
@@ -204,20 +226,51 @@ namespace hpx::parallel {
                 Sent1 last1, InIter2 first2, Sent2 last2, Pred&& pred,
                 Proj1&& proj1, Proj2&& proj2)
             {
-                for (; first1 != last1 && first2 != last2;
-                     (void) ++first1, ++first2)
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
                 {
-                    if (HPX_INVOKE(pred, HPX_INVOKE(proj1, *first1),
-                            HPX_INVOKE(proj2, *first2)))
-                    {
-                        return true;
-                    }
-                    if (HPX_INVOKE(pred, HPX_INVOKE(proj2, *first2),
-                            HPX_INVOKE(proj1, *first1)))
+                    // compare all elements up to the first mismatch at once
+                    std::size_t const count = (std::min)(
+                        static_cast<std::size_t>(
+                            detail::distance(first1, last1)),
+                        static_cast<std::size_t>(
+                            detail::distance(first2, last2)));
+                    using equivalent =
+                        equivalent_elements<std::remove_reference_t<Pred>>;
+
+                    util::cancellation_token<std::size_t> tok(count);
+                    sequential_mismatch_binary<ExPolicy>(std::size_t(0),
+                        hpx::util::zip_iterator<InIter1, InIter2>(
+                            first1, first2),
+                        count, tok, equivalent{pred}, proj1, proj2);
+
+                    std::size_t const mismatched = tok.get_data();
+
+                    std::advance(first1, mismatched);
+                    std::advance(first2, mismatched);
+                }
+                else
+                {
+                    for (; first1 != last1 && first2 != last2;
+                         (void) ++first1, ++first2)
                     {
-                        return false;
+                        if (HPX_INVOKE(pred, HPX_INVOKE(proj1, *first1),
+                                HPX_INVOKE(proj2, *first2)))
+                        {
+                            return true;
+                        }
+                        if (HPX_INVOKE(pred, HPX_INVOKE(proj2, *first2),
+                                HPX_INVOKE(proj1, *first1)))
+                        {
+                            return false;
+                        }
                     }
                 }
+
+                if (first1 != last1 && first2 != last2)
+                {
+                    return HPX_INVOKE(pred, HPX_INVOKE(proj1, *first1),
+                        HPX_INVOKE(proj2, *first2));
+                }
                 return first1 == last1 && first2 != last2;
             }
 
@@ -230,7 +283,6 @@ namespace hpx::parallel {
             {
                 using zip_iterator =
                     hpx::util::zip_iterator<FwdIter1, FwdIter2>;
-                using reference = typename zip_iterator::reference;
                 constexpr bool has_scheduler_executor =
                     hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
 
@@ -263,23 +315,14 @@ namespace hpx::parallel {
                 std::size_t count = (std::min)(count1, count2);
                 hpx::parallel::util::cancellation_token<std::size_t> tok(count);
 
+                using equivalent =
+                    equivalent_elements<std::remove_reference_t<Pred>>;
+
                 auto f1 = [tok, pred, proj1, proj2](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n<policy_type>(base_idx, it, part_count, tok,
-                        [&pred, &tok, &proj1, &proj2](
-                            reference t, std::size_t i) mutable -> void {
-                            using hpx::get;
-                            using hpx::invoke;
-                            // gcc10/cuda11 complains about using HPX_INVOKE here
-                            if (invoke(pred, invoke(proj1, get<0>(t)),
-                                    invoke(proj2, get<1>(t))) ||
-                                invoke(pred, invoke(proj2, get<1>(t)),
-                                    invoke(proj1, get<0>(t))))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_mismatch_binary<policy_type>(base_idx, it,
+                        part_count, tok, equivalent{pred}, proj1, proj2);
                 };
 
                 auto f2 = [tok, first1, first2, last1, last2, pred, proj1,
@@ -299,9 +342,8 @@ namespace hpx::parallel {
 
                     if (first1 != last1 && first2 != last2)
                     {
-                        using hpx::invoke;
-                        return invoke(pred, invoke(proj1, *first1),
-                            invoke(proj2, *first2));
+                        return hpx::invoke(pred, hpx::invoke(proj1, *first1),
+                            hpx::invoke(proj2, *first2));
                     }
 
                     return first2 != last2;
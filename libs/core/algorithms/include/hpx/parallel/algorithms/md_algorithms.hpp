@@ -0,0 +1,525 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/md_algorithms.hpp
+/// \page hpx::experimental::md_for_each, hpx::experimental::md_transform, hpx::experimental::md_reduce, hpx::experimental::transpose
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Applies \a f to all elements of the multi-dimensional view \a view.
+    /// The view is split into tiles of (almost) equal size which are close
+    /// to square (or cubic), every tile is processed as a separate task.
+    /// Executed according to the policy.
+    ///
+    /// \note   Complexity: Applies \a f exactly \a view.size() times.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam View        The type of the multi-dimensional view (deduced).
+    ///                     This type must expose a static member function
+    ///                     \a rank(), a member function \a extent(dim), a
+    ///                     nested type \a index_type, and an element access
+    ///                     operator[] taking a std::array of \a rank()
+    ///                     indices, as std::mdspan does.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         Refers to the elements the algorithm will be
+    ///                     applied to.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     view.
+    ///
+    /// The elements of every tile are visited such that the last index
+    /// varies fastest.
+    ///
+    /// \returns  The \a md_for_each algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a void otherwise.
+    template <typename ExPolicy, typename View, typename F>
+    util::detail::algorithm_result_t<ExPolicy>
+    md_for_each(ExPolicy&& policy, View const& view, F&& f);
+
+    /// Applies \a f to all elements of the multi-dimensional view \a view.
+    /// Executed sequentially, the last index varies fastest.
+    ///
+    /// \note   Complexity: Applies \a f exactly \a view.size() times.
+    ///
+    /// \tparam View        The type of the multi-dimensional view (deduced).
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param view         Refers to the elements the algorithm will be
+    ///                     applied to.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     view.
+    ///
+    /// \returns  The \a md_for_each algorithm returns \a void.
+    template <typename View, typename F>
+    void md_for_each(View const& view, F&& f);
+
+    /// Assigns the result of applying \a f to each of the elements of the
+    /// multi-dimensional view \a src to the element with the same indices
+    /// in the view \a dest. Both views must have the same extents. Executed
+    /// according to the policy.
+    ///
+    /// \note   Complexity: Applies \a f exactly \a src.size() times.
+    ///
+    /// \returns  The \a md_transform algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a void otherwise.
+    template <typename ExPolicy, typename Src, typename Dest, typename F>
+    util::detail::algorithm_result_t<ExPolicy>
+    md_transform(ExPolicy&& policy, Src const& src, Dest const& dest, F&& f);
+
+    /// Assigns the result of applying \a f to each of the elements of the
+    /// multi-dimensional view \a src to the element with the same indices
+    /// in the view \a dest. Both views must have the same extents. Executed
+    /// sequentially.
+    ///
+    /// \note   Complexity: Applies \a f exactly \a src.size() times.
+    ///
+    /// \returns  The \a md_transform algorithm returns \a void.
+    template <typename Src, typename Dest, typename F>
+    void md_transform(Src const& src, Dest const& dest, F&& f);
+
+    /// Returns GENERALIZED_SUM(r, init, e...) over all elements e of the
+    /// multi-dimensional view \a view. Executed according to the policy.
+    ///
+    /// \note   Complexity: O(\a view.size()) applications of the predicate
+    ///         \a r.
+    ///
+    /// \returns  The \a md_reduce algorithm returns a \a hpx::future<T> if
+    ///           the execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a T otherwise.
+    template <typename ExPolicy, typename View, typename T,
+        typename Reduce = std::plus<>>
+    util::detail::algorithm_result_t<ExPolicy, T>
+    md_reduce(ExPolicy&& policy, View const& view, T init,
+        Reduce&& r = Reduce());
+
+    /// Returns GENERALIZED_SUM(r, init, e...) over all elements e of the
+    /// multi-dimensional view \a view. Executed sequentially.
+    ///
+    /// \note   Complexity: O(\a view.size()) applications of the predicate
+    ///         \a r.
+    ///
+    /// \returns  The \a md_reduce algorithm returns \a T.
+    template <typename View, typename T, typename Reduce = std::plus<>>
+    T md_reduce(View const& view, T init, Reduce&& r = Reduce());
+
+    /// Assigns every element src[i, j] of the two-dimensional view \a src to
+    /// the element dest[j, i] of the two-dimensional view \a dest. The
+    /// extents of \a dest must be the extents of \a src in reverse order.
+    /// Every tile is transposed by recursively splitting it along its larger
+    /// extent, which gives good cache utilization for all levels of the
+    /// memory hierarchy independently of their sizes (cache-oblivious).
+    /// Executed according to the policy.
+    ///
+    /// \note   Complexity: Performs exactly \a src.size() assignments.
+    ///
+    /// \returns  The \a transpose algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a void otherwise.
+    template <typename ExPolicy, typename Src, typename Dest>
+    util::detail::algorithm_result_t<ExPolicy>
+    transpose(ExPolicy&& policy, Src const& src, Dest const& dest);
+
+    /// Assigns every element src[i, j] of the two-dimensional view \a src to
+    /// the element dest[j, i] of the two-dimensional view \a dest. The
+    /// extents of \a dest must be the extents of \a src in reverse order.
+    /// Executed sequentially.
+    ///
+    /// \note   Complexity: Performs exactly \a src.size() assignments.
+    ///
+    /// \returns  The \a transpose algorithm returns \a void.
+    template <typename Src, typename Dest>
+    void transpose(Src const& src, Dest const& dest);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/md_partitioner.hpp>
+#include <hpx/type_support/empty_function.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename View>
+    inline constexpr std::size_t md_rank_v = std::decay_t<View>::rank();
+
+    template <typename View>
+    using md_index_t =
+        std::array<typename std::decay_t<View>::index_type, md_rank_v<View>>;
+
+    template <typename View>
+    std::array<std::size_t, md_rank_v<View>> md_extents(View const& view)
+    {
+        std::array<std::size_t, md_rank_v<View>> extents{};
+        for (std::size_t dim = 0; dim != md_rank_v<View>; ++dim)
+        {
+            extents[dim] = static_cast<std::size_t>(view.extent(dim));
+        }
+        return extents;
+    }
+
+    // Invokes f for the indices of all elements of the given tile, the last
+    // index varies fastest.
+    template <std::size_t Dim = 0, std::size_t Rank, typename Index,
+        typename F>
+    void md_loop(util::md_tile<Rank> const& tile, Index& idx, F& f)
+    {
+        using index_type = typename Index::value_type;
+        for (std::size_t i = tile.first[Dim]; i != tile.last[Dim]; ++i)
+        {
+            idx[Dim] = static_cast<index_type>(i);
+            if constexpr (Dim + 1 == Rank)
+            {
+                f(std::as_const(idx));
+            }
+            else
+            {
+                md_loop<Dim + 1>(tile, idx, f);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // tiles smaller than this in both dimensions are transposed directly
+    inline constexpr std::size_t transpose_block_size = 16;
+
+    template <typename Src, typename Dest>
+    void transpose_tile(Src const& src, Dest const& dest,
+        std::size_t row_first, std::size_t row_last, std::size_t col_first,
+        std::size_t col_last)
+    {
+        std::size_t const rows = row_last - row_first;
+        std::size_t const cols = col_last - col_first;
+
+        if (rows <= transpose_block_size && cols <= transpose_block_size)
+        {
+            using src_index = typename md_index_t<Src>::value_type;
+            using dest_index = typename md_index_t<Dest>::value_type;
+
+            for (std::size_t i = row_first; i != row_last; ++i)
+            {
+                for (std::size_t j = col_first; j != col_last; ++j)
+                {
+                    dest[md_index_t<Dest>{{static_cast<dest_index>(j),
+                        static_cast<dest_index>(i)}}] =
+                        src[md_index_t<Src>{{static_cast<src_index>(i),
+                            static_cast<src_index>(j)}}];
+                }
+            }
+        }
+        else if (rows >= cols)
+        {
+            std::size_t const mid = row_first + rows / 2;
+            transpose_tile(src, dest, row_first, mid, col_first, col_last);
+            transpose_tile(src, dest, mid, row_last, col_first, col_last);
+        }
+        else
+        {
+            std::size_t const mid = col_first + cols / 2;
+            transpose_tile(src, dest, row_first, row_last, col_first, mid);
+            transpose_tile(src, dest, row_first, row_last, mid, col_last);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename View, typename F>
+    util::detail::algorithm_result_t<ExPolicy> md_for_each(
+        ExPolicy&& policy, View const& view, F&& f)
+    {
+        auto f1 = [view, f = HPX_FORWARD(F, f)](
+                      auto const& tile) mutable -> void {
+            md_index_t<View> idx{};
+            auto loop = [&](auto const& i) { HPX_INVOKE(f, view[i]); };
+            md_loop(tile, idx, loop);
+        };
+
+        return util::detail::algorithm_result<ExPolicy>::get(
+            util::md_partitioner<ExPolicy>::call(HPX_FORWARD(ExPolicy, policy),
+                md_extents(view), HPX_MOVE(f1),
+                hpx::util::empty_function()));
+    }
+
+    template <typename ExPolicy, typename Src, typename Dest, typename F>
+    util::detail::algorithm_result_t<ExPolicy> md_transform(
+        ExPolicy&& policy, Src const& src, Dest const& dest, F&& f)
+    {
+        static_assert(md_rank_v<Src> == md_rank_v<Dest>,
+            "the source and destination views must have the same rank");
+
+        auto const extents = md_extents(src);
+        HPX_ASSERT(extents == md_extents(dest));
+
+        auto f1 = [src, dest, f = HPX_FORWARD(F, f)](
+                      auto const& tile) mutable -> void {
+            using dest_index = typename md_index_t<Dest>::value_type;
+
+            md_index_t<Src> idx{};
+            auto loop = [&](auto const& i) {
+                md_index_t<Dest> dest_idx;
+                for (std::size_t dim = 0; dim != i.size(); ++dim)
+                {
+                    dest_idx[dim] = static_cast<dest_index>(i[dim]);
+                }
+                dest[dest_idx] = HPX_INVOKE(f, src[i]);
+            };
+            md_loop(tile, idx, loop);
+        };
+
+        return util::detail::algorithm_result<ExPolicy>::get(
+            util::md_partitioner<ExPolicy>::call(HPX_FORWARD(ExPolicy, policy),
+                extents, HPX_MOVE(f1), hpx::util::empty_function()));
+    }
+
+    template <typename ExPolicy, typename View, typename T,
+        typename Reduce>
+    util::detail::algorithm_result_t<ExPolicy, T> md_reduce(
+        ExPolicy&& policy, View const& view, T init, Reduce&& r)
+    {
+        auto const extents = md_extents(view);
+        for (std::size_t const extent : extents)
+        {
+            if (extent == 0)
+            {
+                return util::detail::algorithm_result<ExPolicy, T>::get(
+                    HPX_MOVE(init));
+            }
+        }
+
+        auto f1 = [view, r](auto const& tile) mutable -> T {
+            using index_type = typename md_index_t<View>::value_type;
+
+            md_index_t<View> idx{};
+            for (std::size_t dim = 0; dim != idx.size(); ++dim)
+            {
+                idx[dim] = static_cast<index_type>(tile.first[dim]);
+            }
+
+            // the first element of the tile is the initial value
+            T val = view[idx];
+            bool skip = true;
+
+            auto loop = [&](auto const& i) {
+                if (skip)
+                {
+                    skip = false;
+                    return;
+                }
+                val = HPX_INVOKE(r, HPX_MOVE(val), view[i]);
+            };
+            md_loop(tile, idx, loop);
+            return val;
+        };
+
+        return util::md_partitioner<ExPolicy, T>::call(
+            HPX_FORWARD(ExPolicy, policy), extents, HPX_MOVE(f1),
+            hpx::unwrapping([init = HPX_MOVE(init),
+                                r = HPX_FORWARD(Reduce, r)](
+                                auto&& results) mutable -> T {
+                for (auto& val : results)
+                {
+                    init = HPX_INVOKE(r, HPX_MOVE(init), HPX_MOVE(val));
+                }
+                return HPX_MOVE(init);
+            }));
+    }
+
+    template <typename ExPolicy, typename Src, typename Dest>
+    util::detail::algorithm_result_t<ExPolicy> transpose(
+        ExPolicy&& policy, Src const& src, Dest const& dest)
+    {
+        static_assert(md_rank_v<Src> == 2 &&
+                md_rank_v<Dest> == 2,
+            "transpose requires two-dimensional views");
+
+        auto const extents = md_extents(src);
+        HPX_ASSERT(extents[0] == static_cast<std::size_t>(dest.extent(1)) &&
+            extents[1] == static_cast<std::size_t>(dest.extent(0)));
+
+        auto f1 = [src, dest](auto const& tile) -> void {
+            transpose_tile(src, dest, tile.first[0], tile.last[0],
+                tile.first[1], tile.last[1]);
+        };
+
+        return util::detail::algorithm_result<ExPolicy>::get(
+            util::md_partitioner<ExPolicy>::call(HPX_FORWARD(ExPolicy, policy),
+                extents, HPX_MOVE(f1), hpx::util::empty_function()));
+    }
+
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct md_for_each_t final
+      : hpx::detail::tag_parallel_algorithm<md_for_each_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename View, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(
+            hpx::experimental::md_for_each_t, ExPolicy&& policy,
+            View const& view, F&& f)
+        {
+            return hpx::parallel::detail::md_for_each(
+                HPX_FORWARD(ExPolicy, policy), view, HPX_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename View, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                !hpx::is_execution_policy_v<View>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(
+            hpx::experimental::md_for_each_t, View const& view, F&& f)
+        {
+            return hpx::parallel::detail::md_for_each(
+                hpx::execution::seq, view, HPX_FORWARD(F, f));
+        }
+    } md_for_each{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct md_transform_t final
+      : hpx::detail::tag_parallel_algorithm<md_transform_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Src, typename Dest, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(
+            hpx::experimental::md_transform_t, ExPolicy&& policy,
+            Src const& src, Dest const& dest, F&& f)
+        {
+            return hpx::parallel::detail::md_transform(
+                HPX_FORWARD(ExPolicy, policy), src, dest, HPX_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename Src, typename Dest, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                !hpx::is_execution_policy_v<Src>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(hpx::experimental::md_transform_t,
+            Src const& src, Dest const& dest, F&& f)
+        {
+            return hpx::parallel::detail::md_transform(
+                hpx::execution::seq, src, dest, HPX_FORWARD(F, f));
+        }
+    } md_transform{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct md_reduce_t final
+      : hpx::detail::tag_parallel_algorithm<md_reduce_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename View, typename T,
+            typename Reduce = std::plus<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(
+            hpx::experimental::md_reduce_t, ExPolicy&& policy,
+            View const& view, T init, Reduce&& r = Reduce())
+        {
+            return hpx::parallel::detail::md_reduce(
+                HPX_FORWARD(ExPolicy, policy), view, HPX_MOVE(init),
+                HPX_FORWARD(Reduce, r));
+        }
+
+        // clang-format off
+        template <typename View, typename T, typename Reduce = std::plus<>,
+            HPX_CONCEPT_REQUIRES_(
+                !hpx::is_execution_policy_v<View>
+            )>
+        // clang-format on
+        friend T tag_fallback_invoke(hpx::experimental::md_reduce_t,
+            View const& view, T init, Reduce&& r = Reduce())
+        {
+            return hpx::parallel::detail::md_reduce(hpx::execution::seq,
+                view, HPX_MOVE(init), HPX_FORWARD(Reduce, r));
+        }
+    } md_reduce{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct transpose_t final
+      : hpx::detail::tag_parallel_algorithm<transpose_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Src, typename Dest,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(
+            hpx::experimental::transpose_t, ExPolicy&& policy, Src const& src,
+            Dest const& dest)
+        {
+            return hpx::parallel::detail::transpose(
+                HPX_FORWARD(ExPolicy, policy), src, dest);
+        }
+
+        // clang-format off
+        template <typename Src, typename Dest,
+            HPX_CONCEPT_REQUIRES_(
+                !hpx::is_execution_policy_v<Src>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(
+            hpx::experimental::transpose_t, Src const& src, Dest const& dest)
+        {
+            return hpx::parallel::detail::transpose(
+                hpx::execution::seq, src, dest);
+        }
+    } transpose{};
+}    // namespace hpx::experimental
+
+#endif
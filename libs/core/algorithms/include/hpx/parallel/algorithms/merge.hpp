@@ -286,17 +286,24 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/rotate.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/result_types.hpp>
+#include <hpx/type_support/empty_function.hpp>
 #include <hpx/type_support/identity.hpp>
 
 #include <algorithm>
@@ -305,6 +312,7 @@ namespace hpx {
 #include <iterator>
 #include <list>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -355,8 +363,6 @@ namespace hpx::parallel {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        struct lower_bound_helper;
-
         struct upper_bound_helper
         {
             // upper_bound with projection function.
@@ -368,8 +374,6 @@ namespace hpx::parallel {
                 return detail::upper_bound(first, last, value,
                     HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
             }
-
-            using another_type = lower_bound_helper;
         };
 
         struct lower_bound_helper
@@ -383,139 +387,75 @@ namespace hpx::parallel {
                 return detail::lower_bound(first, last, value,
                     HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
             }
-
-            using another_type = upper_bound_helper;
         };
 
         ///////////////////////////////////////////////////////////////////////
-        template <typename ExPolicy, typename Iter1, typename Sent1,
-            typename Iter2, typename Sent2, typename Iter3, typename Comp,
-            typename Proj1, typename Proj2, typename BinarySearchHelper>
-        void parallel_merge_helper(ExPolicy policy, Iter1 first1, Sent1 last1,
-            Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1,
-            Proj2&& proj2, bool range_reversal, BinarySearchHelper)
+        // Merges the part [diag, diag + count) of the merged sequence. The
+        // corresponding subranges of the input sequences are found using
+        // merge path partitioning.
+        template <typename Iter1, typename Iter2, typename Iter3,
+            typename Comp, typename Proj1, typename Proj2>
+        void merge_path_chunk(Iter1 first1, std::size_t len1, Iter2 first2,
+            std::size_t len2, Iter3 dest, std::size_t diag, std::size_t count,
+            Comp&& comp, Proj1&& proj1, Proj2&& proj2)
         {
-            constexpr std::size_t threshold = 65536;
-
-            std::size_t const size1 = detail::distance(first1, last1);
-            std::size_t const size2 = detail::distance(first2, last2);
-
-            // Perform sequential merge if data size is smaller than threshold.
-            if (size1 + size2 <= threshold)
-            {
-                if (range_reversal)
-                {
-                    sequential_merge(first2, last2, first1, last1, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                        HPX_FORWARD(Proj1, proj1));
-                }
-                else
-                {
-                    sequential_merge(first1, last1, first2, last2, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj1, proj1),
-                        HPX_FORWARD(Proj2, proj2));
-                }
-                return;
-            }
-
-            // Let size1 is bigger than size2 always.
-            if (size1 < size2)
-            {
-                // For stability of algorithm, must switch binary search methods
-                // when swapping size1 and size2.
-                parallel_merge_helper(policy, first2, last2, first1, last1,
-                    dest, HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                    HPX_FORWARD(Proj1, proj1), !range_reversal,
-                    typename BinarySearchHelper::another_type());
-                return;
-            }
-
-            HPX_ASSERT(size1 >= size2);
-            HPX_ASSERT(size1 >= 1ul);
+            std::size_t const start1 = merge_path_partition(
+                first1, len1, first2, len2, diag, comp, proj1, proj2);
+            std::size_t const end1 = merge_path_partition(
+                first1, len1, first2, len2, diag + count, comp, proj1, proj2);
 
-            Iter1 mid1 = first1 + size1 / 2;
-            Iter2 boundary2 = BinarySearchHelper::call(
-                first2, last2, HPX_INVOKE(proj1, *mid1), comp, proj2);
-            Iter3 target = dest + (mid1 - first1) + (boundary2 - first2);
+            std::size_t const start2 = diag - start1;
+            std::size_t const end2 = diag + count - end1;
 
-            *target = *mid1;
-
-            hpx::future<void> fut =
-                execution::async_execute(policy.executor(), [&]() -> void {
-                    // Process left side ranges.
-                    parallel_merge_helper(policy, first1, mid1, first2,
-                        boundary2, dest, comp, proj1, proj2, range_reversal,
-                        BinarySearchHelper());
-                });
-
-            try
-            {
-                // Process right side ranges.
-                parallel_merge_helper(policy, mid1 + 1, last1, boundary2, last2,
-                    target + 1, HPX_FORWARD(Comp, comp),
-                    HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2),
-                    range_reversal, BinarySearchHelper());
-            }
-            catch (...)
-            {
-                fut.wait();
-
-                std::vector<hpx::future<void>> futures;
-                futures.reserve(2);
-                futures.emplace_back(HPX_MOVE(fut));
-                futures.emplace_back(hpx::make_exceptional_future<void>(
-                    std::current_exception()));
-
-                std::list<std::exception_ptr> errors;
-                util::detail::handle_local_exceptions<ExPolicy>::call(
-                    futures, errors);
-
-                HPX_UNREACHABLE;
-            }
-
-            fut.get();
+            sequential_merge(first1 + start1, first1 + end1, first2 + start2,
+                first2 + end2, dest + diag, HPX_FORWARD(Comp, comp),
+                HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
         }
 
+        // The merged sequence is split into chunks of equal size, every chunk
+        // is merged independently of all others.
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename Iter3, typename Comp,
             typename Proj1, typename Proj2>
-        hpx::future<util::in_in_out_result<Iter1, Iter2, Iter3>> parallel_merge(
-            ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
-            Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1, Proj2&& proj2)
+        util::detail::algorithm_result_t<ExPolicy,
+            util::in_in_out_result<Iter1, Iter2, Iter3>>
+        parallel_merge(ExPolicy&& policy, Iter1 first1, Sent1 last1,
+            Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1,
+            Proj2&& proj2)
         {
             using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
-            auto f1 = [first1, last1, first2, last2, dest,
-                          policy = HPX_FORWARD(ExPolicy, policy),
-                          comp = HPX_FORWARD(Comp, comp),
+            std::size_t const len1 = detail::distance(first1, last1);
+            std::size_t const len2 = detail::distance(first2, last2);
+
+            if (len1 + len2 == 0)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(result_type{first1, first2, dest});
+            }
+
+            auto f1 = [=, comp = HPX_FORWARD(Comp, comp),
                           proj1 = HPX_FORWARD(Proj1, proj1),
-                          proj2 = HPX_FORWARD(
-                              Proj2, proj2)]() mutable -> result_type {
-                try
-                {
-                    parallel_merge_helper(HPX_MOVE(policy), first1, last1,
-                        first2, last2, dest, HPX_MOVE(comp), HPX_MOVE(proj1),
-                        HPX_MOVE(proj2), false, lower_bound_helper());
-
-                    auto const len1 = detail::distance(first1, last1);
-                    auto const len2 = detail::distance(first2, last2);
-                    return {std::next(first1, len1), std::next(first2, len2),
-                        std::next(dest, len1 + len2)};
-                }
-                catch (...)
-                {
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        std::current_exception());
-                    HPX_ASSERT(false);
-                    // To silence no return statement in all control blocks
-                    auto len1 = detail::distance(first1, last1);
-                    auto len2 = detail::distance(first2, last2);
-                    return {std::next(first1, len1), std::next(first2, len2),
-                        std::next(dest, len1 + len2)};
-                }
+                          proj2 = HPX_FORWARD(Proj2, proj2)](
+                          auto part_begin,
+                          std::size_t part_size) mutable -> void {
+                merge_path_chunk(first1, len1, first2, len2, dest, *part_begin,
+                    part_size, comp, proj1, proj2);
+            };
+
+            auto f2 = [first1, len1, first2, len2, dest](
+                          auto&& data) -> result_type {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                util::detail::clear_container(data);
+
+                return {first1 + len1, first2 + len2, dest + (len1 + len2)};
             };
 
-            return execution::async_execute(policy.executor(), HPX_MOVE(f1));
+            return util::partitioner<ExPolicy, result_type, void>::call(
+                HPX_FORWARD(ExPolicy, policy),
+                hpx::util::counting_iterator(std::size_t(0)), len1 + len2,
+                HPX_MOVE(f1), HPX_MOVE(f2));
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -555,10 +495,9 @@ namespace hpx::parallel {
 
                 try
                 {
-                    return algorithm_result::get(parallel_merge(
-                        HPX_FORWARD(ExPolicy, policy), first1, last1, first2,
-                        last2, dest, HPX_FORWARD(Comp, comp),
-                        HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2)));
+                    return parallel_merge(HPX_FORWARD(ExPolicy, policy), first1,
+                        last1, first2, last2, dest, HPX_FORWARD(Comp, comp),
+                        HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
                 }
                 catch (...)
                 {
@@ -575,6 +514,9 @@ namespace hpx::parallel {
     // inplace_merge
     namespace detail {
 
+        // sequences shorter than this are merged sequentially
+        inline constexpr std::size_t inplace_merge_limit = 65536ul;
+
         // sequential inplace_merge with projection function.
         template <typename Iter, typename Sent, typename Comp, typename Proj>
         constexpr Iter sequential_inplace_merge(
@@ -591,15 +533,14 @@ namespace hpx::parallel {
         void parallel_inplace_merge_helper(ExPolicy&& policy, Iter first,
             Iter middle, Sent last, Comp&& comp, Proj&& proj)
         {
-            constexpr std::size_t threshold = 65536ul;
-            static_assert(threshold >= 5ul);
+            static_assert(inplace_merge_limit >= 5ul);
 
             std::size_t const left_size = middle - first;
             std::size_t const right_size = last - middle;
 
             // Perform sequential inplace_merge
             //   if data size is smaller than threshold.
-            if (left_size + right_size <= threshold)
+            if (left_size + right_size <= inplace_merge_limit)
             {
                 sequential_inplace_merge(first, middle, last,
                     HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
@@ -718,6 +659,125 @@ namespace hpx::parallel {
             }
         }
 
+        // Destroys the elements moved into the temporary buffer used by
+        // parallel_inplace_merge_buffered and releases its memory.
+        template <typename T>
+        struct inplace_merge_buffer
+        {
+            explicit inplace_merge_buffer(std::size_t count) noexcept
+              : data(static_cast<T*>(::operator new(sizeof(T) * count,
+                    std::align_val_t{alignof(T)}, std::nothrow)))
+            {
+            }
+
+            inplace_merge_buffer(inplace_merge_buffer const&) = delete;
+            inplace_merge_buffer& operator=(
+                inplace_merge_buffer const&) = delete;
+
+            ~inplace_merge_buffer()
+            {
+                std::destroy(data, data + size);
+                ::operator delete(data, std::align_val_t{alignof(T)});
+            }
+
+            T* data;
+            std::size_t size = 0;
+        };
+
+        // All elements are moved into a temporary buffer first, the merged
+        // sequence is then written back in chunks of equal size, the
+        // subranges of the buffer corresponding to each of the chunks are
+        // found using merge path partitioning. Returns false if the buffer
+        // can't be allocated. Moving the elements into the buffer must not
+        // throw, otherwise it would be unknown which of the elements have to
+        // be destroyed.
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        bool parallel_inplace_merge_buffered(ExPolicy&& policy, Iter first,
+            Iter middle, Iter last, Comp& comp, Proj& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            std::size_t const len1 = middle - first;
+            std::size_t const count = last - first;
+
+            if (count <= inplace_merge_limit)
+            {
+                return false;
+            }
+
+            inplace_merge_buffer<value_type> buffer(count);
+            if (buffer.data == nullptr)
+            {
+                return false;
+            }
+
+            auto sync_policy =
+                hpx::execution::experimental::to_non_task(policy);
+            using policy_type = decltype(sync_policy);
+
+            value_type* data = buffer.data;
+            util::partitioner<policy_type>::call(sync_policy,
+                hpx::util::counting_iterator(std::size_t(0)), count,
+                [=](auto part_begin, std::size_t part_size) -> void {
+                    std::size_t const start = *part_begin;
+                    for (std::size_t i = start; i != start + part_size; ++i)
+                    {
+                        ::new (static_cast<void*>(data + i))
+                            value_type(HPX_MOVE(*(first + i)));
+                    }
+                },
+                hpx::util::empty_function());
+
+            // all elements have been moved into the buffer
+            buffer.size = count;
+
+            // All split points are determined before any of the elements is
+            // moved out of the buffer, as the binary searches of a chunk may
+            // inspect elements that are merged by a different chunk.
+            using split_type = std::pair<std::size_t, std::size_t>;
+            std::vector<split_type> splits =
+                util::partitioner<policy_type, std::vector<split_type>,
+                    split_type>::call(sync_policy,
+                    hpx::util::counting_iterator(std::size_t(0)), count,
+                    [=, &comp, &proj](auto part_begin,
+                        std::size_t) -> split_type {
+                        std::size_t const diag = *part_begin;
+                        return {diag,
+                            merge_path_partition(data, len1, data + len1,
+                                count - len1, diag, comp, proj, proj)};
+                    },
+                    hpx::unwrapping([](std::vector<split_type>&& results) {
+                        return HPX_MOVE(results);
+                    }));
+            splits.emplace_back(count, len1);
+
+            split_type const* chunks = splits.data();
+            util::partitioner<policy_type>::call(sync_policy,
+                hpx::util::counting_iterator(std::size_t(0)),
+                splits.size() - 1,
+                [=, &comp, &proj](
+                    auto part_begin, std::size_t part_size) -> void {
+                    std::size_t const start = *part_begin;
+                    for (std::size_t i = start; i != start + part_size; ++i)
+                    {
+                        auto const [diag, start1] = chunks[i];
+                        auto const [next_diag, end1] = chunks[i + 1];
+
+                        sequential_merge(std::make_move_iterator(data + start1),
+                            std::make_move_iterator(data + end1),
+                            std::make_move_iterator(
+                                data + len1 + (diag - start1)),
+                            std::make_move_iterator(
+                                data + len1 + (next_diag - end1)),
+                            first + diag, comp, proj, proj);
+                    }
+                },
+                hpx::util::empty_function());
+
+            return true;
+        }
+
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Comp, typename Proj>
         hpx::future<Iter> parallel_inplace_merge(ExPolicy&& policy, Iter first,
@@ -728,6 +788,20 @@ namespace hpx::parallel {
                     proj = HPX_FORWARD(Proj, proj)]() mutable -> Iter {
                     try
                     {
+                        using value_type =
+                            typename std::iterator_traits<Iter>::value_type;
+                        if constexpr (std::is_nothrow_move_constructible_v<
+                                          value_type>)
+                        {
+                            Iter const end =
+                                detail::advance_to_sentinel(middle, last);
+                            if (parallel_inplace_merge_buffered(
+                                    policy, first, middle, end, comp, proj))
+                            {
+                                return last;
+                            }
+                        }
+
                         parallel_inplace_merge_helper(policy, first, middle,
                             last, HPX_MOVE(comp), HPX_MOVE(proj));
                         return last;
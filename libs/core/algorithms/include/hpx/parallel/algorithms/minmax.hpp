@@ -372,6 +372,7 @@ namespace hpx {
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -394,33 +395,6 @@ namespace hpx::parallel {
     // min_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto smallest = it;
-
-            element_type value = HPX_INVOKE(proj, *smallest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, value))
-                    {
-                        smallest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return smallest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct min_element : public algorithm<min_element<Iter>, Iter>
@@ -446,7 +420,7 @@ namespace hpx::parallel {
                         decltype(smallest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                util::loop_n<hpx::execution::sequenced_policy>(
                     ++it, count - 1, [&](FwdIter const& curr) -> void {
                         element_type curr_value = HPX_INVOKE(proj, **curr);
                         if (HPX_INVOKE(f, curr_value, value))
@@ -467,28 +441,10 @@ namespace hpx::parallel {
             template <typename ExPolicy, typename FwdIter, typename Sent,
                 typename F, typename Proj>
             static constexpr FwdIter sequential(
-                ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                if (first == last)
-                    return first;
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto smallest = first;
-
-                element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, value))
-                        {
-                            smallest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return smallest;
+                return sequential_min_element<std::decay_t<ExPolicy>>(first,
+                    last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -508,10 +464,12 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = [f, proj, policy](
+                using policy_type = std::decay_t<ExPolicy>;
+
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_min_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_min_element<policy_type>(
+                        it, part_count, f, proj);
                 };
 
                 auto f2 = [policy, first, f = HPX_FORWARD(F, f),
@@ -548,33 +506,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto largest = it;
-
-            element_type value = HPX_INVOKE(proj, *largest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (!HPX_INVOKE(f, curr_value, value))
-                    {
-                        largest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return largest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element : public algorithm<max_element<Iter>, Iter>
@@ -599,7 +530,7 @@ namespace hpx::parallel {
                         decltype(largest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *largest);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                util::loop_n<hpx::execution::sequenced_policy>(
                     ++it, count - 1, [&](FwdIter const& curr) -> void {
                         element_type curr_value = HPX_INVOKE(proj, **curr);
                         if (!HPX_INVOKE(f, curr_value, value))
@@ -620,28 +551,10 @@ namespace hpx::parallel {
             template <typename ExPolicy, typename FwdIter, typename Sent,
                 typename F, typename Proj>
             static constexpr FwdIter sequential(
-                ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                if (first == last)
-                    return first;
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto largest = first;
-
-                element_type value = HPX_INVOKE(proj, *largest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (!HPX_INVOKE(f, curr_value, value))
-                        {
-                            largest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return largest;
+                return sequential_max_element<std::decay_t<ExPolicy>>(first,
+                    last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -661,10 +574,12 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = [f, proj, policy](
+                using policy_type = std::decay_t<ExPolicy>;
+
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_max_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_max_element<policy_type>(
+                        it, part_count, f, proj);
                 };
 
                 auto f2 = [policy, first, f = HPX_FORWARD(F, f),
@@ -701,40 +616,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        minmax_element_result<FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
-        {
-            minmax_element_result<FwdIter> result = {it, it};
-
-            if (count == 0 || count == 1)
-                return result;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            element_type min_value = HPX_INVOKE(proj, *it);
-            element_type max_value = min_value;
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, min_value))
-                    {
-                        result.min = curr;
-                        min_value = curr_value;
-                    }
-
-                    if (!HPX_INVOKE(f, curr_value, max_value))
-                    {
-                        result.max = curr;
-                        max_value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return result;
-        }
-
         template <typename Iter>
         struct minmax_element
           : public algorithm<minmax_element<Iter>, minmax_element_result<Iter>>
@@ -759,7 +640,7 @@ namespace hpx::parallel {
 
                 element_type min_value = HPX_INVOKE(proj, *result.min);
                 element_type max_value = HPX_INVOKE(proj, *result.max);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                util::loop_n<hpx::execution::sequenced_policy>(
                     ++it, count - 1, [&](PairIter const& curr) -> void {
                         element_type curr_min_value =
                             HPX_INVOKE(proj, *curr->min);
@@ -790,37 +671,10 @@ namespace hpx::parallel {
             template <typename ExPolicy, typename FwdIter, typename Sent,
                 typename F, typename Proj>
             static constexpr minmax_element_result<FwdIter> sequential(
-                ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                auto min = first, max = first;
-
-                if (first == last || ++first == last)
-                {
-                    return minmax_element_result<FwdIter>{min, max};
-                }
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                element_type min_value = HPX_INVOKE(proj, *min);
-                element_type max_value = HPX_INVOKE(proj, *max);
-                util::loop(HPX_FORWARD(ExPolicy, policy), first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, min_value))
-                        {
-                            min = curr;
-                            min_value = curr_value;
-                        }
-
-                        if (!HPX_INVOKE(f, curr_value, max_value))
-                        {
-                            max = curr;
-                            max_value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return minmax_element_result<FwdIter>{min, max};
+                return sequential_minmax_element<std::decay_t<ExPolicy>>(first,
+                    last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -843,10 +697,12 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = [f, proj, policy](FwdIter it, std::size_t part_count)
+                using policy_type = std::decay_t<ExPolicy>;
+
+                auto f1 = [f, proj](FwdIter it, std::size_t part_count)
                     -> minmax_element_result<FwdIter> {
-                    return sequential_minmax_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_minmax_element<policy_type>(
+                        it, part_count, f, proj);
                 };
 
                 auto f2 = [policy, first, f = HPX_FORWARD(F, f),
@@ -163,6 +163,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -359,6 +360,18 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // arithmetic values ordered by operator< are radix sorted
+                    if constexpr (is_radix_sortable_v<RandomIt, Comp, Proj>)
+                    {
+                        std::size_t const count = last - first;
+                        if (count >= radix_sort_limit)
+                        {
+                            return parallel_radix_sort_result(
+                                HPX_FORWARD(ExPolicy, policy), HPX_MOVE(last),
+                                first, count);
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
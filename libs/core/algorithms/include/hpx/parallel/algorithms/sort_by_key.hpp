@@ -99,9 +99,14 @@ namespace hpx { namespace experimental {
 
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
+#include <cstddef>
+#include <exception>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -154,6 +159,34 @@ namespace hpx::experimental {
         ValueIter value_last = value_first;
         std::advance(value_last, std::distance(key_first, key_last));
 
+        // arithmetic keys ordered by operator< are radix sorted
+        if constexpr (hpx::is_parallel_execution_policy_v<ExPolicy> &&
+            hpx::parallel::detail::is_radix_sortable_by_key_v<KeyIter,
+                ValueIter, Compare>)
+        {
+            using result_type = sort_by_key_result<KeyIter, ValueIter>;
+            using algorithm_result =
+                hpx::parallel::util::detail::algorithm_result<ExPolicy,
+                    result_type>;
+
+            std::size_t const count = std::distance(key_first, key_last);
+            if (count >= hpx::parallel::detail::radix_sort_limit)
+            {
+                try
+                {
+                    return hpx::parallel::detail::parallel_radix_sort_result(
+                        policy, result_type(key_last, value_last), key_first,
+                        count, value_first);
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        hpx::parallel::detail::handle_exception<ExPolicy,
+                            result_type>::call(std::current_exception()));
+                }
+            }
+        }
+
         using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
 
         return hpx::parallel::detail::get_iter_pair<iterator_type>(
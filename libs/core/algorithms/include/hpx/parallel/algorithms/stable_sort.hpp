@@ -162,6 +162,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/parallel_stable_sort.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -240,6 +241,17 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // arithmetic values ordered by operator< are radix
+                    // sorted, the radix sort is stable
+                    if constexpr (is_radix_sortable_v<RandomIt, Compare, Proj>)
+                    {
+                        if (count >= radix_sort_limit)
+                        {
+                            return parallel_radix_sort_result(policy,
+                                HPX_MOVE(last_iter), first, count);
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     compare_type comp(compare, proj);
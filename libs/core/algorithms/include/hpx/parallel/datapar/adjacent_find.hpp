@@ -11,7 +11,10 @@
 #if defined(HPX_HAVE_DATAPAR)
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
 #include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/parallel/algorithms/detail/adjacent_find.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
@@ -19,6 +22,7 @@
 #include <hpx/parallel/util/cancellation_token.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -53,19 +57,60 @@ namespace hpx::parallel::detail {
             return first;
         }
 
+        // The two iterators refer to neighboring elements, so at most one of
+        // them is ever aligned. Each vector pack is compared with the pack
+        // starting one element later, both are loaded unaligned.
         template <typename ZipIter, typename Token, typename PredProj>
         static constexpr void call(std::size_t base_idx, ZipIter part_begin,
             std::size_t part_count, Token& tok, PredProj&& pred_projected)
         {
-            util::loop_idx_n<ExPolicy>(base_idx, part_begin, part_count, tok,
-                [&pred_projected, &tok](auto&& t, std::size_t i) {
-                    using hpx::get;
-                    auto msk = pred_projected(get<0>(t), get<1>(t));
-                    int const offset =
-                        hpx::parallel::traits::find_first_of(msk);
-                    if (offset != -1)
-                        tok.cancel(i + offset);
-                });
+            if (tok.was_cancelled(base_idx))
+                return;
+
+            auto const& iters = part_begin.get_iterator_tuple();
+            auto it1 = hpx::get<0>(iters);
+            auto it2 = hpx::get<1>(iters);
+
+            using value_type =
+                typename std::iterator_traits<decltype(it1)>::value_type;
+            using V1 = traits::vector_pack_type_t<value_type, 1>;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            std::size_t i = 0;
+            for (/**/; i + size <= part_count; i += size)
+            {
+                V const v1 =
+                    traits::vector_pack_load<V, value_type>::unaligned(it1);
+                V const v2 =
+                    traits::vector_pack_load<V, value_type>::unaligned(it2);
+
+                int const offset =
+                    traits::find_first_of(pred_projected(v1, v2));
+                if (offset != -1)
+                {
+                    tok.cancel(base_idx + i + offset);
+                    return;
+                }
+
+                std::advance(it1, size);
+                std::advance(it2, size);
+            }
+
+            for (/**/; i != part_count; (void) ++i, ++it1, ++it2)
+            {
+                V1 const v1 =
+                    traits::vector_pack_load<V1, value_type>::unaligned(it1);
+                V1 const v2 =
+                    traits::vector_pack_load<V1, value_type>::unaligned(it2);
+
+                if (traits::find_first_of(pred_projected(v1, v2)) != -1)
+                {
+                    tok.cancel(base_idx + i);
+                    return;
+                }
+            }
         }
     };
 
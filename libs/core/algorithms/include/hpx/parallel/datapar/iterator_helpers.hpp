@@ -102,6 +102,26 @@ namespace hpx::parallel::util::detail {
     inline constexpr bool iterator_datapar_compatible_v =
         iterator_datapar_compatible<Iter>::value;
 
+    // The vector packs are written back to the sequence only if the iterator
+    // refers to modifiable elements.
+    template <typename Iter>
+    inline constexpr bool iterator_is_writable_v =
+        !std::is_const_v<std::remove_reference_t<
+            typename std::iterator_traits<Iter>::reference>>;
+
+    // Binary predicates are applied to whole vector packs only if they accept
+    // them, predicates restricted to the value type (like std::less<int>)
+    // have to be used by the scalar loops instead.
+    template <typename F, typename Iter>
+    struct is_invocable_with_vector_packs
+      : std::is_invocable<F&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&>
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Iter, typename Enable = void>
     struct datapar_loop_step
@@ -117,7 +137,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
             ++it;
         }
 
@@ -127,7 +150,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             std::advance(it, traits::vector_pack_size_v<V>);
         }
     };
@@ -151,7 +177,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             int const idx = HPX_INVOKE(pred, &tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
             return idx;
         }
 
@@ -163,7 +192,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             int const idx = HPX_INVOKE(pred, &tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             return idx;
         }
     };
@@ -183,7 +215,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
             ++it;
         }
 
@@ -193,7 +228,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             std::advance(it, traits::vector_pack_size_v<V>);
         }
     };
@@ -213,7 +251,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, tmp, base_idx);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
         }
 
         template <typename F>
@@ -222,7 +263,22 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, tmp, base_idx);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
+        }
+
+        template <typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static constexpr void callv_unaligned(
+            F&& f, Iter& it, std::size_t base_idx)
+        {
+            V tmp(traits::vector_pack_load<V, value_type>::unaligned(it));
+            HPX_INVOKE(f, tmp, base_idx);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::unaligned(tmp, it);
+            }
         }
     };
 
@@ -241,7 +297,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
         }
 
         template <typename F>
@@ -250,7 +309,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_is_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             return traits::vector_pack_size_v<V>;
         }
     };
@@ -370,22 +370,35 @@ namespace hpx::parallel::util {
             HPX_HOST_DEVICE HPX_FORCEINLINE static constexpr Iter call(
                 std::size_t base_idx, Iter it, std::size_t count, F&& f)
             {
-                std::size_t len = count;
+                constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                for (/* */; !detail::is_data_aligned(it) && len != 0; --len)
+                // zip iterators referring to sequences with different
+                // alignment never become aligned, those are processed using
+                // unaligned vector packs
+                std::size_t len = count;
+                for (std::size_t head = size;
+                     !detail::is_data_aligned(it) && len != 0 && head != 0;
+                     --len, --head)
                 {
                     datapar_loop_idx_step<Iter>::call1(f, it, base_idx);
                     ++it;
                     ++base_idx;
                 }
 
-                constexpr std::size_t size = traits::vector_pack_size_v<V>;
-
+                bool const aligned = detail::is_data_aligned(it);
                 for (auto len_v = static_cast<std::int64_t>(len - (size + 1));
                      len_v > 0;
                      len_v -= static_cast<std::int64_t>(size), len -= size)
                 {
-                    datapar_loop_idx_step<Iter>::callv(f, it, base_idx);
+                    if (aligned)
+                    {
+                        datapar_loop_idx_step<Iter>::callv(f, it, base_idx);
+                    }
+                    else
+                    {
+                        datapar_loop_idx_step<Iter>::callv_unaligned(
+                            f, it, base_idx);
+                    }
                     std::advance(it, size);
                     base_idx += size;
                 }
@@ -0,0 +1,427 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// make inspect happy: hpxinspect:nominmax
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized algorithms first determine the smallest and/or largest
+    // value in a single pass over the data, keeping one running value per
+    // lane of the aligned vector packs and reducing those at the end. The
+    // first element equivalent to the smallest value is then searched from
+    // the front, the last element equivalent to the largest value from the
+    // back, which keeps the results consistent with the sequential
+    // algorithms. Both searches stop at the first match.
+    template <typename ExPolicy>
+    struct datapar_minmax_element
+    {
+        template <typename FwdIter>
+        using value_type = typename std::iterator_traits<FwdIter>::value_type;
+
+        template <typename V>
+        static constexpr std::size_t pack_size =
+            traits::vector_pack_size_v<V>;
+
+        // Invoke f for the elements of [it, it + count), the scalar lanes
+        // are handed to f1 as values, the aligned packs to fv.
+        template <typename FwdIter, typename F1, typename FV>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void reduce_lanes(
+            FwdIter it, std::size_t count, F1&& f1, FV&& fv)
+        {
+            util::loop_n_ind<ExPolicy>(it, count, [&](auto const& v) {
+                using pack_type = std::decay_t<decltype(v)>;
+                if constexpr (std::is_arithmetic_v<pack_type>)
+                {
+                    HPX_INVOKE(f1, v);
+                }
+                else if constexpr (traits::is_scalar_vector_pack_v<pack_type>)
+                {
+                    HPX_INVOKE(f1, value_type<FwdIter>(traits::get(v, 0)));
+                }
+                else
+                {
+                    HPX_INVOKE(fv, v);
+                }
+            });
+        }
+
+        template <typename FwdIter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static value_type<FwdIter> min_value(
+            FwdIter it, std::size_t count, F& f)
+        {
+            using V = traits::vector_pack_type_t<value_type<FwdIter>>;
+
+            value_type<FwdIter> value = *it;
+            V packed;
+            bool has_packed = false;
+
+            reduce_lanes(
+                it, count,
+                [&](value_type<FwdIter> x) {
+                    if (HPX_INVOKE(f, x, value))
+                        value = x;
+                },
+                [&](V const& v) {
+                    packed = has_packed ?
+                        traits::choose(HPX_INVOKE(f, v, packed), v, packed) :
+                        v;
+                    has_packed = true;
+                });
+
+            if (has_packed)
+            {
+                for (std::size_t i = 0; i != pack_size<V>; ++i)
+                {
+                    value_type<FwdIter> x = traits::get(packed, i);
+                    if (HPX_INVOKE(f, x, value))
+                        value = x;
+                }
+            }
+            return value;
+        }
+
+        template <typename FwdIter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static value_type<FwdIter> max_value(
+            FwdIter it, std::size_t count, F& f)
+        {
+            using V = traits::vector_pack_type_t<value_type<FwdIter>>;
+
+            value_type<FwdIter> value = *it;
+            V packed;
+            bool has_packed = false;
+
+            reduce_lanes(
+                it, count,
+                [&](value_type<FwdIter> x) {
+                    if (HPX_INVOKE(f, value, x))
+                        value = x;
+                },
+                [&](V const& v) {
+                    packed = has_packed ?
+                        traits::choose(HPX_INVOKE(f, packed, v), v, packed) :
+                        v;
+                    has_packed = true;
+                });
+
+            if (has_packed)
+            {
+                for (std::size_t i = 0; i != pack_size<V>; ++i)
+                {
+                    value_type<FwdIter> x = traits::get(packed, i);
+                    if (HPX_INVOKE(f, value, x))
+                        value = x;
+                }
+            }
+            return value;
+        }
+
+        template <typename FwdIter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static std::pair<value_type<FwdIter>,
+            value_type<FwdIter>>
+        minmax_value(FwdIter it, std::size_t count, F& f)
+        {
+            using V = traits::vector_pack_type_t<value_type<FwdIter>>;
+
+            value_type<FwdIter> min = *it;
+            value_type<FwdIter> max = min;
+            V min_packed;
+            V max_packed;
+            bool has_packed = false;
+
+            reduce_lanes(
+                it, count,
+                [&](value_type<FwdIter> x) {
+                    if (HPX_INVOKE(f, x, min))
+                        min = x;
+                    if (HPX_INVOKE(f, max, x))
+                        max = x;
+                },
+                [&](V const& v) {
+                    if (has_packed)
+                    {
+                        min_packed = traits::choose(
+                            HPX_INVOKE(f, v, min_packed), v, min_packed);
+                        max_packed = traits::choose(
+                            HPX_INVOKE(f, max_packed, v), v, max_packed);
+                    }
+                    else
+                    {
+                        min_packed = v;
+                        max_packed = v;
+                        has_packed = true;
+                    }
+                });
+
+            if (has_packed)
+            {
+                for (std::size_t i = 0; i != pack_size<V>; ++i)
+                {
+                    value_type<FwdIter> x = traits::get(min_packed, i);
+                    if (HPX_INVOKE(f, x, min))
+                        min = x;
+
+                    x = traits::get(max_packed, i);
+                    if (HPX_INVOKE(f, max, x))
+                        max = x;
+                }
+            }
+            return {min, max};
+        }
+
+        // Find the first element that is not larger than the given
+        // (smallest) value.
+        template <typename FwdIter, typename T, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static FwdIter find_min(
+            FwdIter it, std::size_t count, T const& value, F& f)
+        {
+            return util::loop_pred<ExPolicy>(
+                it, std::next(it, count), [&](auto const& curr) {
+                    using pack_type = std::decay_t<decltype(*curr)>;
+                    auto msk = !HPX_INVOKE(f, pack_type(value), *curr);
+                    return traits::find_first_of(msk);
+                });
+        }
+
+        // Find the last element that is not smaller than the given
+        // (largest) value, walking backwards over the sequence one
+        // (unaligned) vector pack at a time. The pack holding the element is
+        // searched lane by lane.
+        template <typename FwdIter, typename T, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static FwdIter find_max(
+            FwdIter it, std::size_t count, T const& value, F& f)
+        {
+            using V = traits::vector_pack_type_t<value_type<FwdIter>>;
+
+            std::size_t lanes = 0;
+            while (count >= pack_size<V>)
+            {
+                count -= pack_size<V>;
+
+                V const v = traits::vector_pack_load<V,
+                    value_type<FwdIter>>::unaligned(std::next(it, count));
+                if (traits::any_of(!HPX_INVOKE(f, v, V(value))))
+                {
+                    lanes = pack_size<V>;
+                    break;
+                }
+            }
+
+            // search the pack holding the element, or the remaining elements
+            // at the front of the sequence
+            FwdIter curr = std::next(it, count + lanes);
+            while (curr != it)
+            {
+                if (!HPX_INVOKE(f, *--curr, value))
+                    break;
+            }
+            return curr;
+        }
+
+        template <typename FwdIter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static FwdIter min_element(
+            FwdIter it, std::size_t count, F&& f)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            auto const value = min_value(it, count, f);
+            return find_min(it, count, value, f);
+        }
+
+        template <typename FwdIter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static FwdIter max_element(
+            FwdIter it, std::size_t count, F&& f)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            auto const value = max_value(it, count, f);
+            return find_max(it, count, value, f);
+        }
+
+        template <typename FwdIter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static util::min_max_result<FwdIter>
+        minmax_element(FwdIter it, std::size_t count, F&& f)
+        {
+            if (count == 0 || count == 1)
+                return {it, it};
+
+            auto const values = minmax_value(it, count, f);
+            return {find_min(it, count, values.first, f),
+                find_max(it, count, values.second, f)};
+        }
+    };
+
+    // Only ranges of arithmetic values that are compared directly are
+    // vectorized, the comparison function has to accept vector packs.
+    template <typename FwdIter, typename F, typename Proj>
+    inline constexpr bool minmax_datapar_compatible_v = std::conjunction_v<
+        hpx::parallel::util::detail::iterator_datapar_compatible<FwdIter>,
+        std::is_same<std::decay_t<Proj>, hpx::identity>,
+        hpx::parallel::util::detail::is_invocable_with_vector_packs<F,
+            FwdIter>>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_min_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F&& f, Proj&& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax_element<ExPolicy>::min_element(
+                it, count, HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_min_element<base_policy_type>(
+                it, count, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_min_element_t<ExPolicy>, FwdIter first, Sent last, F&& f,
+        Proj&& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax_element<ExPolicy>::min_element(
+                first, detail::distance(first, last), HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_min_element<base_policy_type>(
+                first, last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_max_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F&& f, Proj&& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax_element<ExPolicy>::max_element(
+                it, count, HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_max_element<base_policy_type>(
+                it, count, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_max_element_t<ExPolicy>, FwdIter first, Sent last, F&& f,
+        Proj&& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax_element<ExPolicy>::max_element(
+                first, detail::distance(first, last), HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_max_element<base_policy_type>(
+                first, last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<FwdIter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F&& f, Proj&& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax_element<ExPolicy>::minmax_element(
+                it, count, HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_minmax_element<base_policy_type>(
+                it, count, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<FwdIter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, FwdIter first, Sent last, F&& f,
+        Proj&& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax_element<ExPolicy>::minmax_element(
+                first, detail::distance(first, last), HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_minmax_element<base_policy_type>(
+                first, last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
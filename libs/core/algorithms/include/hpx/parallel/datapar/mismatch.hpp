@@ -11,7 +11,9 @@
 #if defined(HPX_HAVE_DATAPAR)
 #include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
 #include <hpx/functional/tag_invoke.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
@@ -22,8 +24,10 @@
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
+#include <hpx/type_support/detected.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -117,6 +121,50 @@ namespace hpx { namespace parallel { namespace detail {
     }
 
     /////////////////////////////////////////////////////////////////////////
+    // The predicate is applied to whole (projected) vector packs only if it
+    // accepts them, predicates restricted to the value type (like
+    // std::less<int>) have to be used by the scalar loops instead.
+    template <typename F, typename Proj1, typename Proj2, typename T1,
+        typename T2>
+    using invoke_projected_t = decltype(hpx::invoke(std::declval<F&>(),
+        hpx::invoke(std::declval<Proj1&>(), std::declval<T1 const&>()),
+        hpx::invoke(std::declval<Proj2&>(), std::declval<T2 const&>())));
+
+    template <typename F, typename Proj1, typename Proj2, typename Iter1,
+        typename Iter2>
+    struct is_invocable_with_projected_vector_packs
+      : hpx::util::is_detected<invoke_projected_t, F, Proj1, Proj2,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter1>::value_type>,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter2>::value_type>>
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    inline constexpr bool mismatch_binary_datapar_compatible_v =
+        std::conjunction_v<
+            hpx::parallel::util::detail::iterator_datapar_compatible<Iter1>,
+            hpx::parallel::util::detail::iterator_datapar_compatible<Iter2>,
+            is_invocable_with_projected_vector_packs<F, Proj1, Proj2, Iter1,
+                Iter2>>;
+
+    template <typename ZipIterator, typename F, typename Proj1,
+        typename Proj2>
+    struct zip_mismatch_binary_datapar_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    struct zip_mismatch_binary_datapar_compatible<
+        hpx::util::zip_iterator<Iter1, Iter2>, F, Proj1, Proj2>
+      : std::bool_constant<
+            mismatch_binary_datapar_compatible_v<Iter1, Iter2, F, Proj1, Proj2>>
+    {
+    };
+
     template <typename ExPolicy>
     struct datapar_mismatch_binary
     {
@@ -177,7 +225,10 @@ namespace hpx { namespace parallel { namespace detail {
         Proj1&& proj1, Proj2&& proj2)
     {
         if constexpr (hpx::parallel::util::detail::iterator_datapar_compatible<
-                          ZipIterator>::value)
+                          ZipIterator>::value &&
+            zip_mismatch_binary_datapar_compatible<ZipIterator,
+                std::decay_t<F>, std::decay_t<Proj1>,
+                std::decay_t<Proj2>>::value)
         {
             return datapar_mismatch_binary<ExPolicy>::call1(base_idx, it,
                 part_count, tok, HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
@@ -201,10 +252,9 @@ namespace hpx { namespace parallel { namespace detail {
         sequential_mismatch_binary_t<ExPolicy>, Iter1 first1, Sent1 last1,
         Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
     {
-        if constexpr (hpx::parallel::util::detail::iterator_datapar_compatible<
-                          Iter1>::value &&
-            hpx::parallel::util::detail::iterator_datapar_compatible<
-                Iter2>::value)
+        if constexpr (mismatch_binary_datapar_compatible_v<Iter1, Iter2,
+                          std::decay_t<F>, std::decay_t<Proj1>,
+                          std::decay_t<Proj2>>)
         {
             return datapar_mismatch_binary<ExPolicy>::call2(first1, last1,
                 first2, last2, HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
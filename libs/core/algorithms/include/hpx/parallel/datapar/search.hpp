@@ -0,0 +1,103 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/search.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The first element of the needle is compared with a full vector pack of
+    // candidate positions at once, only the positions it matches are
+    // compared with the rest of the needle.
+    template <typename ExPolicy>
+    struct datapar_search
+    {
+        template <typename FwdIter, typename Token, typename FwdIter2,
+            typename Pred>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void call(std::size_t base_idx,
+            FwdIter it, std::size_t part_size, Token& tok, FwdIter2 s_first,
+            std::size_t diff, Pred&& op)
+        {
+            hpx::identity proj;
+            util::loop_idx_n<ExPolicy>(base_idx, it, part_size, tok,
+                [&](auto const& v, std::size_t i) -> void {
+                    using pack_type = std::decay_t<decltype(v)>;
+                    if (!traits::any_of(HPX_INVOKE(op, v, pack_type(*s_first))))
+                        return;
+
+                    FwdIter curr = std::next(it, i - base_idx);
+                    for (std::size_t lane = 0;
+                         lane != traits::vector_pack_size_v<pack_type>;
+                         ++lane, ++curr)
+                    {
+                        if (search_matches(curr, s_first, diff, op, proj, proj))
+                        {
+                            tok.cancel(i + lane);
+                            break;
+                        }
+                    }
+                });
+        }
+    };
+
+    // Only needles of the same arithmetic type as the searched range that
+    // are compared directly are vectorized, the predicate has to accept
+    // vector packs.
+    template <typename FwdIter, typename FwdIter2, typename Pred,
+        typename Proj1, typename Proj2>
+    inline constexpr bool search_datapar_compatible_v = std::conjunction_v<
+        hpx::parallel::util::detail::iterator_datapar_compatible<FwdIter>,
+        std::is_same<typename std::iterator_traits<FwdIter>::value_type,
+            typename std::iterator_traits<FwdIter2>::value_type>,
+        std::is_same<std::decay_t<Proj1>, hpx::identity>,
+        std::is_same<std::decay_t<Proj2>, hpx::identity>,
+        hpx::parallel::util::detail::is_invocable_with_vector_packs<Pred,
+            FwdIter>>;
+
+    template <typename ExPolicy, typename FwdIter, typename Token,
+        typename FwdIter2, typename Pred, typename Proj1, typename Proj2,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void tag_invoke(
+        sequential_search_partition_t<ExPolicy>, std::size_t base_idx,
+        FwdIter it, std::size_t part_size, Token& tok, FwdIter2 s_first,
+        std::size_t diff, Pred&& op, Proj1&& proj1, Proj2&& proj2)
+    {
+        if constexpr (search_datapar_compatible_v<FwdIter, FwdIter2, Pred,
+                          Proj1, Proj2>)
+        {
+            return datapar_search<ExPolicy>::call(base_idx, it, part_size, tok,
+                s_first, diff, HPX_FORWARD(Pred, op));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_search_partition<base_policy_type>(base_idx, it,
+                part_size, tok, s_first, diff, HPX_FORWARD(Pred, op),
+                HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
@@ -107,16 +107,36 @@ namespace hpx::parallel::traits {
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
+        // elements referred to by read-only iterators are not written back
+        template <typename V, typename Iter>
+        constexpr void aligned_store(V& value, Iter const& iter)
+        {
+            if constexpr (util::detail::iterator_is_writable_v<Iter>)
+            {
+                vector_pack_store<V,
+                    typename std::iterator_traits<Iter>::value_type>::
+                    aligned(value, iter);
+            }
+        }
+
+        template <typename V, typename Iter>
+        constexpr void unaligned_store(V& value, Iter const& iter)
+        {
+            if constexpr (util::detail::iterator_is_writable_v<Iter>)
+            {
+                vector_pack_store<V,
+                    typename std::iterator_traits<Iter>::value_type>::
+                    unaligned(value, iter);
+            }
+        }
+
         template <typename Tuple, typename... Iter, std::size_t... Is>
         constexpr void aligned_pack(Tuple& value,
             hpx::util::zip_iterator<Iter...> const& iter,
             hpx::util::index_pack<Is...>)
         {
             auto const& t = iter.get_iterator_tuple();
-            (vector_pack_store<typename hpx::tuple_element<Is, Tuple>::type,
-                 typename std::iterator_traits<Iter>::value_type>::
-                    aligned(hpx::get<Is>(value), hpx::get<Is>(t)),
-                ...);
+            (aligned_store(hpx::get<Is>(value), hpx::get<Is>(t)), ...);
         }
 
         template <typename Tuple, typename... Iter, std::size_t... Is>
@@ -125,10 +145,7 @@ namespace hpx::parallel::traits {
             hpx::util::index_pack<Is...>)
         {
             auto const& t = iter.get_iterator_tuple();
-            (vector_pack_store<typename hpx::tuple_element<Is, Tuple>::type,
-                 typename std::iterator_traits<Iter>::value_type>::
-                    unaligned(hpx::get<Is>(value), hpx::get<Is>(t)),
-                ...);
+            (unaligned_store(hpx::get<Is>(value), hpx::get<Is>(t)), ...);
         }
     }    // namespace detail
 
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/properties/property.hpp>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A rectangular part [first, last) of a multi-dimensional index space.
+    template <std::size_t Rank>
+    struct md_tile
+    {
+        std::array<std::size_t, Rank> first;
+        std::array<std::size_t, Rank> last;
+
+        [[nodiscard]] constexpr std::size_t extent(std::size_t dim) const
+        {
+            return last[dim] - first[dim];
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            std::size_t result = 1;
+            for (std::size_t dim = 0; dim != Rank; ++dim)
+            {
+                result *= last[dim] - first[dim];
+            }
+            return result;
+        }
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Recursively bisects the given tile along its largest extent until
+        // none of the resulting tiles holds more than max_size elements. The
+        // tiles stay close to square (or cubic) and are generated in the
+        // order of the recursion, i.e. neighboring tiles are close in memory
+        // on every level of the cache hierarchy without having to know its
+        // sizes.
+        template <std::size_t Rank>
+        void split_md_tile(md_tile<Rank> const& tile, std::size_t max_size,
+            std::vector<md_tile<Rank>>& tiles)
+        {
+            std::size_t dim = 0;
+            for (std::size_t d = 1; d != Rank; ++d)
+            {
+                if (tile.extent(d) > tile.extent(dim))
+                    dim = d;
+            }
+
+            if (tile.size() <= max_size || tile.extent(dim) < 2)
+            {
+                tiles.push_back(tile);
+                return;
+            }
+
+            std::size_t const mid = tile.first[dim] + tile.extent(dim) / 2;
+
+            md_tile<Rank> lower = tile;
+            lower.last[dim] = mid;
+            split_md_tile(lower, max_size, tiles);
+
+            md_tile<Rank> upper = tile;
+            upper.first[dim] = mid;
+            split_md_tile(upper, max_size, tiles);
+        }
+
+        // The multi-dimensional equivalent of get_bulk_iteration_shape: the
+        // executor parameters determine the number of elements per chunk,
+        // the index space is then split into tiles of (at most) that size.
+        template <typename ExPolicy, std::size_t Rank>
+        std::vector<md_tile<Rank>> get_md_iteration_shape(
+            ExPolicy& policy, std::array<std::size_t, Rank> const& extents)
+        {
+            md_tile<Rank> const all{{}, extents};
+            std::size_t const count = all.size();
+
+            std::vector<md_tile<Rank>> tiles;
+            if (count == 0)
+            {
+                return tiles;
+            }
+
+            std::size_t const cores =
+                execution::processing_units_count(policy.parameters(),
+                    policy.executor(), hpx::chrono::null_duration, count);
+
+            std::size_t max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, cores, count);
+
+            // make sure, chunk size and max_chunks are consistent
+            adjust_chunk_size_and_max_chunks(
+                cores, count, max_chunks, chunk_size);
+
+            // update executor with new values
+            policy = hpx::experimental::prefer(
+                execution::with_processing_units_count, policy, cores);
+
+            // bisection creates tiles of at least half the chunk size
+            tiles.reserve(2 * max_chunks);
+            split_md_tile(all, chunk_size, tiles);
+
+            return tiles;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The md_partitioner splits a multi-dimensional index space into tiles
+    // and invokes f1 once for each of the tiles, every tile is run as a
+    // separate task. The results of the tiles are passed to f2 in the order
+    // the tiles were generated.
+    //
+    // ExPolicy: execution policy
+    // R:        overall result type
+    // Result:   intermediate result type of first step
+    template <typename ExPolicy, typename R = void, typename Result = R>
+    struct md_partitioner
+    {
+        template <typename ExPolicy_, std::size_t Rank, typename F1,
+            typename F2>
+        static decltype(auto) call(ExPolicy_&& policy,
+            std::array<std::size_t, Rank> const& extents, F1&& f1, F2&& f2)
+        {
+            std::decay_t<ExPolicy_> p = HPX_FORWARD(ExPolicy_, policy);
+
+            std::vector<md_tile<Rank>> tiles =
+                detail::get_md_iteration_shape(p, extents);
+            std::size_t const count = tiles.size();
+            std::vector<std::size_t> const chunk_sizes(count, 1);
+
+            using iterator = hpx::util::counting_iterator<std::size_t>;
+            return partitioner<ExPolicy, R, Result>::call_with_data(HPX_MOVE(p),
+                iterator(0), count,
+                [f = HPX_FORWARD(F1, f1)](md_tile<Rank> const& tile, iterator,
+                    [[maybe_unused]] std::size_t size) mutable -> Result {
+                    HPX_ASSERT(size == 1);
+                    return HPX_INVOKE(f, tile);
+                },
+                HPX_FORWARD(F2, f2), chunk_sizes, HPX_MOVE(tiles));
+        }
+    };
+}    // namespace hpx::parallel::util
@@ -12,8 +12,10 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution/execution.hpp>
 #include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -25,8 +27,10 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <type_traits>
 #include <utility>
@@ -37,13 +41,48 @@ namespace hpx::parallel::util {
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+
+        // The partitions are split into tiles of roughly this size (in
+        // bytes), small enough for the input and output of a tile to stay in
+        // the cache between the first and the third step.
+        inline constexpr std::size_t scan_tile_size = 128 * 1024;
+
+        // The look-back state of a tile: the reduction of the tile itself
+        // is published as soon as the first step is done, the inclusive
+        // prefix (the reduction of all tiles up to and including this one)
+        // once the tile knows its exclusive prefix.
+        template <typename Result>
+        struct scan_tile_state
+        {
+            enum status : int
+            {
+                invalid = 0,
+                aggregate_available = 1,
+                prefix_available = 2
+            };
+
+            std::atomic<int> state{invalid};
+            Result aggregate{};
+            Result prefix{};
+        };
+
         ///////////////////////////////////////////////////////////////////////
-        // The static partitioner simply spawns one chunk of iterations for
-        // each available core.
+        // The static partitioner runs a single pass chained scan with
+        // decoupled look-back. The partitions are split into tiles which
+        // are claimed in order by one task per available core. Each task
+        // reduces its tile (step 1), publishes the result, and determines
+        // the prefix of the tile by walking backwards over the results of
+        // its predecessors until it finds a tile that knows its inclusive
+        // prefix (step 2). The third step is run right away, while the data
+        // of the tile is still in the cache. As tiles are claimed in order,
+        // the look-back waits for tiles that are being worked on only.
         template <typename ExPolicy, typename R, typename Result1,
             typename Result2>
         struct scan_static_partitioner
         {
+            static_assert(std::is_void_v<Result2>,
+                "the third step of the scan must not return a value");
+
             using parameters_type = typename ExPolicy::executor_parameters_type;
             using executor_type = typename ExPolicy::executor_type;
 
@@ -71,15 +110,20 @@ namespace hpx::parallel::util {
                     policy.parameters(), policy.executor());
 
                 std::vector<hpx::shared_future<Result1>> workitems;
-                std::vector<hpx::future<Result2>> finalitems;
-                std::vector<Result1> f2results;
+                std::vector<hpx::future<void>> finalitems;
+                std::vector<Result1> prefixes;
                 std::list<std::exception_ptr> errors;
+
+                // shared between the tasks, those are waited for in reduce
+                std::vector<hpx::tuple<FwdIter, std::size_t>> tiles;
+                std::vector<scan_tile_state<Result1>> states;
+                std::atomic<std::size_t> next_tile(0);
+                std::atomic<bool> cancelled(false);
+                Result1 prefix = init;
+                Result1* tile_prefixes = nullptr;
+
                 try
                 {
-                    // pre-initialize first intermediate result
-                    workitems.push_back(
-                        make_ready_future(HPX_FORWARD(T, init)));
-
                     HPX_ASSERT(count > 0);
                     FwdIter first_ = first;
                     std::size_t const count_ = count;
@@ -93,85 +137,181 @@ namespace hpx::parallel::util {
                         has_variable_chunk_size(), policy, workitems, f1, first,
                         count, 1);
 
-                    // schedule every chunk on a separate thread
-                    std::size_t size = hpx::util::size(shape);
-
                     // If the size of count was enough to warrant testing for a
-                    // chunk, pre-initialize second intermediate result and
-                    // start f3.
-                    if (workitems.size() == 2)
+                    // chunk, f1 was run on the first elements already.
+                    if (!workitems.empty())
                     {
                         HPX_ASSERT(count_ > count);
 
-                        workitems.reserve(size + 2);
-                        finalitems.reserve(size + 1);
-
                         finalitems.push_back(
                             execution::async_execute(policy.executor(), f3,
-                                first_, count_ - count, workitems[0].get()));
+                                first_, count_ - count, init));
 
-                        workitems[1] = make_ready_future(HPX_INVOKE(
-                            f2, workitems[0].get(), workitems[1].get()));
-                    }
-                    else
-                    {
-                        workitems.reserve(size + 1);
-                        finalitems.reserve(size);
+                        prefixes.push_back(init);
+                        prefix = HPX_INVOKE(f2, prefix, workitems[0].get());
                     }
 
-                    // Schedule first step of scan algorithm, step 2 is
-                    // performed when all f1 tasks are done
+                    // split the partitions into tiles
+                    std::size_t const tile_size = (std::max)(
+                        scan_tile_size /
+                            sizeof(typename std::iterator_traits<
+                                FwdIter>::value_type),
+                        static_cast<std::size_t>(1));
+
+                    tiles.reserve(hpx::util::size(shape) +
+                        (count + tile_size - 1) / tile_size);
                     for (auto const& elem : shape)
                     {
-                        auto curr = execution::async_execute(policy.executor(),
-                            f1, hpx::get<0>(elem), hpx::get<1>(elem))
-                                        .share();
-
-                        workitems.push_back(HPX_MOVE(curr));
+                        FwdIter it = hpx::get<0>(elem);
+                        std::size_t size = hpx::get<1>(elem);
+                        while (size > tile_size)
+                        {
+                            tiles.emplace_back(it, tile_size);
+                            std::advance(it, tile_size);
+                            size -= tile_size;
+                        }
+                        tiles.emplace_back(it, size);
                     }
 
-                    // Wait for all f1 tasks to finish
-                    if (hpx::wait_all_nothrow(workitems))
-                    {
-                        handle_local_exceptions::call(workitems, errors);
-                    }
+                    std::size_t const num_tiles = tiles.size();
+                    states = std::vector<scan_tile_state<Result1>>(num_tiles);
+                    prefixes.resize(prefixes.size() + num_tiles + 1);
+                    tile_prefixes = &prefixes[prefixes.size() - num_tiles - 1];
 
-                    // perform f2 sequentially in one go
-                    f2results.resize(workitems.size());
-                    auto result = workitems[0].get();
-                    f2results[0] = result;
-                    for (std::size_t i = 1; i < workitems.size(); i++)
-                    {
-                        result = HPX_INVOKE(f2, result, workitems[i].get());
-                        f2results[i] = result;
-                    }
+                    auto scan_tiles = [&, num_tiles]() -> void {
+                        try
+                        {
+                            for (std::size_t t = next_tile++; t < num_tiles;
+                                t = next_tile++)
+                            {
+                                if (!scan_tile(t, tiles[t], states.data(),
+                                        prefix, cancelled, f1, f2, f3,
+                                        tile_prefixes[t]))
+                                {
+                                    break;
+                                }
+                            }
+                        }
+                        catch (...)
+                        {
+                            // release the tasks waiting for this tile
+                            cancelled.store(true, std::memory_order_release);
+                            throw;
+                        }
+                    };
 
-                    // start all f3 tasks
-                    std::size_t i = 0;
-                    for (auto const& elem : shape)
+                    std::size_t const cores =
+                        execution::processing_units_count(policy.parameters(),
+                            policy.executor(), hpx::chrono::null_duration,
+                            count);
+                    std::size_t const num_tasks = (std::min)(num_tiles,
+                        (std::max)(cores, static_cast<std::size_t>(1)));
+
+                    finalitems.reserve(finalitems.size() + num_tasks);
+                    for (std::size_t i = 0; i != num_tasks; ++i)
                     {
                         finalitems.push_back(execution::async_execute(
-                            policy.executor(), f3, hpx::get<0>(elem),
-                            hpx::get<1>(elem), f2results[i]));
-                        i++;
+                            policy.executor(), scan_tiles));
                     }
 
                     scoped_params.mark_end_of_scheduling();
+
+                    // the overall result is known once all tiles are done,
+                    // errors are reported by reduce
+                    if (!hpx::wait_all_nothrow(finalitems))
+                    {
+                        prefixes.back() = num_tiles == 0 ?
+                            prefix :
+                            states[num_tiles - 1].prefix;
+                    }
                 }
                 catch (...)
                 {
                     handle_local_exceptions::call(
                         std::current_exception(), errors);
                 }
-                return reduce(HPX_MOVE(f2results), HPX_MOVE(finalitems),
+                return reduce(HPX_MOVE(prefixes), HPX_MOVE(finalitems),
                     HPX_MOVE(errors), HPX_FORWARD(F4, f4));
 #endif
             }
 
         private:
+            // Run all steps of the scan on the given tile, returns false if
+            // the scan was cancelled because another tile failed.
+            template <typename Tile, typename F1, typename F2, typename F3>
+            static bool scan_tile(std::size_t t, Tile const& tile,
+                scan_tile_state<Result1>* states, Result1 const& init,
+                std::atomic<bool> const& cancelled, F1& f1, F2& f2, F3& f3,
+                Result1& tile_prefix)
+            {
+                using state_type = scan_tile_state<Result1>;
+
+                // step 1 reduces the tile, f1 and f3 are copied for each
+                // invocation as they may modify their state
+                auto first = hpx::get<0>(tile);
+                std::size_t const size = hpx::get<1>(tile);
+
+                std::decay_t<F1> f1_ = f1;
+                Result1 aggregate = HPX_INVOKE(f1_, first, size);
+
+                // step 2 determines the prefix of the tile
+                state_type& state = states[t];
+                if (t == 0)
+                {
+                    tile_prefix = init;
+                }
+                else
+                {
+                    state.aggregate = aggregate;
+                    state.state.store(state_type::aggregate_available,
+                        std::memory_order_release);
+
+                    bool has_value = false;
+                    Result1 value{};
+                    for (std::size_t i = t; i != 0; --i)
+                    {
+                        state_type const& pred = states[i - 1];
+
+                        int status = state_type::invalid;
+                        hpx::util::yield_while([&]() {
+                            status = pred.state.load(std::memory_order_acquire);
+                            return status == state_type::invalid &&
+                                !cancelled.load(std::memory_order_relaxed);
+                        });
+
+                        if (status == state_type::invalid)
+                        {
+                            return false;
+                        }
+
+                        if (status == state_type::prefix_available)
+                        {
+                            tile_prefix = has_value ?
+                                HPX_INVOKE(f2, pred.prefix, value) :
+                                pred.prefix;
+                            break;
+                        }
+
+                        value = has_value ?
+                            HPX_INVOKE(f2, pred.aggregate, value) :
+                            pred.aggregate;
+                        has_value = true;
+                    }
+                }
+
+                state.prefix = HPX_INVOKE(f2, tile_prefix, aggregate);
+                state.state.store(
+                    state_type::prefix_available, std::memory_order_release);
+
+                // step 3 runs the final accumulation on the tile
+                std::decay_t<F3> f3_ = f3;
+                HPX_INVOKE(f3_, first, size, tile_prefix);
+                return true;
+            }
+
             template <typename F>
             static R reduce([[maybe_unused]] std::vector<Result1>&& workitems,
-                [[maybe_unused]] std::vector<hpx::future<Result2>>&& finalitems,
+                [[maybe_unused]] std::vector<hpx::future<void>>&& finalitems,
                 [[maybe_unused]] std::list<std::exception_ptr>&& errors,
                 [[maybe_unused]] F&& f)
             {
@@ -0,0 +1,218 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// make inspect happy: hpxinspect:nominmax
+
+// Compare the vectorized implementations of the searching and counting
+// algorithms (simd, par_simd) with their scalar counterparts (seq, par). The
+// inputs are chosen such that all algorithms have to look at (almost) all
+// elements. The number of elements grows by a factor of ten from --min_size
+// to --max_size.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+int test_count = 3;
+
+// keeps the results of the algorithms alive
+std::atomic<std::size_t> sink(0);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> data(size);
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 1000);
+    std::generate(
+        data.begin(), data.end(), [&]() { return static_cast<T>(dist(gen)); });
+    return data;
+}
+
+template <typename F>
+double run_benchmark(F&& f)
+{
+    std::uint64_t elapsed = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        sink += f();
+        elapsed += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return (elapsed * 1e-9) / test_count;
+}
+
+template <typename F>
+void run_benchmark(std::string const& name, std::string const& type_name,
+    std::size_t size, F&& f)
+{
+    using namespace hpx::execution;
+
+    double const time_seq = run_benchmark([&]() { return f(seq); });
+    double const time_simd = run_benchmark([&]() { return f(simd); });
+    double const time_par = run_benchmark([&]() { return f(par); });
+    double const time_par_simd = run_benchmark([&]() { return f(par_simd); });
+
+    hpx::util::format_to(std::cout, "{},{},{},{},{},{},{}\n", name, type_name,
+        size, time_seq, time_simd, time_par, time_par_simd)
+        << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_benchmarks(std::string const& type_name, std::size_t size)
+{
+    std::vector<T> const data = make_data<T>(size);
+    auto const first = data.begin();
+    auto const last = data.end();
+
+    auto distance = [first](auto it) {
+        return static_cast<std::size_t>(std::distance(first, it));
+    };
+
+    run_benchmark("count", type_name, size, [&](auto policy) {
+        return static_cast<std::size_t>(hpx::count(policy, first, last, T(1)));
+    });
+
+    run_benchmark("count_if", type_name, size, [&](auto policy) {
+        return static_cast<std::size_t>(hpx::count_if(
+            policy, first, last, [](auto const& v) { return v < T(500); }));
+    });
+
+    run_benchmark("min_element", type_name, size, [&](auto policy) {
+        return distance(hpx::min_element(policy, first, last));
+    });
+
+    run_benchmark("max_element", type_name, size, [&](auto policy) {
+        return distance(hpx::max_element(policy, first, last));
+    });
+
+    run_benchmark("minmax_element", type_name, size, [&](auto policy) {
+        auto result = hpx::minmax_element(policy, first, last);
+        return distance(result.min) + distance(result.max);
+    });
+
+    // the sequences differ in their last element only
+    std::vector<T> other = data;
+    other.back() = static_cast<T>(other.back() + 1);
+
+    run_benchmark("lexicographical_compare", type_name, size,
+        [&](auto policy) {
+            return static_cast<std::size_t>(hpx::lexicographical_compare(
+                policy, first, last, other.begin(), other.end()));
+        });
+
+    // the needle is found at the very end of the sequence only
+    std::vector<T> const needle = {T(1001), T(1002), T(1003)};
+    std::vector<T> haystack = data;
+    std::copy(needle.begin(), needle.end(), std::prev(haystack.end(), 3));
+
+    run_benchmark("search", type_name, size, [&](auto policy) {
+        return static_cast<std::size_t>(std::distance(haystack.begin(),
+            hpx::search(policy, haystack.begin(), haystack.end(),
+                needle.begin(), needle.end())));
+    });
+
+    // no two adjacent elements are equal
+    std::vector<T> increasing(size);
+    std::iota(increasing.begin(), increasing.end(), T(0));
+
+    run_benchmark("adjacent_find", type_name, size, [&](auto policy) {
+        return static_cast<std::size_t>(std::distance(increasing.begin(),
+            hpx::adjacent_find(
+                policy, increasing.begin(), increasing.end())));
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const min_size = vm["min_size"].as<std::size_t>();
+    std::size_t const max_size = vm["max_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    if (min_size < 3 || test_count <= 0)
+    {
+        std::cerr << "min_size must be larger than two and test_count must be "
+                     "larger than zero"
+                  << std::endl;
+        return hpx::local::finalize();
+    }
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "min_size     : " << min_size << std::endl;
+    std::cout << "max_size     : " << max_size << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << hpx::get_os_thread_count() << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::cout << "algorithm,type,size,seq [s],simd [s],par [s],par_simd [s]\n";
+    for (std::size_t size = min_size; size <= max_size; size *= 10)
+    {
+        run_benchmarks<std::int32_t>("int32", size);
+        run_benchmarks<float>("float", size);
+        run_benchmarks<double>("double", size);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min_size", value<std::size_t>()->default_value(10000),
+         "smallest number of elements to process (default: 10000)")
+        ("max_size", value<std::size_t>()->default_value(10000000),
+         "largest number of elements to process (default: 10000000)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,186 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the radix sort used by hpx::sort and hpx::stable_sort for
+// arithmetic values with the comparison based implementations (selected by
+// passing a custom comparison function) and std::sort. The number of elements
+// grows by a factor of ten from --min_size to --max_size.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+int test_count = 3;
+
+// prevents the sort algorithms from using the radix sort
+struct compare_less
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> data(size);
+
+    std::mt19937_64 gen(seed);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e9), T(1e9));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist;
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    return data;
+}
+
+template <typename T, typename Sort>
+double run_sort_benchmark(
+    std::vector<T> const& data, std::vector<T>& work, Sort&& sort)
+{
+    std::uint64_t elapsed = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::copy(hpx::execution::par, data.begin(), data.end(), work.begin());
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        sort(work.begin(), work.end());
+        elapsed += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return (elapsed * 1e-9) / test_count;
+}
+
+template <typename T>
+void run_benchmark(std::string const& type_name, std::size_t size)
+{
+    std::vector<T> const data = make_data<T>(size);
+    std::vector<T> work(size);
+
+    using namespace hpx::execution;
+    using iterator = typename std::vector<T>::iterator;
+
+    double const time_std = run_sort_benchmark(data, work,
+        [](iterator first, iterator last) { std::sort(first, last); });
+
+    double const time_radix =
+        run_sort_benchmark(data, work, [](iterator first, iterator last) {
+            hpx::sort(par, first, last);
+        });
+
+    double const time_compare =
+        run_sort_benchmark(data, work, [](iterator first, iterator last) {
+            hpx::sort(par, first, last, compare_less());
+        });
+
+    double const time_stable_radix =
+        run_sort_benchmark(data, work, [](iterator first, iterator last) {
+            hpx::stable_sort(par, first, last);
+        });
+
+    double const time_stable_compare =
+        run_sort_benchmark(data, work, [](iterator first, iterator last) {
+            hpx::stable_sort(par, first, last, compare_less());
+        });
+
+    hpx::util::format_to(std::cout, "{},{},{},{},{},{},{}\n", type_name, size,
+        time_std, time_radix, time_compare, time_stable_radix,
+        time_stable_compare)
+        << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const min_size = vm["min_size"].as<std::size_t>();
+    std::size_t const max_size = vm["max_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    if (min_size == 0 || test_count <= 0)
+    {
+        std::cerr << "min_size and test_count must be larger than zero"
+                  << std::endl;
+        return hpx::local::finalize();
+    }
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "min_size     : " << min_size << std::endl;
+    std::cout << "max_size     : " << max_size << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << hpx::get_os_thread_count() << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::cout << "type,size,std::sort [s],sort radix [s],sort compare [s],"
+                 "stable_sort radix [s],stable_sort compare [s]\n";
+    for (std::size_t size = min_size; size <= max_size; size *= 10)
+    {
+        run_benchmark<std::uint32_t>("uint32", size);
+        run_benchmark<std::uint64_t>("uint64", size);
+        run_benchmark<double>("double", size);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min_size", value<std::size_t>()->default_value(1000000),
+         "smallest number of elements to sort (default: 1000000)")
+        ("max_size", value<std::size_t>()->default_value(100000000),
+         "largest number of elements to sort, use 1000000000 to measure "
+         "up to a billion elements (default: 100000000)")
+        ("test_count", value<int>()->default_value(3),
+         "number of tests to be averaged (default: 3)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
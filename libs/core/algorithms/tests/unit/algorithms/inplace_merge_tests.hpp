@@ -552,6 +552,49 @@ void test_inplace_merge_etc(
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// One of the sequences is much shorter than the other one and all of its
+// elements fall into a narrow range of values. The elements are compared by
+// their keys only, which verifies that equivalent elements keep their order.
+template <typename ExPolicy>
+void test_inplace_merge_skewed(
+    ExPolicy&& policy, std::size_t left_size, std::size_t right_size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using element_type = std::pair<int, std::size_t>;
+    using base_iterator = typename std::vector<element_type>::iterator;
+
+    std::vector<element_type> res(left_size + right_size), sol;
+
+    base_iterator res_first = std::begin(res);
+    base_iterator res_middle = res_first + left_size;
+    base_iterator res_last = std::end(res);
+
+    std::uniform_int_distribution<> dis1(0, 99), dis2(40, 59);
+    for (std::size_t i = 0; i != left_size; ++i)
+        res[i] = element_type(dis1(_gen), i);
+    for (std::size_t i = left_size; i != left_size + right_size; ++i)
+        res[i] = element_type(dis2(_gen), i);
+
+    auto comp = [](element_type const& a, element_type const& b) -> bool {
+        return a.first < b.first;
+    };
+    std::stable_sort(res_first, res_middle, comp);
+    std::stable_sort(res_middle, res_last, comp);
+
+    sol = res;
+    base_iterator sol_first = std::begin(sol);
+    base_iterator sol_middle = sol_first + left_size;
+    base_iterator sol_last = std::end(sol);
+
+    hpx::inplace_merge(policy, res_first, res_middle, res_last, comp);
+    std::inplace_merge(sol_first, sol_middle, sol_last, comp);
+
+    HPX_TEST(res == sol);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_inplace_merge()
@@ -628,6 +671,13 @@ void test_inplace_merge()
     test_inplace_merge_etc(par, IteratorTag(), user_defined_type(), rand_base);
     test_inplace_merge_etc(
         par_unseq, IteratorTag(), user_defined_type(), rand_base);
+
+    ////////// Test cases for sequences of very different length.
+    test_inplace_merge_skewed(seq, 300007, 1007);
+    test_inplace_merge_skewed(par, 300007, 1007);
+    test_inplace_merge_skewed(par, 1007, 300007);
+    test_inplace_merge_skewed(par_unseq, 300007, 0);
+    test_inplace_merge_skewed(par_unseq, 0, 300007);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
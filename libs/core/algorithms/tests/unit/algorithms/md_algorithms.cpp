@@ -0,0 +1,308 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// minimal row-major view exposing the parts of the std::mdspan interface the
+// algorithms rely on
+template <typename T, std::size_t Rank>
+struct test_view
+{
+    using index_type = std::size_t;
+
+    static constexpr std::size_t rank() noexcept
+    {
+        return Rank;
+    }
+
+    std::size_t extent(std::size_t dim) const
+    {
+        return extents[dim];
+    }
+
+    std::size_t size() const
+    {
+        std::size_t result = 1;
+        for (std::size_t extent : extents)
+            result *= extent;
+        return result;
+    }
+
+    T& operator[](std::array<index_type, Rank> const& idx) const
+    {
+        std::size_t offset = 0;
+        for (std::size_t dim = 0; dim != Rank; ++dim)
+        {
+            HPX_ASSERT(idx[dim] < extents[dim]);
+            offset = offset * extents[dim] + idx[dim];
+        }
+        return data[offset];
+    }
+
+    T* data;
+    std::array<std::size_t, Rank> extents;
+};
+
+template <typename T, std::size_t Rank>
+test_view<T, Rank> make_view(
+    std::vector<T>& v, std::array<std::size_t, Rank> const& extents)
+{
+    test_view<T, Rank> view{v.data(), extents};
+    HPX_TEST_EQ(view.size(), v.size());
+    return view;
+}
+
+using extents2 = std::array<std::size_t, 2>;
+using extents3 = std::array<std::size_t, 3>;
+
+std::vector<extents2> extents_2d()
+{
+    return {extents2{{0, 0}}, extents2{{0, 17}}, extents2{{1, 1}},
+        extents2{{1, 10007}}, extents2{{10007, 1}}, extents2{{3, 5}},
+        extents2{{1000, 777}}, extents2{{333, 1024}}};
+}
+
+std::vector<extents3> extents_3d()
+{
+    return {extents3{{0, 3, 3}}, extents3{{1, 1, 1}}, extents3{{37, 41, 43}},
+        extents3{{2, 129, 255}}};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the algorithms are invoked with the given execution policy, or without one
+// if none is given
+template <std::size_t Rank, typename... ExPolicy>
+void test_md_for_each(
+    std::array<std::size_t, Rank> const& extents, ExPolicy... policy)
+{
+    std::vector<std::size_t> c(test_view<int, Rank>{nullptr, extents}.size());
+    std::iota(c.begin(), c.end(), std::size_t(0));
+
+    // every element is visited exactly once
+    hpx::experimental::md_for_each(
+        policy..., make_view(c, extents), [](std::size_t& v) { v += 2; });
+
+    std::size_t count = 0;
+    for (std::size_t v : c)
+    {
+        HPX_TEST_EQ(v, count + 2);
+        ++count;
+    }
+}
+
+template <std::size_t Rank, typename... ExPolicy>
+void test_md_transform(
+    std::array<std::size_t, Rank> const& extents, ExPolicy... policy)
+{
+    std::vector<int> src(test_view<int, Rank>{nullptr, extents}.size());
+    std::iota(src.begin(), src.end(), static_cast<int>(gen() % 1000));
+
+    std::vector<double> dest(src.size(), -1.0);
+    hpx::experimental::md_transform(policy..., make_view(src, extents),
+        make_view(dest, extents), [](int v) { return 0.5 * v; });
+
+    for (std::size_t i = 0; i != src.size(); ++i)
+    {
+        HPX_TEST_EQ(dest[i], 0.5 * src[i]);
+    }
+}
+
+template <std::size_t Rank, typename... ExPolicy>
+void test_md_reduce(
+    std::array<std::size_t, Rank> const& extents, ExPolicy... policy)
+{
+    std::vector<std::size_t> c(test_view<int, Rank>{nullptr, extents}.size());
+    std::uniform_int_distribution<std::size_t> dist(0, 1000);
+    for (auto& v : c)
+        v = dist(gen);
+
+    std::size_t const expected =
+        std::accumulate(c.begin(), c.end(), std::size_t(42));
+
+    HPX_TEST_EQ(hpx::experimental::md_reduce(
+                    policy..., make_view(c, extents), std::size_t(42)),
+        expected);
+
+    HPX_TEST_EQ(hpx::experimental::md_reduce(policy..., make_view(c, extents),
+                    std::size_t(42), std::plus<>()),
+        expected);
+}
+
+template <typename... ExPolicy>
+void test_transpose(extents2 const& extents, ExPolicy... policy)
+{
+    std::vector<int> src(extents[0] * extents[1]);
+    std::iota(src.begin(), src.end(), 0);
+
+    std::vector<int> dest(src.size(), -1);
+    hpx::experimental::transpose(policy..., make_view(src, extents),
+        make_view(dest, extents2{{extents[1], extents[0]}}));
+
+    for (std::size_t i = 0; i != extents[0]; ++i)
+    {
+        for (std::size_t j = 0; j != extents[1]; ++j)
+        {
+            HPX_TEST_EQ(dest[j * extents[0] + i], src[i * extents[1] + j]);
+        }
+    }
+}
+
+template <typename... ExPolicy>
+void test_md_algorithms(ExPolicy... policy)
+{
+    for (auto const& extents : extents_2d())
+    {
+        test_md_for_each(extents, policy...);
+        test_md_transform(extents, policy...);
+        test_md_reduce(extents, policy...);
+        test_transpose(extents, policy...);
+    }
+
+    for (auto const& extents : extents_3d())
+    {
+        test_md_for_each(extents, policy...);
+        test_md_transform(extents, policy...);
+        test_md_reduce(extents, policy...);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_md_algorithms_async(ExPolicy policy)
+{
+    extents2 const extents = {{513, 257}};
+
+    std::vector<int> src(extents[0] * extents[1]);
+    std::iota(src.begin(), src.end(), 0);
+
+    std::vector<int> dest(src.size());
+    hpx::future<void> f = hpx::experimental::md_transform(policy,
+        make_view(src, extents), make_view(dest, extents),
+        [](int v) { return v + 1; });
+    f.get();
+
+    hpx::future<int> r = hpx::experimental::md_reduce(
+        policy, make_view(dest, extents), 0, [](int lhs, int rhs) {
+            return (std::max)(lhs, rhs);
+        });
+    HPX_TEST_EQ(r.get(), static_cast<int>(src.size()));
+
+    std::vector<int> transposed(src.size());
+    f = hpx::experimental::transpose(policy, make_view(src, extents),
+        make_view(transposed, extents2{{257, 513}}));
+    f.get();
+    for (std::size_t i = 0; i != extents[0]; ++i)
+    {
+        for (std::size_t j = 0; j != extents[1]; ++j)
+        {
+            HPX_TEST_EQ(
+                transposed[j * extents[0] + i], src[i * extents[1] + j]);
+        }
+    }
+
+    f = hpx::experimental::md_for_each(
+        policy, make_view(dest, extents), [](int& v) { v = 0; });
+    f.get();
+    HPX_TEST_EQ(std::accumulate(dest.begin(), dest.end(), 0), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_md_for_each_exception(ExPolicy policy)
+{
+    extents2 const extents = {{100, 101}};
+    std::vector<int> c(extents[0] * extents[1]);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::md_for_each(policy, make_view(c, extents),
+            [](int&) { throw std::runtime_error("test"); });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_NEQ(e.size(), std::size_t(0));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+void md_algorithms_test()
+{
+    using namespace hpx::execution;
+
+    test_md_algorithms();
+    test_md_algorithms(seq);
+    test_md_algorithms(par);
+    test_md_algorithms(par_unseq);
+
+    test_md_algorithms_async(seq(task));
+    test_md_algorithms_async(par(task));
+
+    test_md_for_each_exception(seq);
+    test_md_for_each_exception(par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    md_algorithms_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -564,6 +564,43 @@ void test_merge_etc(ExPolicy&& policy, IteratorTag, DataType, int rand_base)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// One of the sequences is much shorter than the other one and all of its
+// elements fall into a narrow range of values. The elements are compared by
+// their keys only, which verifies that equivalent elements keep their order.
+template <typename ExPolicy>
+void test_merge_skewed(ExPolicy&& policy, std::size_t size1, std::size_t size2)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using element_type = std::pair<int, std::size_t>;
+
+    std::vector<element_type> src1(size1), src2(size2),
+        dest_res(size1 + size2), dest_sol(size1 + size2);
+
+    std::uniform_int_distribution<> dis1(0, 99), dis2(40, 59);
+    for (std::size_t i = 0; i != size1; ++i)
+        src1[i] = element_type(dis1(_gen), i);
+    for (std::size_t i = 0; i != size2; ++i)
+        src2[i] = element_type(dis2(_gen), size1 + i);
+
+    auto comp = [](element_type const& a, element_type const& b) -> bool {
+        return a.first < b.first;
+    };
+    std::stable_sort(std::begin(src1), std::end(src1), comp);
+    std::stable_sort(std::begin(src2), std::end(src2), comp);
+
+    auto result = hpx::merge(policy, std::begin(src1), std::end(src1),
+        std::begin(src2), std::end(src2), std::begin(dest_res), comp);
+    auto solution = std::merge(std::begin(src1), std::end(src1),
+        std::begin(src2), std::end(src2), std::begin(dest_sol), comp);
+
+    HPX_TEST(result == std::end(dest_res));
+    HPX_TEST(solution == std::end(dest_sol));
+    HPX_TEST(dest_res == dest_sol);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_merge()
@@ -639,6 +676,13 @@ void test_merge()
     test_merge_etc(seq, IteratorTag(), user_defined_type(), rand_base);
     test_merge_etc(par, IteratorTag(), user_defined_type(), rand_base);
     test_merge_etc(par_unseq, IteratorTag(), user_defined_type(), rand_base);
+
+    ////////// Test cases for sequences of very different length.
+    test_merge_skewed(seq, 300007, 1007);
+    test_merge_skewed(par, 300007, 1007);
+    test_merge_skewed(par, 1007, 300007);
+    test_merge_skewed(par_unseq, 300007, 0);
+    test_merge_skewed(par_unseq, 0, 300007);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
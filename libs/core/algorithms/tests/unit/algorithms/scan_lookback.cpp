@@ -0,0 +1,192 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The scan algorithms split their input into tiles whose prefixes are
+// determined by looking back at the results of the preceding tiles. Verify
+// the results for a non-commutative operation, for sequences spanning many
+// tiles, and for partitions that are larger than a tile.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// affine functions x -> a * x + b, composition is associative but not
+// commutative
+struct affine
+{
+    std::uint64_t a = 1;
+    std::uint64_t b = 0;
+
+    friend bool operator==(affine const& lhs, affine const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b;
+    }
+};
+
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const
+    {
+        return affine{rhs.a * lhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+std::vector<affine> make_values(std::size_t count)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, 7);
+
+    std::vector<affine> v(count);
+    for (auto& f : v)
+    {
+        f = affine{dist(gen), dist(gen)};
+    }
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_scans(ExPolicy const& policy, std::size_t count)
+{
+    std::vector<affine> const c = make_values(count);
+    affine const init{3, 1};
+
+    std::vector<affine> expected(count);
+    std::vector<affine> d(count);
+
+    hpx::parallel::detail::sequential_inclusive_scan(
+        c.begin(), c.end(), expected.begin(), init, compose());
+    hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(), compose(), init);
+    HPX_TEST(d == expected);
+
+    hpx::parallel::detail::sequential_exclusive_scan(
+        c.begin(), c.end(), expected.begin(), init, compose());
+    hpx::exclusive_scan(policy, c.begin(), c.end(), d.begin(), init, compose());
+    HPX_TEST(d == expected);
+
+    auto conv = [](affine f) { return affine{f.a, f.b + 1}; };
+
+    hpx::parallel::detail::sequential_transform_inclusive_scan(
+        c.begin(), c.end(), expected.begin(), conv, init, compose());
+    hpx::transform_inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), compose(), conv, init);
+    HPX_TEST(d == expected);
+
+    hpx::parallel::detail::sequential_transform_exclusive_scan(
+        c.begin(), c.end(), expected.begin(), conv, init, compose());
+    hpx::transform_exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), init, compose(), conv);
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_copy_if(ExPolicy const& policy, std::size_t count)
+{
+    std::vector<affine> const c = make_values(count);
+    auto pred = [](affine const& f) { return f.a % 2 == 0; };
+
+    std::vector<affine> expected;
+    std::copy_if(c.begin(), c.end(), std::back_inserter(expected), pred);
+
+    std::vector<affine> d(count);
+    auto last = hpx::copy_if(policy, c.begin(), c.end(), d.begin(), pred);
+    d.erase(last, d.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_exception(ExPolicy const& policy, std::size_t count)
+{
+    std::vector<affine> const c = make_values(count);
+    std::vector<affine> d(count);
+
+    // throw from the middle of the sequence, none of the tasks waiting for
+    // the prefix of a tile must hang
+    std::atomic<std::size_t> calls(0);
+    auto conv = [&calls, count](affine f) {
+        if (++calls == count / 2)
+        {
+            throw std::runtime_error("test");
+        }
+        return f;
+    };
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::transform_inclusive_scan(
+            policy, c.begin(), c.end(), d.begin(), compose(), conv, affine{});
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lookback()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t count : {std::size_t(1), std::size_t(2),
+             std::size_t(10007), std::size_t(1 << 20) + 7})
+    {
+        test_scans(seq, count);
+        test_scans(par, count);
+        test_scans(par_unseq, count);
+        test_copy_if(par, count);
+    }
+
+    std::size_t const count = (1 << 18) + 3;
+
+    // many small tiles
+    test_scans(par.with(experimental::static_chunk_size(7)), count);
+    test_copy_if(par.with(experimental::static_chunk_size(7)), count);
+
+    // a single partition split into tiles
+    test_scans(par.with(experimental::static_chunk_size(count)), count);
+
+    test_exception(par, count);
+    test_exception(par.with(experimental::static_chunk_size(count)), count);
+}
+
+int hpx_main()
+{
+    test_lookback();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
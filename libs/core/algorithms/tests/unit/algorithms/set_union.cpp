@@ -222,6 +222,80 @@ void set_union_test2()
     test_set_union2<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The sequences differ a lot in length and contain many equivalent elements,
+// which exercises splitting the work into chunks of equal size.
+template <typename ExPolicy>
+void test_set_union3(ExPolicy&& policy, std::vector<std::size_t> const& c1,
+    std::vector<std::size_t> const& c2)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c3(c1.size() + c2.size()),
+        c4(c1.size() + c2.size());
+
+    auto result = hpx::set_union(policy, std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c3));
+    auto expected = std::set_union(std::begin(c1), std::end(c1), std::begin(c2),
+        std::end(c2), std::begin(c4));
+
+    // verify values
+    HPX_TEST(std::distance(std::begin(c3), result) ==
+        std::distance(std::begin(c4), expected));
+    HPX_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+}
+
+template <typename ExPolicy>
+void test_set_union3_async(ExPolicy&& p, std::vector<std::size_t> const& c1,
+    std::vector<std::size_t> const& c2)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c3(c1.size() + c2.size()),
+        c4(c1.size() + c2.size());
+
+    auto result = hpx::set_union(p, std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c3));
+    auto expected = std::set_union(std::begin(c1), std::end(c1), std::begin(c2),
+        std::end(c2), std::begin(c4));
+
+    // verify values
+    HPX_TEST(std::distance(std::begin(c3), result.get()) ==
+        std::distance(std::begin(c4), expected));
+    HPX_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+}
+
+void set_union_test3()
+{
+    using namespace hpx::execution;
+
+    std::vector<std::size_t> c1 = test::random_fill(100007);
+    std::vector<std::size_t> c2 = test::random_fill(1007);
+
+    for (auto& v : c1)
+    {
+        v %= 100;
+    }
+    for (auto& v : c2)
+    {
+        v = 40 + v % 20;
+    }
+
+    std::sort(std::begin(c1), std::end(c1));
+    std::sort(std::begin(c2), std::end(c2));
+
+    test_set_union3(seq, c1, c2);
+    test_set_union3(par, c1, c2);
+    test_set_union3(par_unseq, c1, c2);
+    test_set_union3(par, c2, c1);
+    test_set_union3(par_unseq, c2, c1);
+
+    test_set_union3_async(par(task), c1, c2);
+    test_set_union3_async(par(task), c2, c1);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_set_union_exception(IteratorTag, char const* desc)
@@ -534,6 +608,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     set_union_test1();
     set_union_test2();
+    set_union_test3();
     set_union_exception_test();
     set_union_bad_alloc_test();
     return hpx::local::finalize();
@@ -0,0 +1,250 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// sort, stable_sort, and sort_by_key use a radix sort for large sequences of
+// arithmetic values that are ordered by operator<
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// larger than the threshold for using the radix sort, not a multiple of the
+// number of cores
+constexpr std::size_t test_size = (1 << 17) + 3;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_values(std::size_t count, T lower, T upper)
+{
+    std::vector<T> v(count);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(lower, upper);
+        std::generate(v.begin(), v.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        using dist_type = std::conditional_t<std::is_signed_v<T>, std::int64_t,
+            std::uint64_t>;
+        std::uniform_int_distribution<dist_type> dist(lower, upper);
+        std::generate(
+            v.begin(), v.end(), [&]() { return static_cast<T>(dist(gen)); });
+    }
+    return v;
+}
+
+template <typename ExPolicy, typename T>
+void test_sort(ExPolicy&& policy, std::vector<T> v)
+{
+    std::vector<T> expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<T> v1 = v;
+    hpx::sort(policy, v1.begin(), v1.end());
+    HPX_TEST(v1 == expected);
+
+    std::vector<T> v2 = v;
+    hpx::sort(policy, v2.begin(), v2.end(), std::less<>());
+    HPX_TEST(v2 == expected);
+
+    std::vector<T> v3 = v;
+    hpx::stable_sort(policy, v3.begin(), v3.end());
+    HPX_TEST(v3 == expected);
+
+    std::vector<T> v4 = v;
+    hpx::ranges::sort(policy, v4);
+    HPX_TEST(v4 == expected);
+
+    // task policies run the radix sort asynchronously
+    std::vector<T> v5 = v;
+    hpx::future<void> f5 =
+        hpx::sort(policy(hpx::execution::task), v5.begin(), v5.end());
+    f5.get();
+    HPX_TEST(v5 == expected);
+
+    std::vector<T> v6 = v;
+    hpx::future<void> f6 =
+        hpx::stable_sort(policy(hpx::execution::task), v6.begin(), v6.end());
+    f6.get();
+    HPX_TEST(v6 == expected);
+
+    std::vector<T> v7 = v;
+    hpx::future<typename std::vector<T>::iterator> f7 =
+        hpx::ranges::sort(policy(hpx::execution::task), v7);
+    HPX_TEST(f7.get() == v7.end());
+    HPX_TEST(v7 == expected);
+}
+
+template <typename T>
+void test_integral()
+{
+    using hpx::execution::par;
+
+    // full range of values, includes negative values for signed types
+    test_sort(par,
+        make_values<T>(test_size, (std::numeric_limits<T>::min)(),
+            (std::numeric_limits<T>::max)()));
+
+    // small range of values, most of the digits are the same for all keys
+    test_sort(par, make_values<T>(test_size, T(0), T(100)));
+
+    // already sorted and reversed
+    std::vector<T> v = make_values<T>(test_size,
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    std::sort(v.begin(), v.end());
+    test_sort(par, v);
+    std::reverse(v.begin(), v.end());
+    test_sort(par, v);
+
+    // all equal
+    test_sort(par, std::vector<T>(test_size, T(42)));
+}
+
+template <typename T>
+void test_floating_point()
+{
+    using hpx::execution::par;
+
+    std::vector<T> v = make_values<T>(test_size, T(-1e6), T(1e6));
+
+    // special values
+    v[0] = std::numeric_limits<T>::infinity();
+    v[1] = -std::numeric_limits<T>::infinity();
+    v[2] = (std::numeric_limits<T>::max)();
+    v[3] = std::numeric_limits<T>::lowest();
+    v[4] = (std::numeric_limits<T>::min)();
+    v[5] = std::numeric_limits<T>::denorm_min();
+    v[6] = -std::numeric_limits<T>::denorm_min();
+    v[7] = T(0);
+    v[8] = -T(0);
+    std::shuffle(v.begin(), v.end(), gen);
+
+    test_sort(par, v);
+    test_sort(hpx::execution::par_unseq, v);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stable_zeros()
+{
+    // -0.0 and 0.0 compare equal, stable_sort has to keep their order
+    std::vector<double> v = make_values<double>(test_size, -1.0, 1.0);
+    for (std::size_t i = 0; i < v.size(); i += 3)
+    {
+        v[i] = (i % 2 == 0) ? 0.0 : -0.0;
+    }
+
+    std::vector<double> expected = v;
+    std::stable_sort(expected.begin(), expected.end());
+
+    hpx::stable_sort(hpx::execution::par, v.begin(), v.end());
+
+    bool equal = true;
+    for (std::size_t i = 0; i != v.size() && equal; ++i)
+    {
+        equal = v[i] == expected[i] &&
+            std::signbit(v[i]) == std::signbit(expected[i]);
+    }
+    HPX_TEST(equal);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+template <typename Key>
+void test_sort_by_key(Key lower, Key upper)
+{
+    std::vector<Key> keys = make_values<Key>(test_size, lower, upper);
+    std::vector<std::size_t> values(test_size);
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = i;
+    }
+
+    std::vector<Key> const original_keys = keys;
+
+    // task policies run the radix sort asynchronously
+    std::vector<Key> task_keys = keys;
+    std::vector<std::size_t> task_values = values;
+    auto f = hpx::experimental::sort_by_key(
+        hpx::execution::par(hpx::execution::task), task_keys.begin(),
+        task_keys.end(), task_values.begin());
+
+    auto result = hpx::experimental::sort_by_key(
+        hpx::execution::par, keys.begin(), keys.end(), values.begin());
+    HPX_TEST(result.first == keys.end());
+    HPX_TEST(result.second == values.end());
+
+    auto task_result = f.get();
+    HPX_TEST(task_result.first == task_keys.end());
+    HPX_TEST(task_result.second == task_values.end());
+    HPX_TEST(task_keys == keys);
+    HPX_TEST(task_values == values);
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+
+    // every value has to follow its key, equal keys keep their order
+    bool matching = true;
+    for (std::size_t i = 0; i != keys.size() && matching; ++i)
+    {
+        matching = keys[i] == original_keys[values[i]] &&
+            (i == 0 || keys[i - 1] != keys[i] || values[i - 1] < values[i]);
+    }
+    HPX_TEST(matching);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_integral<std::int8_t>();
+    test_integral<std::uint8_t>();
+    test_integral<std::int16_t>();
+    test_integral<std::uint16_t>();
+    test_integral<std::int32_t>();
+    test_integral<std::uint32_t>();
+    test_integral<std::int64_t>();
+    test_integral<std::uint64_t>();
+
+    test_floating_point<float>();
+    test_floating_point<double>();
+
+    test_stable_zeros();
+
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    test_sort_by_key<std::int64_t>(-1000, 1000);
+    test_sort_by_key<std::uint32_t>(
+        0, (std::numeric_limits<std::uint32_t>::max)());
+    test_sort_by_key<double>(-1.0, 1.0);
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename F>
+void test_lexicographical_compare(
+    ExPolicy policy, std::vector<T> const& c1, std::vector<T> const& c2, F f)
+{
+    bool const expected = std::lexicographical_compare(
+        c1.begin(), c1.end(), c2.begin(), c2.end(), f);
+    bool const result = hpx::lexicographical_compare(
+        policy, c1.begin(), c1.end(), c2.begin(), c2.end(), f);
+    HPX_TEST_EQ(result, expected);
+
+    // the elements of the second sequence are placed such that they are
+    // never aligned the same way as the elements of the first one
+    std::vector<T> shifted(c2.size() + 1);
+    std::copy(c2.begin(), c2.end(), std::next(shifted.begin()));
+    bool const result_shifted = hpx::lexicographical_compare(policy,
+        c1.begin(), c1.end(), std::next(shifted.begin()), shifted.end(), f);
+    HPX_TEST_EQ(result_shifted, expected);
+}
+
+template <typename T, typename ExPolicy, typename F>
+void test_lexicographical_compare(ExPolicy policy, std::size_t count, F f)
+{
+    std::uniform_int_distribution<int> dist(0, 100);
+
+    std::vector<T> c1(count);
+    for (auto& v : c1)
+    {
+        v = static_cast<T>(dist(gen));
+    }
+
+    // equal sequences, and sequences that are prefixes of each other
+    std::vector<T> c2 = c1;
+    test_lexicographical_compare(policy, c1, c2, f);
+
+    c2.push_back(T(1));
+    test_lexicographical_compare(policy, c1, c2, f);
+    test_lexicographical_compare(policy, c2, c1, f);
+
+    if (count == 0)
+        return;
+
+    // the sequences differ in a single element only, near the beginning,
+    // anywhere in the middle, and at the very end
+    c2 = c1;
+    std::uniform_int_distribution<std::size_t> pos(0, count - 1);
+    for (std::size_t i : {std::size_t(0), pos(gen), count - 1})
+    {
+        c2[i] = static_cast<T>(c1[i] + 1);
+        test_lexicographical_compare(policy, c1, c2, f);
+        test_lexicographical_compare(policy, c2, c1, f);
+        c2[i] = c1[i];
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_lexicographical_compare(ExPolicy policy)
+{
+    for (std::size_t count : {0, 1, 2, 3, 7, 31, 32, 33, 1000, 10007})
+    {
+        test_lexicographical_compare<T>(policy, count, std::less<>());
+        test_lexicographical_compare<T>(policy, count, std::greater<>());
+
+        // comparators restricted to the value type use the scalar loops
+        test_lexicographical_compare<T>(policy, count, std::less<T>());
+        test_lexicographical_compare<T>(policy, count, std::greater<T>());
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_lexicographical_compare_async(ExPolicy policy)
+{
+    std::vector<T> c1(10007, T(1));
+    std::vector<T> c2 = c1;
+    c2[5000] = T(2);
+
+    auto f = hpx::lexicographical_compare(
+        policy, c1.begin(), c1.end(), c2.begin(), c2.end());
+    HPX_TEST(f.get());
+
+    f = hpx::lexicographical_compare(
+        policy, c2.begin(), c2.end(), c1.begin(), c1.end());
+    HPX_TEST(!f.get());
+}
+
+template <typename T>
+void test_lexicographical_compare()
+{
+    using namespace hpx::execution;
+
+    test_lexicographical_compare<T>(simd);
+    test_lexicographical_compare<T>(par_simd);
+
+    test_lexicographical_compare_async<T>(simd(task));
+    test_lexicographical_compare_async<T>(par_simd(task));
+}
+
+void lexicographical_compare_test()
+{
+    test_lexicographical_compare<int>();
+    test_lexicographical_compare<std::uint8_t>();
+    test_lexicographical_compare<double>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    lexicographical_compare_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// make inspect happy: hpxinspect:nominmax
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// The values are drawn from a small range only, the algorithms have to
+// return the first smallest and the last largest element of the many equal
+// ones.
+template <typename T>
+std::vector<T> make_values(std::size_t count)
+{
+    std::uniform_int_distribution<int> dist(0, 15);
+
+    std::vector<T> c(count);
+    for (auto& v : c)
+    {
+        v = static_cast<T>(dist(gen));
+    }
+    return c;
+}
+
+template <typename T, typename ExPolicy, typename F>
+void test_minmax_element(ExPolicy policy, std::size_t count, F f)
+{
+    // start at an offset to make the vectorized kernels run on an unaligned
+    // head of the sequence
+    for (std::size_t offset : {0, 1, 3})
+    {
+        std::vector<T> c = make_values<T>(count + offset);
+        auto first = std::next(c.begin(), offset);
+
+        auto expected = std::minmax_element(first, c.end(), f);
+
+        HPX_TEST(
+            hpx::min_element(policy, first, c.end(), f) == expected.first);
+        HPX_TEST(
+            hpx::max_element(policy, first, c.end(), f) == expected.second);
+
+        auto result = hpx::minmax_element(policy, first, c.end(), f);
+        HPX_TEST(result.min == expected.first);
+        HPX_TEST(result.max == expected.second);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_minmax_element(ExPolicy policy)
+{
+    for (std::size_t count : {0, 1, 2, 3, 7, 31, 32, 33, 1000, 10007})
+    {
+        test_minmax_element<T>(policy, count, std::less<>());
+        test_minmax_element<T>(policy, count, std::greater<>());
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_minmax_element_async(ExPolicy policy)
+{
+    std::vector<T> c = make_values<T>(10007);
+    auto expected = std::minmax_element(c.begin(), c.end());
+
+    auto f1 = hpx::min_element(policy, c.begin(), c.end());
+    auto f2 = hpx::max_element(policy, c.begin(), c.end());
+    auto f3 = hpx::minmax_element(policy, c.begin(), c.end());
+
+    HPX_TEST(f1.get() == expected.first);
+    HPX_TEST(f2.get() == expected.second);
+
+    auto result = f3.get();
+    HPX_TEST(result.min == expected.first);
+    HPX_TEST(result.max == expected.second);
+}
+
+// projections and predicates that can't be invoked on vector packs make the
+// algorithms fall back to the scalar implementation
+template <typename ExPolicy>
+void test_minmax_element_scalar(ExPolicy policy)
+{
+    std::vector<int> c = make_values<int>(10007);
+    auto proj = [](int v) { return -v; };
+
+    auto result =
+        hpx::ranges::minmax_element(policy, c, std::less<int>(), proj);
+    auto expected = std::minmax_element(c.begin(), c.end(), std::greater<>());
+
+    HPX_TEST(result.min == expected.first);
+    HPX_TEST(result.max == expected.second);
+
+    // comparators for the value type only are applied element by element
+    test_minmax_element<int>(policy, 10007, std::less<int>());
+    test_minmax_element<int>(policy, 10007, std::greater<int>());
+}
+
+template <typename T>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element<T>(simd);
+    test_minmax_element<T>(par_simd);
+
+    test_minmax_element_async<T>(simd(task));
+    test_minmax_element_async<T>(par_simd(task));
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<int>();
+    test_minmax_element<std::uint8_t>();
+    test_minmax_element<std::int64_t>();
+    test_minmax_element<double>();
+
+    test_minmax_element_scalar(hpx::execution::simd);
+    test_minmax_element_scalar(hpx::execution::par_simd);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    minmax_element_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
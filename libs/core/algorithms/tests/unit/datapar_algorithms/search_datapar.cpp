@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_search(
+    ExPolicy policy, std::vector<T> const& c, std::vector<T> const& needle)
+{
+    auto expected =
+        std::search(c.begin(), c.end(), needle.begin(), needle.end());
+    auto result =
+        hpx::search(policy, c.begin(), c.end(), needle.begin(), needle.end());
+    HPX_TEST(result == expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_search(ExPolicy policy, std::size_t count)
+{
+    // the values are drawn from a small range only to create many partial
+    // matches of the needle
+    std::uniform_int_distribution<int> dist(0, 3);
+
+    std::vector<T> c(count);
+    for (auto& v : c)
+    {
+        v = static_cast<T>(dist(gen));
+    }
+
+    for (std::size_t size : {1, 2, 5, 17})
+    {
+        // a needle that is not part of the sequence
+        std::vector<T> needle(size, T(7));
+        test_search(policy, c, needle);
+
+        if (size > count)
+            continue;
+
+        // needles taken from the beginning, the middle, and the end
+        std::uniform_int_distribution<std::size_t> pos(0, count - size);
+        for (std::size_t i : {std::size_t(0), pos(gen), count - size})
+        {
+            needle.assign(
+                std::next(c.begin(), i), std::next(c.begin(), i + size));
+            test_search(policy, c, needle);
+        }
+    }
+
+    // the needle is the whole sequence, or longer than the sequence
+    std::vector<T> needle = c;
+    test_search(policy, c, needle);
+
+    needle.push_back(T(0));
+    test_search(policy, c, needle);
+}
+
+template <typename T, typename ExPolicy>
+void test_search(ExPolicy policy)
+{
+    for (std::size_t count : {0, 1, 2, 3, 7, 31, 32, 33, 1000, 10007})
+    {
+        test_search<T>(policy, count);
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_search_async(ExPolicy policy)
+{
+    std::vector<T> c(10007, T(1));
+    std::vector<T> needle = {T(1), T(2), T(3)};
+    std::copy(needle.begin(), needle.end(), std::next(c.begin(), 5000));
+
+    auto f =
+        hpx::search(policy, c.begin(), c.end(), needle.begin(), needle.end());
+    HPX_TEST(f.get() == std::next(c.begin(), 5000));
+}
+
+// predicates that can't be invoked on vector packs make the algorithm fall
+// back to the scalar implementation
+template <typename ExPolicy>
+void test_search_scalar(ExPolicy policy)
+{
+    std::vector<int> c(10007, 1);
+    std::vector<int> needle = {1, 2, 3};
+    std::copy(needle.begin(), needle.end(), std::next(c.begin(), 5000));
+
+    auto result = hpx::search(policy, c.begin(), c.end(), needle.begin(),
+        needle.end(), std::equal_to<int>());
+    HPX_TEST(result == std::next(c.begin(), 5000));
+
+    // finds the first subsequence whose elements are all smaller than the
+    // corresponding elements of the needle
+    std::vector<int> bounds = {2, 3, 4};
+    auto expected = std::search(c.begin(), c.end(), bounds.begin(),
+        bounds.end(), std::less<int>());
+    result = hpx::search(policy, c.begin(), c.end(), bounds.begin(),
+        bounds.end(), std::less<int>());
+    HPX_TEST(result == expected);
+}
+
+template <typename T>
+void test_search()
+{
+    using namespace hpx::execution;
+
+    test_search<T>(simd);
+    test_search<T>(par_simd);
+
+    test_search_async<T>(simd(task));
+    test_search_async<T>(par_simd(task));
+}
+
+void search_test()
+{
+    test_search<int>();
+    test_search<std::uint8_t>();
+    test_search<double>();
+
+    test_search_scalar(hpx::execution::simd);
+    test_search_scalar(hpx::execution::par_simd);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    search_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
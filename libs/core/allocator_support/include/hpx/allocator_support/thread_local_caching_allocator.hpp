@@ -8,9 +8,12 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/config/defines.hpp>
+#include <hpx/assert.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
 #include <utility>
@@ -198,9 +201,450 @@ namespace hpx::util {
             return !(lhs == rhs);
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // A per-thread pool of memory blocks sorted into size classes. Each
+        // block is preceded by a header referring to the pool it was taken
+        // from. Blocks released by the owning thread are kept in a private
+        // free list, blocks released by any other thread are pushed onto a
+        // lock-free list of the owning pool that is reclaimed by the owner
+        // once its private list runs dry. This way blocks always return to
+        // the thread that allocated them, even if they are released
+        // elsewhere (as it is common for shared states of futures).
+        template <typename Allocator>
+        class size_class_pool
+        {
+            using traits = std::allocator_traits<Allocator>;
+
+            static_assert(std::is_same_v<typename traits::value_type, char>,
+                "size_class_pool requires an allocator for char");
+            static_assert(traits::is_always_equal::value,
+                "size_class_pool requires a stateless allocator");
+
+            struct free_block
+            {
+                free_block* next;
+            };
+
+            struct alignas(threads::get_cache_line_size()) size_class
+            {
+                free_block* local = nullptr;
+                std::size_t count = 0;
+
+                // blocks released by other threads
+                alignas(threads::get_cache_line_size())
+                    std::atomic<free_block*> remote{nullptr};
+            };
+
+        public:
+            // every block starts with a header holding the owning pool
+            static constexpr std::size_t header_size =
+                alignof(std::max_align_t);
+
+            // size classes are spaced by granularity bytes
+            static constexpr std::size_t granularity = 64;
+            static constexpr std::size_t num_size_classes = 16;
+
+            // larger allocations are not pooled
+            static constexpr std::size_t max_size =
+                granularity * num_size_classes - header_size;
+
+            // maximal number of bytes cached per size class
+            static constexpr std::size_t max_cached_bytes = 64 * 1024;
+
+            size_class_pool() = default;
+
+            size_class_pool(size_class_pool const&) = delete;
+            size_class_pool(size_class_pool&&) = delete;
+            size_class_pool& operator=(size_class_pool const&) = delete;
+            size_class_pool& operator=(size_class_pool&&) = delete;
+
+            ~size_class_pool() = default;
+
+            [[nodiscard]] static void* allocate(std::size_t bytes)
+            {
+                HPX_ASSERT(bytes <= max_size);
+
+                std::size_t const c = size_class_index(bytes);
+                size_class_pool* pool = current_pool();
+
+                // the pool of this thread is gone, if it is being shut down
+                char* block = pool != nullptr ? pool->allocate_local(c) :
+                                                allocate_block(c, nullptr);
+                return block + header_size;
+            }
+
+            static void deallocate(void* p, std::size_t bytes) noexcept
+            {
+                HPX_ASSERT(bytes <= max_size);
+
+                std::size_t const c = size_class_index(bytes);
+                char* block = static_cast<char*>(p) - header_size;
+
+                size_class_pool* owner =
+                    *std::launder(reinterpret_cast<size_class_pool**>(block));
+                if (owner == nullptr)
+                {
+                    deallocate_block(block, c);
+                }
+                else if (owner == current_pool_)
+                {
+                    owner->deallocate_local(block, c);
+                }
+                else
+                {
+                    owner->deallocate_remote(block, c);
+                }
+            }
+
+        private:
+            static constexpr std::size_t size_class_index(
+                std::size_t bytes) noexcept
+            {
+                return (bytes + header_size + granularity - 1) / granularity -
+                    1;
+            }
+
+            static constexpr std::size_t block_size(std::size_t c) noexcept
+            {
+                return (c + 1) * granularity;
+            }
+
+            static constexpr std::size_t max_cached_blocks(
+                std::size_t c) noexcept
+            {
+                return max_cached_bytes / block_size(c);
+            }
+
+            static char* allocate_block(std::size_t c, size_class_pool* owner)
+            {
+                Allocator alloc;
+                char* block = traits::allocate(alloc, block_size(c));
+                if (block == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                ::new (block) size_class_pool*(owner);
+                return block;
+            }
+
+            static void deallocate_block(char* block, std::size_t c) noexcept
+            {
+                Allocator alloc;
+                traits::deallocate(alloc, block, block_size(c));
+            }
+
+            static free_block* to_free_block(
+                char* block, free_block* next) noexcept
+            {
+                return ::new (block + header_size) free_block{next};
+            }
+
+            static char* from_free_block(free_block* b) noexcept
+            {
+                return reinterpret_cast<char*>(b) - header_size;
+            }
+
+            char* allocate_local(std::size_t c)
+            {
+                size_class& sc = classes_[c];
+
+                free_block* b = sc.local;
+                if (b == nullptr)
+                {
+                    // reclaim the blocks released by other threads
+                    if (sc.remote.load(std::memory_order_relaxed) == nullptr)
+                    {
+                        return allocate_block(c, this);
+                    }
+                    b = sc.remote.exchange(nullptr, std::memory_order_acquire);
+                    sc.count = reclaim(b, c);
+                }
+
+                sc.local = b->next;
+                --sc.count;
+                return from_free_block(b);
+            }
+
+            // count the reclaimed blocks, releasing the ones exceeding the
+            // cache limit
+            static std::size_t reclaim(free_block* b, std::size_t c) noexcept
+            {
+                std::size_t count = 1;
+                for (/**/; b->next != nullptr; ++count)
+                {
+                    if (count == max_cached_blocks(c))
+                    {
+                        free_block* p = b->next;
+                        b->next = nullptr;
+                        while (p != nullptr)
+                        {
+                            free_block* next = p->next;
+                            deallocate_block(from_free_block(p), c);
+                            p = next;
+                        }
+                        break;
+                    }
+                    b = b->next;
+                }
+                return count;
+            }
+
+            void deallocate_local(char* block, std::size_t c) noexcept
+            {
+                size_class& sc = classes_[c];
+                if (sc.count == max_cached_blocks(c))
+                {
+                    deallocate_block(block, c);
+                    return;
+                }
+
+                sc.local = to_free_block(block, sc.local);
+                ++sc.count;
+            }
+
+            void deallocate_remote(char* block, std::size_t c) noexcept
+            {
+                std::atomic<free_block*>& remote = classes_[c].remote;
+
+                free_block* b = to_free_block(
+                    block, remote.load(std::memory_order_relaxed));
+                while (!remote.compare_exchange_weak(b->next, b,
+                    std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            // Pools of exited threads may still receive blocks from other
+            // threads, they are handed over to newly started threads instead
+            // of being destroyed.
+            struct orphaned_pools
+            {
+                std::mutex mtx;
+                size_class_pool* head = nullptr;
+            };
+
+            static orphaned_pools& orphans()
+            {
+                // intentionally leaked, blocks may be released during static
+                // destruction
+                static orphaned_pools* orphans = new orphaned_pools;
+                return *orphans;
+            }
+
+            static size_class_pool* acquire()
+            {
+                {
+                    orphaned_pools& o = orphans();
+                    std::lock_guard<std::mutex> l(o.mtx);
+                    if (size_class_pool* pool = o.head; pool != nullptr)
+                    {
+                        o.head = pool->next_orphan_;
+                        pool->next_orphan_ = nullptr;
+                        return pool;
+                    }
+                }
+                return new size_class_pool;
+            }
+
+            void release() noexcept
+            {
+                for (std::size_t c = 0; c != num_size_classes; ++c)
+                {
+                    size_class& sc = classes_[c];
+                    while (sc.local != nullptr)
+                    {
+                        free_block* next = sc.local->next;
+                        deallocate_block(from_free_block(sc.local), c);
+                        sc.local = next;
+                    }
+                    sc.count = 0;
+                }
+
+                orphaned_pools& o = orphans();
+                std::lock_guard<std::mutex> l(o.mtx);
+                next_orphan_ = o.head;
+                o.head = this;
+            }
+
+            struct pool_holder
+            {
+                pool_holder()
+                  : pool(acquire())
+                {
+                    current_pool_ = pool;
+                }
+
+                pool_holder(pool_holder const&) = delete;
+                pool_holder(pool_holder&&) = delete;
+                pool_holder& operator=(pool_holder const&) = delete;
+                pool_holder& operator=(pool_holder&&) = delete;
+
+                ~pool_holder()
+                {
+                    current_pool_ = nullptr;
+                    thread_exited_ = true;
+                    pool->release();
+                }
+
+                size_class_pool* pool;
+            };
+
+            static size_class_pool* current_pool()
+            {
+                if (current_pool_ == nullptr && !thread_exited_)
+                {
+                    thread_local pool_holder holder;
+                }
+                return current_pool_;
+            }
+
+            static inline thread_local size_class_pool* current_pool_ = nullptr;
+            static inline thread_local bool thread_exited_ = false;
+
+            size_class classes_[num_size_classes];
+            size_class_pool* next_orphan_ = nullptr;
+        };
+    }    // namespace detail
+
+    /// \brief An allocator that serves small allocations from per-thread
+    ///        pools of size-classed blocks.
+    ///
+    /// All instances sharing the same underlying allocator share their pools,
+    /// independently of the allocated type. Memory is always returned to the
+    /// pool of the thread that allocated it, releasing memory allocated on
+    /// a different thread requires a single atomic operation only.
+    /// Allocations larger than a couple of cache lines or with extended
+    /// alignment are forwarded to the underlying allocator.
+    template <typename T = char, typename Allocator = std::allocator<T>>
+    struct thread_local_size_class_allocator
+    {
+        HPX_NO_UNIQUE_ADDRESS Allocator alloc;
+
+        using traits = std::allocator_traits<Allocator>;
+
+        using value_type = typename traits::value_type;
+        using pointer = typename traits::pointer;
+        using const_pointer = typename traits::const_pointer;
+        using size_type = typename traits::size_type;
+        using difference_type = typename traits::difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = thread_local_size_class_allocator<U,
+                typename traits::template rebind_alloc<U>>;
+        };
+
+        using is_always_equal = typename traits::is_always_equal;
+        using propagate_on_container_copy_assignment =
+            typename traits::propagate_on_container_copy_assignment;
+        using propagate_on_container_move_assignment =
+            typename traits::propagate_on_container_move_assignment;
+        using propagate_on_container_swap =
+            typename traits::propagate_on_container_swap;
+
+    private:
+        using pool_type = detail::size_class_pool<
+            typename traits::template rebind_alloc<char>>;
+
+        static constexpr bool is_pooled(size_type n) noexcept
+        {
+            return alignof(T) <= pool_type::header_size &&
+                n <= pool_type::max_size / sizeof(T);
+        }
+
+    public:
+        explicit thread_local_size_class_allocator(
+            Allocator const& alloc = Allocator{}) noexcept(noexcept(std::
+                is_nothrow_copy_constructible_v<Allocator>))
+          : alloc(alloc)
+        {
+        }
+
+        template <typename U, typename Alloc>
+        explicit thread_local_size_class_allocator(
+            thread_local_size_class_allocator<U, Alloc> const&
+                rhs) noexcept(noexcept(std::
+                is_nothrow_copy_constructible_v<Alloc>))
+          : alloc(rhs.alloc)
+        {
+        }
+
+        [[nodiscard]] static constexpr pointer address(value_type& x) noexcept
+        {
+            return &x;
+        }
+
+        [[nodiscard]] static constexpr const_pointer address(
+            value_type const& x) noexcept
+        {
+            return &x;
+        }
+
+        [[nodiscard]] pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+            if (is_pooled(n))
+            {
+                return static_cast<pointer>(
+                    pool_type::allocate(n * sizeof(T)));
+            }
+            return traits::allocate(alloc, n);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (is_pooled(n))
+            {
+                pool_type::deallocate(p, n * sizeof(T));
+                return;
+            }
+            traits::deallocate(alloc, p, n);
+        }
+
+        [[nodiscard]] constexpr size_type max_size() noexcept
+        {
+            return traits::max_size(alloc);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            traits::construct(alloc, p, HPX_FORWARD(Args, args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p) noexcept
+        {
+            traits::destroy(alloc, p);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(
+            thread_local_size_class_allocator const& lhs,
+            thread_local_size_class_allocator const& rhs) noexcept
+        {
+            return lhs.alloc == rhs.alloc;
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(
+            thread_local_size_class_allocator const& lhs,
+            thread_local_size_class_allocator const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
 #else
     template <template <typename, typename> class Stack, typename T = char,
         typename Allocator = std::allocator<T>>
     using thread_local_caching_allocator = Allocator;
+
+    template <typename T = char, typename Allocator = std::allocator<T>>
+    using thread_local_size_class_allocator = Allocator;
 #endif
 }    // namespace hpx::util
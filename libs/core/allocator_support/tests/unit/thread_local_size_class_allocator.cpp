@@ -0,0 +1,179 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using allocator_type = hpx::util::thread_local_size_class_allocator<char,
+    hpx::util::internal_allocator<>>;
+
+template <std::size_t N>
+struct data
+{
+    char bytes[N];
+};
+
+template <typename T>
+T* allocate()
+{
+    using alloc_type =
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<
+            T>;
+    alloc_type alloc;
+    T* p = std::allocator_traits<alloc_type>::allocate(alloc, 1);
+    std::memset(static_cast<void*>(p), 0xcd, sizeof(T));
+    return p;
+}
+
+template <typename T>
+void deallocate(T* p)
+{
+    using alloc_type =
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<
+            T>;
+    alloc_type alloc;
+    std::allocator_traits<alloc_type>::deallocate(alloc, p, 1);
+}
+
+void test_reuse()
+{
+    auto* p1 = allocate<data<100>>();
+    deallocate(p1);
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING)
+    // a block freed on this thread is reused by types of the same size class
+    auto* p2 = allocate<data<110>>();
+    HPX_TEST_EQ(static_cast<void*>(p1), static_cast<void*>(p2));
+    deallocate(p2);
+#endif
+
+    // allocations with different sizes don't alias
+    auto* small = allocate<data<8>>();
+    auto* medium = allocate<data<200>>();
+    auto* large = allocate<data<4096>>();
+    HPX_TEST_NEQ(static_cast<void*>(small), static_cast<void*>(medium));
+    HPX_TEST_NEQ(static_cast<void*>(medium), static_cast<void*>(large));
+
+    HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(small) %
+            alignof(std::max_align_t),
+        static_cast<std::uintptr_t>(0));
+
+    deallocate(large);
+    deallocate(medium);
+    deallocate(small);
+}
+
+// blocks freed on a different thread return to the pool of their owner
+void test_remote_deallocate()
+{
+    std::size_t constexpr num_blocks = 100;
+
+    std::vector<data<300>*> blocks;
+    blocks.reserve(num_blocks);
+    for (std::size_t i = 0; i != num_blocks; ++i)
+    {
+        blocks.push_back(allocate<data<300>>());
+    }
+
+    std::thread([&]() {
+        for (auto* p : blocks)
+        {
+            deallocate(p);
+        }
+    }).join();
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING)
+    std::sort(blocks.begin(), blocks.end());
+    for (std::size_t i = 0; i != num_blocks; ++i)
+    {
+        auto* p = allocate<data<300>>();
+        HPX_TEST(std::binary_search(blocks.begin(), blocks.end(), p));
+    }
+#endif
+}
+
+// blocks may outlive the thread that has allocated them
+void test_thread_exit()
+{
+    std::vector<data<32>*> blocks;
+    for (int i = 0; i != 10; ++i)
+    {
+        std::thread([&]() {
+            for (int j = 0; j != 10; ++j)
+            {
+                blocks.push_back(allocate<data<32>>());
+            }
+            deallocate(allocate<data<32>>());
+        }).join();
+    }
+
+    for (auto* p : blocks)
+    {
+        deallocate(p);
+    }
+}
+
+void test_concurrent()
+{
+    std::size_t constexpr num_blocks = 10000;
+    std::size_t const num_threads =
+        (std::max)(std::thread::hardware_concurrency(), 2u);
+
+    // every thread allocates blocks that are freed by its neighbor
+    std::vector<std::vector<data<48>*>> blocks(num_threads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = 0; i != num_blocks; ++i)
+            {
+                blocks[t].push_back(allocate<data<48>>());
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    threads.clear();
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (auto* p : blocks[(t + 1) % num_threads])
+            {
+                deallocate(p);
+            }
+            for (std::size_t i = 0; i != num_blocks; ++i)
+            {
+                deallocate(allocate<data<48>>());
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+int main()
+{
+    test_reuse();
+    test_remote_deallocate();
+    test_thread_exit();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
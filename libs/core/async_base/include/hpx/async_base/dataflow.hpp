@@ -61,15 +61,13 @@ namespace hpx {
             // clang-format on
             friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
                 dataflow_t tag, F&& f, Ts&&... ts)
-                -> decltype(tag(hpx::util::thread_local_caching_allocator<
-                                    hpx::lockfree::variable_size_stack, char,
-                                    hpx::util::internal_allocator<>>{},
+                -> decltype(tag(hpx::util::thread_local_size_class_allocator<
+                                    char, hpx::util::internal_allocator<>>{},
                     HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...))
             {
                 using allocator_type =
-                    hpx::util::thread_local_caching_allocator<
-                        hpx::lockfree::variable_size_stack, char,
-                        hpx::util::internal_allocator<>>;
+                    hpx::util::thread_local_size_class_allocator<
+                        char, hpx::util::internal_allocator<>>;
                 return hpx::functional::tag_invoke(tag, allocator_type{},
                     HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
             }
@@ -32,11 +32,13 @@ namespace hpx {
             sync = 0x08,
             fork = 0x10,    // same as async, but forces continuation stealing
             apply = 0x20,
+            inline_ = 0x41,    // same as async, but runs the task directly on
+                               // the calling thread, if possible
 
             sync_policies = 0x0a,     // sync | deferred
             async_policies = 0x15,    // async | task | fork
-            all = 0x3f                // async | deferred | task | sync |
-                                      // fork | apply
+            all = 0x7f                // async | deferred | task | sync |
+                                      // fork | apply | inline_
         };
 
         struct policy_holder_base
@@ -273,6 +275,75 @@ namespace hpx {
             }
         };
 
+        // The inline policy allows to run a task (or continuation) directly on
+        // the calling thread if that thread is an HPX thread and if the depth
+        // of the nested continuations run directly is below the configured
+        // limit (HPX_CONTINUATION_MAX_RECURSION_DEPTH). Otherwise the task is
+        // scheduled on a new thread, as if launch::async was used.
+        struct inline_policy : policy_holder<inline_policy>
+        {
+            constexpr explicit inline_policy(
+                threads::thread_priority priority =
+                    threads::thread_priority::default_,
+                threads::thread_stacksize stacksize =
+                    threads::thread_stacksize::default_,
+                threads::thread_schedule_hint hint = {}) noexcept
+              : policy_holder<inline_policy>(
+                    launch_policy::inline_, priority, stacksize, hint)
+            {
+            }
+
+            friend inline_policy tag_invoke(
+                hpx::execution::experimental::with_priority_t,
+                inline_policy policy,
+                threads::thread_priority priority) noexcept
+            {
+                auto policy_with_priority = policy;
+                policy_with_priority.set_priority(priority);
+                return policy_with_priority;
+            }
+
+            friend constexpr hpx::threads::thread_priority tag_invoke(
+                hpx::execution::experimental::get_priority_t,
+                inline_policy policy) noexcept
+            {
+                return policy.priority();
+            }
+
+            friend inline_policy tag_invoke(
+                hpx::execution::experimental::with_stacksize_t,
+                inline_policy policy,
+                threads::thread_stacksize stacksize) noexcept
+            {
+                auto policy_with_stacksize = policy;
+                policy_with_stacksize.set_stacksize(stacksize);
+                return policy_with_stacksize;
+            }
+
+            friend constexpr hpx::threads::thread_stacksize tag_invoke(
+                hpx::execution::experimental::get_stacksize_t,
+                inline_policy policy) noexcept
+            {
+                return policy.stacksize();
+            }
+
+            friend inline_policy tag_invoke(
+                hpx::execution::experimental::with_hint_t, inline_policy policy,
+                threads::thread_schedule_hint hint) noexcept
+            {
+                auto policy_with_hint = policy;
+                policy_with_hint.set_hint(hint);
+                return policy_with_hint;
+            }
+
+            friend constexpr hpx::threads::thread_schedule_hint tag_invoke(
+                hpx::execution::experimental::get_hint_t,
+                inline_policy policy) noexcept
+            {
+                return policy.hint();
+            }
+        };
+
         struct fork_policy : policy_holder<fork_policy>
         {
             constexpr explicit fork_policy(threads::thread_priority priority =
@@ -757,6 +828,14 @@ namespace hpx {
         {
         }
 
+        /// Create a launch policy representing synchronous execution if
+        /// possible, asynchronous execution otherwise
+        constexpr launch(detail::inline_policy p) noexcept
+          : detail::policy_holder<>{detail::launch_policy::inline_,
+                p.priority(), p.stacksize(), p.hint()}
+        {
+        }
+
         /// Create a launch policy representing synchronous execution
         constexpr launch(detail::sync_policy p) noexcept
           : detail::policy_holder<>{detail::launch_policy::sync, p.priority(),
@@ -847,6 +926,7 @@ namespace hpx {
         using async_policy = detail::async_policy;
         using fork_policy = detail::fork_policy;
         using sync_policy = detail::sync_policy;
+        using inline_policy = detail::inline_policy;
         using deferred_policy = detail::deferred_policy;
         using apply_policy = detail::apply_policy;
         template <typename F>
@@ -864,6 +944,11 @@ namespace hpx {
         /// Predefined launch policy representing synchronous execution
         HPX_CORE_EXPORT static const detail::sync_policy sync;
 
+        /// Predefined launch policy representing synchronous execution on the
+        /// calling thread if the depth of the nested continuations permits,
+        /// asynchronous execution otherwise
+        HPX_CORE_EXPORT static const detail::inline_policy inline_;
+
         /// Predefined launch policy representing deferred execution
         HPX_CORE_EXPORT static const detail::deferred_policy deferred;
 
@@ -896,6 +981,18 @@ namespace hpx {
             return static_cast<bool>(static_cast<int>(p.policy()) &
                 static_cast<int>(detail::launch_policy::async_policies));
         }
+
+        HPX_FORCEINLINE constexpr bool has_inline_policy(launch p) noexcept
+        {
+            return p.get_policy() == detail::launch_policy::inline_;
+        }
+
+        template <typename F>
+        HPX_FORCEINLINE constexpr bool has_inline_policy(
+            detail::policy_holder<F> const& p) noexcept
+        {
+            return p.policy() == detail::launch_policy::inline_;
+        }
     }    // namespace detail
     /// \endcond
 }    // namespace hpx
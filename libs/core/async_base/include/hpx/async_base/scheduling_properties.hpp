@@ -11,6 +11,7 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <type_traits>
 
@@ -145,6 +146,37 @@ namespace hpx::execution::experimental {
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The deadline is the amount of time (relative to the creation of a
+    // thread) the thread should have finished running by.
+    inline constexpr struct with_deadline_t final
+      : detail::property_base<with_deadline_t>
+    {
+    } with_deadline{};
+
+    template <>
+    struct is_scheduling_property<with_deadline_t> : std::true_type
+    {
+    };
+
+    inline constexpr struct get_deadline_t final
+      : hpx::functional::detail::tag_fallback<get_deadline_t>
+    {
+    private:
+        // simply return zero (no deadline) if get_deadline is not supported
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr std::chrono::nanoseconds
+        tag_fallback_invoke(get_deadline_t, Target&&) noexcept
+        {
+            return std::chrono::nanoseconds(0);
+        }
+    } get_deadline{};
+
+    template <>
+    struct is_scheduling_property<get_deadline_t> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     inline constexpr struct with_annotation_t final
       : detail::property_base<with_annotation_t>
@@ -21,6 +21,7 @@ namespace hpx {
     detail::fork_policy const launch::fork =
         detail::fork_policy{threads::thread_priority::default_};
     detail::sync_policy const launch::sync = detail::sync_policy{};
+    detail::inline_policy const launch::inline_ = detail::inline_policy{};
     detail::deferred_policy const launch::deferred = detail::deferred_policy{};
     detail::apply_policy const launch::apply = detail::apply_policy{};
 
@@ -56,6 +56,7 @@ int main()
     static_assert(sizeof(hpx::launch::deferred_policy) <= sizeof(std::int64_t));
     static_assert(sizeof(hpx::launch::fork_policy) <= sizeof(std::int64_t));
     static_assert(sizeof(hpx::launch::apply_policy) <= sizeof(std::int64_t));
+    static_assert(sizeof(hpx::launch::inline_policy) <= sizeof(std::int64_t));
     static_assert(sizeof(hpx::launch) <= sizeof(std::int64_t));
 
     test_policy(hpx::launch::async);
@@ -63,6 +64,7 @@ int main()
     test_policy(hpx::launch::deferred);
     test_policy(hpx::launch::fork);
     test_policy(hpx::launch::apply);
+    test_policy(hpx::launch::inline_);
 
     test_policy(hpx::launch());
     test_policy(hpx::launch(hpx::launch::async));
@@ -70,6 +72,19 @@ int main()
     test_policy(hpx::launch(hpx::launch::deferred));
     test_policy(hpx::launch(hpx::launch::fork));
     test_policy(hpx::launch(hpx::launch::apply));
+    test_policy(hpx::launch(hpx::launch::inline_));
+
+    // launch::all covers all policies
+    for (hpx::launch const policy :
+        {hpx::launch(hpx::launch::async), hpx::launch(hpx::launch::sync),
+            hpx::launch(hpx::launch::deferred), hpx::launch(hpx::launch::fork),
+            hpx::launch(hpx::launch::apply),
+            hpx::launch(hpx::launch::inline_)})
+    {
+        HPX_TEST_EQ(
+            static_cast<int>((hpx::launch::all & policy).get_policy()),
+            static_cast<int>(policy.get_policy()));
+    }
 
     return 0;
 }
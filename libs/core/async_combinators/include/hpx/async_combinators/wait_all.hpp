@@ -161,6 +161,7 @@ namespace hpx {
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -433,6 +434,134 @@ namespace hpx::detail {
         Tuple const& t_;
         bool has_exceptional_results_ = false;
     };
+
+    ///////////////////////////////////////////////////////////////////////
+    // Shared state used while waiting for a range of futures. All futures
+    // that are not ready yet decrement a single counter once they become
+    // ready, the waiting thread is signaled by the last of those.
+    struct wait_all_countdown_frame    //-V690
+      : hpx::lcos::detail::future_data<void>
+    {
+    private:
+        using base_type = hpx::lcos::detail::future_data<void>;
+        using init_no_addref = base_type::init_no_addref;
+
+    public:
+        wait_all_countdown_frame() noexcept
+          : base_type(init_no_addref{})
+          , count_(0)
+        {
+        }
+
+        wait_all_countdown_frame(wait_all_countdown_frame const&) = delete;
+        wait_all_countdown_frame(wait_all_countdown_frame&&) = delete;
+
+        wait_all_countdown_frame& operator=(
+            wait_all_countdown_frame const&) = delete;
+        wait_all_countdown_frame& operator=(
+            wait_all_countdown_frame&&) = delete;
+
+        // One of the futures has become ready. The counter is decremented
+        // below zero until the waiting thread has registered the number of
+        // futures it waits for, thus only the very last operation can bring
+        // it back to zero.
+        void on_ready()
+        {
+            if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                // keep alive while the waiting thread is being signaled
+                hpx::intrusive_ptr<wait_all_countdown_frame> this_(this);
+                this->set_data(util::unused);
+            }
+        }
+
+        // Register the number of futures the callbacks were attached to,
+        // returns whether any of those is still not ready.
+        bool pending(std::ptrdiff_t count) noexcept
+        {
+            std::ptrdiff_t const previous =
+                count_.fetch_add(count, std::memory_order_acq_rel);
+            return previous + count != 0;
+        }
+
+    private:
+        std::atomic<std::ptrdiff_t> count_;
+    };
+
+    // Returns false if the future is ready after having executed a possibly
+    // deferred function.
+    template <typename SharedState>
+    HPX_FORCEINLINE bool wait_all_not_ready(SharedState const& state)
+    {
+        if (!state || state->is_ready(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        state->execute_deferred();
+
+        // execute_deferred might have made the future ready
+        return !state->is_ready(std::memory_order_relaxed);
+    }
+
+    // Wait for all futures in the given range. The leading futures that are
+    // ready already are checked in bulk without allocating any memory. The
+    // frame used for waiting for the remaining futures is allocated once
+    // and the callbacks attached to those futures do not allocate either.
+    template <typename Iter>
+    bool wait_all_range(Iter begin, Iter end)
+    {
+        bool has_exceptional_results = false;
+        for (/**/; begin != end; ++begin)
+        {
+            auto const& state = hpx::traits::detail::get_shared_state(*begin);
+            if (wait_all_not_ready(state))
+            {
+                break;
+            }
+
+            if (state && !has_exceptional_results && state->has_exception())
+            {
+                has_exceptional_results = true;
+            }
+        }
+
+        if (begin == end)
+        {
+            return has_exceptional_results;
+        }
+
+        // frame is initialized with initial reference count
+        hpx::intrusive_ptr<wait_all_countdown_frame> frame(
+            new wait_all_countdown_frame(), false);
+
+        std::ptrdiff_t count = 0;
+        for (Iter it = begin; it != end; ++it)
+        {
+            auto const& state = hpx::traits::detail::get_shared_state(*it);
+            if (wait_all_not_ready(state))
+            {
+                ++count;
+                state->set_on_completed(
+                    [frame = frame.get()]() { frame->on_ready(); });
+            }
+        }
+
+        // If there are still futures which are not ready, suspend and wait.
+        if (frame->pending(count))
+        {
+            frame->wait();
+        }
+
+        // all remaining futures are ready now, check whether at least one of
+        // those has become exceptional
+        for (/**/; !has_exceptional_results && begin != end; ++begin)
+        {
+            auto const& state = hpx::traits::detail::get_shared_state(*begin);
+            has_exceptional_results = state && state->has_exception();
+        }
+        return has_exceptional_results;
+    }
 }    // namespace hpx::detail
 
 namespace hpx {
@@ -445,19 +574,7 @@ namespace hpx {
         template <typename Future>
         static bool wait_all_nothrow_impl(std::vector<Future> const& values)
         {
-            if (!values.empty())
-            {
-                using result_type = hpx::tuple<std::vector<Future> const&>;
-                using frame_type = hpx::detail::wait_all_frame<result_type>;
-
-                result_type data(values);
-
-                // frame is initialized with initial reference count
-                hpx::intrusive_ptr<frame_type> frame(
-                    new frame_type(data), false);
-                return frame->wait_all();
-            }
-            return false;
+            return hpx::detail::wait_all_range(values.begin(), values.end());
         }
 
         template <typename Future>
@@ -486,14 +603,7 @@ namespace hpx {
         template <typename Future, std::size_t N>
         static bool wait_all_nothrow_impl(std::array<Future, N> const& values)
         {
-            using result_type = hpx::tuple<std::array<Future, N> const&>;
-            using frame_type = hpx::detail::wait_all_frame<result_type>;
-
-            result_type data(values);
-
-            // frame is initialized with initial reference count
-            hpx::intrusive_ptr<frame_type> frame(new frame_type(data), false);
-            return frame->wait_all();
+            return hpx::detail::wait_all_range(values.begin(), values.end());
         }
 
         template <typename Future, std::size_t N>
@@ -134,6 +134,7 @@ namespace hpx {
 #include <hpx/concurrency/stack.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/tag_invoke.hpp>
+#include <hpx/futures/config/defines.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/detail/future_transforms.hpp>
 #include <hpx/futures/future.hpp>
@@ -145,6 +146,7 @@ namespace hpx {
 #include <hpx/futures/traits/is_future_range.hpp>
 #include <hpx/pack_traversal/pack_traversal_async.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -199,6 +201,9 @@ namespace hpx::lcos::detail {
         auto operator()(hpx::util::async_traverse_visit_tag, T&& current)
             -> decltype(async_visit_future(HPX_FORWARD(T, current)))
         {
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+            hpx::lcos::detail::inherit_scheduling(*this, current);
+#endif
             return async_visit_future(HPX_FORWARD(T, current));
         }
 
@@ -220,25 +225,163 @@ namespace hpx::lcos::detail {
         }
     };
 
-    template <typename... T>
-    typename async_when_all_frame<
-        hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
-    when_all_impl(T&&... args)
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct is_future_vector : std::false_type
+    {
+    };
+
+    template <typename Future>
+    struct is_future_vector<std::vector<Future>>
+      : hpx::traits::is_future<Future>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_future_vector_v = is_future_vector<T>::value;
+
+    // Shared state of the future returned by when_all for a vector of
+    // futures. All futures that are not ready yet decrement a single counter
+    // once they become ready, the last of those makes the frame ready.
+    template <typename Range>
+    class when_all_range_frame : public future_data<Range>
+    {
+    public:
+        using type = hpx::future<Range>;
+        using base_type = hpx::lcos::detail::future_data<Range>;
+        using init_no_addref = typename base_type::init_no_addref;
+
+        when_all_range_frame(init_no_addref no_addref, Range&& values) noexcept
+          : base_type(no_addref)
+          , values_(HPX_MOVE(values))
+          , count_(0)
+        {
+        }
+
+        Range& values() noexcept
+        {
+            return values_;
+        }
+
+        // One of the futures has become ready. The counter is decremented
+        // below zero until all callbacks have been attached, thus only the
+        // very last operation can bring it back to zero.
+        void on_ready()
+        {
+            if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                set_ready();
+            }
+        }
+
+        // Register the number of futures the callbacks were attached to.
+        void pending(std::ptrdiff_t count)
+        {
+            std::ptrdiff_t const previous =
+                count_.fetch_add(count, std::memory_order_acq_rel);
+            if (previous + count == 0)
+            {
+                set_ready();
+            }
+        }
+
+    private:
+        void set_ready()
+        {
+            // release the reference the frame holds on itself while waiting
+            // for the futures to become ready
+            hpx::intrusive_ptr<when_all_range_frame> this_(this, false);
+            this->set_data(HPX_MOVE(values_));
+        }
+
+        Range values_;
+        std::atomic<std::ptrdiff_t> count_;
+    };
+
+    // The leading futures that are ready already are checked in bulk, if all
+    // of the futures are ready no frame is allocated at all. The callbacks
+    // attached to the remaining futures do not allocate any memory.
+    template <typename Range>
+    hpx::future<Range> when_all_range_impl(Range&& values)
     {
-        using result_type = hpx::tuple<hpx::traits::acquire_future_t<T>...>;
-        using frame_type = async_when_all_frame<result_type>;
-        using no_addref = typename frame_type::base_type::init_no_addref;
+        std::size_t const size = values.size();
+
+        std::size_t first_pending = 0;
+        while (first_pending != size &&
+            async_visit_future(values[first_pending]))
+        {
+            ++first_pending;
+        }
+
+        if (first_pending == size)
+        {
+            return hpx::make_ready_future(HPX_MOVE(values));
+        }
+
+        using frame_type = when_all_range_frame<Range>;
+        using no_addref = typename frame_type::init_no_addref;
 
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack, char,
-            hpx::util::internal_allocator<>>;
-        auto frame = hpx::util::traverse_pack_async_allocator(allocator_type{},
-            hpx::util::async_traverse_in_place_tag<frame_type>{}, no_addref{},
-            hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+        hpx::intrusive_ptr<frame_type> frame(
+            new frame_type(no_addref{}, HPX_MOVE(values)), false);
+
+        // the frame keeps itself alive until all futures have become ready,
+        // this way the callbacks don't have to hold a reference each
+        intrusive_ptr_add_ref(frame.get());
+
+        std::ptrdiff_t count = 0;
+        Range& frame_values = frame->values();
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            inherit_scheduling(*frame, frame_values[i]);
+        }
+#endif
+        for (std::size_t i = first_pending; i != size; ++i)
+        {
+            if (!async_visit_future(frame_values[i]))
+            {
+                ++count;
+                traits::detail::get_shared_state(frame_values[i])
+                    ->set_on_completed(
+                        [frame = frame.get()]() { frame->on_ready(); });
+            }
+        }
+        frame->pending(count);
 
         return hpx::traits::future_access<typename frame_type::type>::create(
             HPX_MOVE(frame));
     }
+
+    template <typename... T>
+    typename async_when_all_frame<
+        hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
+    when_all_impl(T&&... args)
+    {
+        if constexpr (sizeof...(T) == 1 &&
+            (is_future_vector_v<hpx::traits::acquire_future_t<T>> && ...))
+        {
+            return when_all_range_impl(
+                hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+        }
+        else
+        {
+            using result_type =
+                hpx::tuple<hpx::traits::acquire_future_t<T>...>;
+            using frame_type = async_when_all_frame<result_type>;
+            using no_addref = typename frame_type::base_type::init_no_addref;
+
+            using allocator_type = hpx::util::thread_local_size_class_allocator<
+                char, hpx::util::internal_allocator<>>;
+            auto frame = hpx::util::traverse_pack_async_allocator(
+                allocator_type{},
+                hpx::util::async_traverse_in_place_tag<frame_type>{},
+                no_addref{},
+                hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+
+            return hpx::traits::future_access<
+                typename frame_type::type>::create(HPX_MOVE(frame));
+        }
+    }
 }    // namespace hpx::lcos::detail
 
 namespace hpx {
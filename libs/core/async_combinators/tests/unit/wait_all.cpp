@@ -10,6 +10,8 @@
 #include <hpx/thread.hpp>
 
 #include <chrono>
+#include <cstddef>
+#include <exception>
 #include <stdexcept>
 #include <vector>
 
@@ -224,10 +226,59 @@ void test_wait_all_n()
     }
 }
 
+// a large number of futures, some of which are ready, some of which become
+// ready concurrently, and some of which are deferred
+void test_wait_all_large()
+{
+    std::size_t const num_futures = 100000;
+
+    std::vector<hpx::promise<int>> promises(num_futures / 2);
+    std::vector<hpx::future<int>> future_array;
+    future_array.reserve(num_futures);
+
+    for (std::size_t i = 0; i != num_futures / 2; ++i)
+    {
+        future_array.push_back(hpx::make_ready_future(42));
+        if (i % 2 == 0)
+        {
+            future_array.push_back(promises[i].get_future());
+        }
+        else
+        {
+            future_array.push_back(
+                hpx::async(hpx::launch::deferred, []() { return 42; }));
+        }
+    }
+
+    hpx::future<void> f = hpx::async([&promises]() {
+        for (std::size_t i = 0; i < promises.size(); i += 2)
+        {
+            if (i == promises.size() / 2)
+            {
+                promises[i].set_exception(
+                    std::make_exception_ptr(std::runtime_error("")));
+            }
+            else
+            {
+                promises[i].set_value(42);
+            }
+        }
+    });
+
+    HPX_TEST(hpx::wait_all_nothrow(future_array));
+
+    for (auto& f : future_array)
+    {
+        HPX_TEST(f.is_ready());
+    }
+    f.get();
+}
+
 int hpx_main()
 {
     test_wait_all();
     test_wait_all_n();
+    test_wait_all_large();
     return hpx::local::finalize();
 }
 
@@ -12,6 +12,7 @@
 #include <hpx/thread.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -243,6 +244,62 @@ void test_when_all_deferred_futures()
     HPX_TEST(hpx::get<1>(result).is_ready());
 }
 
+// a large number of futures, some of which are ready, some of which become
+// ready concurrently, and some of which are deferred
+void test_when_all_large()
+{
+    std::size_t const num_futures = 100000;
+
+    std::vector<hpx::promise<int>> promises(num_futures / 2);
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(num_futures);
+
+    for (std::size_t i = 0; i != num_futures / 2; ++i)
+    {
+        futures.push_back(hpx::make_ready_future(static_cast<int>(2 * i)));
+        if (i % 2 == 0)
+        {
+            futures.push_back(promises[i].get_future());
+        }
+        else
+        {
+            futures.push_back(hpx::async(hpx::launch::deferred,
+                [i]() { return static_cast<int>(2 * i + 1); }));
+        }
+    }
+
+    hpx::future<std::vector<hpx::future<int>>> r = hpx::when_all(futures);
+
+    for (std::size_t i = 0; i < promises.size(); i += 2)
+    {
+        promises[i].set_value(static_cast<int>(2 * i + 1));
+    }
+
+    std::vector<hpx::future<int>> result = r.get();
+
+    HPX_TEST_EQ(result.size(), num_futures);
+    for (std::size_t i = 0; i != result.size(); ++i)
+    {
+        HPX_TEST_EQ(result[i].get(), static_cast<int>(i));
+    }
+
+    // all futures ready
+    std::vector<hpx::future<int>> ready_futures;
+    ready_futures.push_back(hpx::make_ready_future(42));
+    ready_futures.push_back(hpx::make_ready_future(43));
+
+    auto ready = hpx::when_all(ready_futures);
+    HPX_TEST(ready.is_ready());
+    HPX_TEST_EQ(ready.get()[1].get(), 43);
+
+    // the result may be dropped before the futures have become ready
+    hpx::promise<int> p;
+    std::vector<hpx::future<int>> late_futures;
+    late_futures.push_back(p.get_future());
+    hpx::when_all(late_futures);
+    p.set_value(42);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -261,6 +318,7 @@ int hpx_main(variables_map&)
         test_when_all_five_futures();
         test_when_all_late_futures();
         test_when_all_deferred_futures();
+        test_when_all_large();
     }
 
     hpx::local::finalize();
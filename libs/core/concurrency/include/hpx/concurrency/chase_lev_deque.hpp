@@ -0,0 +1,231 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::concurrency {
+
+    /// \brief A work-stealing deque as described by Chase and Lev.
+    ///
+    /// The owning thread pushes and pops items at the bottom of the deque
+    /// (LIFO order), while any other thread may steal items from its top
+    /// (FIFO order). Neither push nor pop of the owner perform an atomic
+    /// read-modify-write operation, except when competing with thieves for
+    /// the last item. The memory orderings follow N.M. Le et al., "Correct and
+    /// Efficient Work-Stealing for Weak Memory Models", PPoPP 2013.
+    ///
+    /// The deque grows as needed. Retired buffers are kept alive until the
+    /// deque is destroyed as thieves might still access them, this bounds the
+    /// memory overhead by a factor of two.
+    ///
+    /// \tparam T  The type of the items, it has to be trivially copyable
+    ///            (usually a pointer).
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "chase_lev_deque requires trivially copyable items");
+
+        class buffer
+        {
+        public:
+            explicit buffer(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , items_(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+            }
+
+            std::int64_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            void store(std::int64_t i, T val) noexcept
+            {
+                items_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            T load(std::int64_t i) const noexcept
+            {
+                return items_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            std::unique_ptr<buffer> grow(
+                std::int64_t top, std::int64_t bottom) const
+            {
+                auto result = std::make_unique<buffer>(2 * capacity());
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    result->store(i, load(i));
+                }
+                return result;
+            }
+
+        private:
+            std::int64_t mask_;
+            std::unique_ptr<std::atomic<T>[]> items_;
+        };
+
+    public:
+        using value_type = T;
+
+        /// \brief Result of a steal attempt
+        enum class steal_result
+        {
+            success,
+            empty,
+            /// lost the race for an item against another thread
+            abort
+        };
+
+        explicit chase_lev_deque(std::size_t initial_capacity = 64)
+        {
+            std::int64_t capacity = 1;
+            while (capacity < static_cast<std::int64_t>(initial_capacity))
+            {
+                capacity *= 2;
+            }
+
+            auto b = std::make_unique<buffer>(capacity);
+            buffer_.store(b.get(), std::memory_order_relaxed);
+            buffers_.push_back(HPX_MOVE(b));
+
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque() = default;
+
+        /// \brief Push an item at the bottom, may be called by the owner only.
+        void push(T val)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                // the buffer is full, replace it with a larger one
+                auto new_buffer = a->grow(t, b);
+                a = new_buffer.get();
+                buffers_.push_back(HPX_MOVE(new_buffer));
+                buffer_.store(a, std::memory_order_release);
+            }
+
+            a->store(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// \brief Pop an item from the bottom, may be called by the owner only.
+        bool pop(T& val) noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            buffer const* a = buffer_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->load(b);
+            if (t == b)
+            {
+                // this is the last item, compete with the thieves for it
+                bool const won = top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        /// \brief Steal an item from the top, may be called by any thread.
+        steal_result steal(T& val) noexcept
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return steal_result::empty;
+            }
+
+            buffer const* a = buffer_.load(std::memory_order_acquire);
+            T const item = a->load(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return steal_result::abort;
+            }
+
+            val = item;
+            return steal_result::success;
+        }
+
+        /// \brief Steal an item from the top, retrying as long as items are
+        ///        available.
+        bool steal_retry(T& val) noexcept
+        {
+            steal_result result = steal(val);
+            while (result == steal_result::abort)
+            {
+                result = steal(val);
+            }
+            return result == steal_result::success;
+        }
+
+        /// \brief Return the (approximate) number of items in the deque.
+        std::size_t size() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        // top_ is modified by thieves, bottom_ by the owner only
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> top_;
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+
+        std::atomic<buffer*> buffer_;
+
+        // all buffers ever used, accessed by the owner only
+        std::vector<std::unique_ptr<buffer>> buffers_;
+    };
+}    // namespace hpx::concurrency
@@ -0,0 +1,121 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using deque_type = hpx::concurrency::chase_lev_deque<std::uintptr_t>;
+
+void test_basic()
+{
+    deque_type q(4);
+
+    HPX_TEST(q.empty());
+
+    std::uintptr_t val = 0;
+    HPX_TEST(!q.pop(val));
+    HPX_TEST(q.steal(val) == deque_type::steal_result::empty);
+
+    // grow the deque a couple of times
+    for (std::uintptr_t i = 1; i != 101; ++i)
+    {
+        q.push(i);
+    }
+    HPX_TEST_EQ(q.size(), static_cast<std::size_t>(100));
+
+    // the owner pops in LIFO order
+    HPX_TEST(q.pop(val));
+    HPX_TEST_EQ(val, static_cast<std::uintptr_t>(100));
+
+    // thieves steal in FIFO order
+    HPX_TEST(q.steal(val) == deque_type::steal_result::success);
+    HPX_TEST_EQ(val, static_cast<std::uintptr_t>(1));
+    HPX_TEST(q.steal_retry(val));
+    HPX_TEST_EQ(val, static_cast<std::uintptr_t>(2));
+
+    for (std::uintptr_t i = 99; i != 2; --i)
+    {
+        HPX_TEST(q.pop(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop(val));
+    HPX_TEST(!q.steal_retry(val));
+}
+
+// one owner pushes and pops items while several thieves steal, every item has
+// to be consumed exactly once
+void test_concurrent()
+{
+    std::size_t constexpr num_items = 100000;
+    std::size_t const num_thieves =
+        (std::max)(std::thread::hardware_concurrency(), 2u) - 1;
+
+    deque_type q;
+    std::vector<std::atomic<int>> consumed(num_items + 1);
+    for (auto& c : consumed)
+    {
+        c.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    thieves.reserve(num_thieves);
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uintptr_t val = 0;
+            while (!done.load(std::memory_order_acquire) || !q.empty())
+            {
+                if (q.steal(val) == deque_type::steal_result::success)
+                {
+                    ++consumed[val];
+                }
+            }
+        });
+    }
+
+    std::uintptr_t val = 0;
+    for (std::uintptr_t i = 1; i <= num_items; ++i)
+    {
+        q.push(i);
+        if (i % 3 == 0 && q.pop(val))
+        {
+            ++consumed[val];
+        }
+    }
+    while (q.pop(val))
+    {
+        ++consumed[val];
+    }
+
+    done.store(true, std::memory_order_release);
+    for (auto& t : thieves)
+    {
+        t.join();
+    }
+
+    for (std::size_t i = 1; i <= num_items; ++i)
+    {
+        HPX_TEST_EQ(consumed[i].load(), 1);
+    }
+}
+
+int main()
+{
+    test_basic();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
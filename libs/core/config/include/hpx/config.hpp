@@ -393,6 +393,14 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximal number of threads a worker may consecutively take from the 'runnext'
+// slot of its thread queue before looking at the queue itself. Setting this to
+// zero disables the runnext slot.
+#if !defined(HPX_THREAD_QUEUE_MAX_RUNNEXT_COUNT)
+#  define HPX_THREAD_QUEUE_MAX_RUNNEXT_COUNT 0
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
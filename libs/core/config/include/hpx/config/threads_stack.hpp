@@ -70,4 +70,17 @@
 #if !defined(HPX_HUGE_STACK_SIZE)
 #  define HPX_HUGE_STACK_SIZE     0x2000000       // 32MByte
 #endif
+
+// Maximal number of released stacks kept mapped for reuse (per NUMA domain).
+// The stack pool is disabled by default (zero), it can be enabled by setting
+// hpx.stacks.pool_size to a non-zero value.
+#if !defined(HPX_STACK_POOL_SIZE)
+#  define HPX_STACK_POOL_SIZE     0
+#endif
+
+// Initially accessible size of growable stacks (if enabled). Growable stacks
+// are extended by this amount whenever they run out of accessible memory.
+#if !defined(HPX_GROWABLE_STACK_INITIAL_SIZE)
+#  define HPX_GROWABLE_STACK_INITIAL_SIZE 0x4000  // 16kByte
+#endif
 // clang-format on
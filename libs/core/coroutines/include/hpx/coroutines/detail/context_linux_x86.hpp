@@ -237,6 +237,11 @@ namespace hpx::threads::coroutines::detail::lx {
         friend void swap_context(x86_linux_context_impl_base& from,
             x86_linux_context_impl_base const& to, yield_hint) noexcept;
 
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+        friend void swap_context(x86_linux_context_impl_base& from,
+            x86_linux_context_impl_base const& to, invoke_hint) noexcept;
+#endif
+
 #if defined(HPX_HAVE_ADDRESS_SANITIZER)
         void start_switch_fiber(void** fake_stack) noexcept
         {
@@ -265,6 +270,11 @@ namespace hpx::threads::coroutines::detail::lx {
     protected:
         void** m_sp;
 
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+        // points to the description of the stack if it is growable
+        posix::growable_stack* m_growable_stack = nullptr;
+#endif
+
 #if defined(HPX_HAVE_ADDRESS_SANITIZER)
     public:
         void* asan_fake_stack;
@@ -311,15 +321,27 @@ namespace hpx::threads::coroutines::detail::lx {
                     "stack size of {1} is invalid", m_stack_size));
             }
 
-            m_stack =
-                posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
-            if (m_stack == nullptr)
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            if (posix::use_growable_stacks)
             {
-                throw std::runtime_error("could not allocate memory for stack");
+                m_stack = posix::alloc_growable_stack(
+                    m_growable, static_cast<std::size_t>(m_stack_size));
+                m_growable_stack = &m_growable;
+            }
+            else
+#endif
+            {
+                m_stack =
+                    posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+                if (m_stack == nullptr)
+                {
+                    throw std::runtime_error(
+                        "could not allocate memory for stack");
+                }
+
+                posix::watermark_stack(
+                    m_stack, static_cast<std::size_t>(m_stack_size));
             }
-
-            posix::watermark_stack(
-                m_stack, static_cast<std::size_t>(m_stack_size));
 
             using fun_type = void(void*);
             fun_type* funp = trampoline<CoroutineImpl>;
@@ -343,6 +365,11 @@ namespace hpx::threads::coroutines::detail::lx {
             asan_stack_bottom = const_cast<void const*>(m_stack);
 #endif
 
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            // growable stacks install their own fault handler
+            if (m_growable_stack != nullptr)
+                return;
+#endif
             set_sigsegv_handler();
         }
 
@@ -353,6 +380,13 @@ namespace hpx::threads::coroutines::detail::lx {
 #if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
                 VALGRIND_STACK_DEREGISTER(
                     reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
+#endif
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+                if (m_growable_stack != nullptr)
+                {
+                    posix::free_growable_stack(m_growable);
+                    return;
+                }
 #endif
                 posix::free_stack(
                     m_stack, static_cast<std::size_t>(m_stack_size));
@@ -365,12 +399,39 @@ namespace hpx::threads::coroutines::detail::lx {
             return m_stack_size;
         }
 
+        // Return the size of the stack memory made accessible so far. This is
+        // less than the reserved stack size only for growable stacks, for
+        // those it reflects the stack high-water mark of the current thread
+        // (rounded up to the initial size of the stack).
+        std::ptrdiff_t get_stack_high_water() const noexcept
+        {
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            if (m_growable_stack != nullptr)
+            {
+                return m_growable.end - m_growable.committed;
+            }
+#endif
+            return m_stack_size;
+        }
+
         void reset_stack(bool direct_execution)
         {
             if (direct_execution)
                 return;
 
             HPX_ASSERT(m_stack);
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            if (m_growable_stack != nullptr)
+            {
+                if (posix::reset_growable_stack(m_growable))
+                {
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+                    increment_stack_unbind_count();
+#endif
+                }
+                return;
+            }
+#endif
             if (posix::reset_stack(
                     m_stack, static_cast<std::size_t>(m_stack_size)))
             {
@@ -448,6 +509,30 @@ namespace hpx::threads::coroutines::detail::lx {
             return util::get_and_reset_value(
                 get_stack_recycle_counter(), reset);
         }
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+        static std::uint64_t get_stack_pool_hit_count(bool reset) noexcept
+        {
+            return posix::get_stack_pool_hit_count(reset);
+        }
+
+        static std::uint64_t get_stack_bytes_reclaimed(bool reset) noexcept
+        {
+            return posix::get_stack_bytes_reclaimed(reset);
+        }
+#endif
+
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+        static std::uint64_t get_stack_high_water_max(bool reset) noexcept
+        {
+            return posix::get_stack_high_water_max(reset);
+        }
+
+        static std::uint64_t get_stack_high_water_average(bool reset) noexcept
+        {
+            return posix::get_stack_high_water_average(reset);
+        }
+#endif
 #endif
 
         friend void swap_context(x86_linux_context_impl_base& from,
@@ -525,6 +610,9 @@ namespace hpx::threads::coroutines::detail::lx {
 
         std::ptrdiff_t m_stack_size;
         void* m_stack;
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+        posix::growable_stack m_growable;
+#endif
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
@@ -555,6 +643,28 @@ namespace hpx::threads::coroutines::detail::lx {
         swapcontext_stack(&from.m_sp, to.m_sp);
 #endif
     }
+
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+    // Switching to a coroutine running on a growable stack requires letting
+    // the fault handler know which stack to grow.
+    inline void swap_context(x86_linux_context_impl_base& from,
+        x86_linux_context_impl_base const& to, invoke_hint) noexcept
+    {
+        if (to.m_growable_stack == nullptr)
+        {
+            swap_context(from, to, default_hint());
+            return;
+        }
+
+        posix::growable_stack* prev =
+            posix::enter_growable_stack(to.m_growable_stack);
+
+        to.prefetch();
+        swapcontext_stack(&from.m_sp, to.m_sp);
+
+        posix::enter_growable_stack(prev);
+    }
+#endif
 }    // namespace hpx::threads::coroutines::detail::lx
 
 #if defined(HPX_HAVE_VALGRIND)
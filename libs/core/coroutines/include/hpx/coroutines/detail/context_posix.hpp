@@ -423,6 +423,34 @@ namespace hpx::threads::coroutines {
                 return util::get_and_reset_value(
                     get_stack_recycle_counter(), reset);
             }
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            static std::uint64_t get_stack_pool_hit_count(bool reset) noexcept
+            {
+                return posix::get_stack_pool_hit_count(reset);
+            }
+
+            static std::uint64_t get_stack_bytes_reclaimed(
+                bool reset) noexcept
+            {
+                return posix::get_stack_bytes_reclaimed(reset);
+            }
+#endif
+
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            // growable stacks are not supported by this context, these are
+            // available for the performance counters only
+            static std::uint64_t get_stack_high_water_max(bool reset) noexcept
+            {
+                return posix::get_stack_high_water_max(reset);
+            }
+
+            static std::uint64_t get_stack_high_water_average(
+                bool reset) noexcept
+            {
+                return posix::get_stack_high_water_average(reset);
+            }
+#endif
 #endif
 
         private:
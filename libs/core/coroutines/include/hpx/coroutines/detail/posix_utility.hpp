@@ -44,8 +44,10 @@
  * Most of these utilities are really pure C++, but they are useful
  * only on posix systems.
  */
+#include <atomic>
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -71,6 +73,14 @@
 #define EXEC_PAGESIZE static_cast<std::size_t>(sysconf(_SC_PAGESIZE))
 #endif
 
+// Growable stacks rely on catching faults on not yet committed stack pages,
+// which is supported on Linux only.
+#if defined(__linux__) && defined(HPX_HAVE_THREAD_STACK_MMAP) &&               \
+    defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0 &&                \
+    !defined(HPX_HAVE_ADDRESS_SANITIZER)
+#define HPX_COROUTINES_HAVE_GROWABLE_STACKS
+#endif
+
 /**
  * Stack allocation routines and trampolines for setcontext
  */
@@ -81,8 +91,44 @@ namespace hpx::threads::coroutines::detail::posix {
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
+    // this global variable controls the maximal number of stacks that are
+    // kept in the process-wide stack pool for each NUMA domain, a value of
+    // zero disables the stack pool
+    HPX_CORE_EXPORT extern std::atomic<std::size_t> stack_pool_size;
+
+    // this global variable is used to control whether newly allocated stacks
+    // should be backed by (transparent) huge pages
+    HPX_CORE_EXPORT extern bool use_huge_pages;
+
+    // Retrieve a stack of the given size from the stack pool associated with
+    // the NUMA domain of the calling thread. Returns nullptr if no suitable
+    // stack is available.
+    HPX_CORE_EXPORT void* get_pooled_stack(std::size_t size) noexcept;
+
+    // Hand a stack of the given size back to the stack pool associated with
+    // the NUMA domain of the calling thread. Returns false if the stack pool
+    // is disabled or full.
+    HPX_CORE_EXPORT bool put_pooled_stack(void* stack, std::size_t size);
+
+    // Release the physical pages of the part of the given stack that has been
+    // touched, except for its first page. Returns the number of bytes that
+    // were released.
+    HPX_CORE_EXPORT std::size_t reclaim_stack(
+        void* stack, std::size_t size) noexcept;
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    HPX_CORE_EXPORT std::uint64_t get_stack_pool_hit_count(bool reset) noexcept;
+    HPX_CORE_EXPORT std::uint64_t get_stack_bytes_reclaimed(
+        bool reset) noexcept;
+#endif
+
     inline void* alloc_stack(std::size_t size)
     {
+        if (void* stack = get_pooled_stack(size); stack != nullptr)
+        {
+            return stack;
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -114,20 +160,29 @@ namespace hpx::threads::coroutines::detail::posix {
             throw std::runtime_error(error_message);
         }
 
+        void* stack = real_stack;
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
             // Set the guard page.
             ::mprotect(real_stack, EXEC_PAGESIZE, PROT_NONE);
 
-            void** stack = static_cast<void**>(real_stack) +
-                (EXEC_PAGESIZE / sizeof(void*));
-            return static_cast<void*>(stack);
+            stack = static_cast<void*>(static_cast<void**>(real_stack) +
+                (EXEC_PAGESIZE / sizeof(void*)));
+            size -= EXEC_PAGESIZE;
         }
-        return real_stack;
-#else
-        return real_stack;
 #endif
+
+#if defined(MADV_HUGEPAGE)
+        // The kernel will back the stack with huge pages only if the stack
+        // covers at least one properly aligned huge page.
+        if (use_huge_pages)
+        {
+            ::madvise(stack, size, MADV_HUGEPAGE);
+        }
+#endif
+        return stack;
     }
 
     inline void watermark_stack(void* stack, std::size_t size)
@@ -150,8 +205,10 @@ namespace hpx::threads::coroutines::detail::posix {
         if ((reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) != *watermark)
         {
             // We never free up the first page, as it's initialized only when the
-            // stack is created.
-            ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+            // stack is created. This also keeps the watermark alive, so it can
+            // be re-armed for the next use of the stack.
+            reclaim_stack(stack, size);
+            *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
             return true;
         }
 
@@ -160,6 +217,17 @@ namespace hpx::threads::coroutines::detail::posix {
 
     inline void free_stack(void* stack, std::size_t size)
     {
+        // Keep the stack mapped for later reuse, if possible. Only the part of
+        // the stack that has been touched is released back to the system.
+        if (stack_pool_size.load(std::memory_order_relaxed) != 0)
+        {
+            reset_stack(stack, size);
+            if (put_pooled_stack(stack, size))
+            {
+                return;
+            }
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -176,6 +244,50 @@ namespace hpx::threads::coroutines::detail::posix {
 #endif
     }
 
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+    // this global variable is used to control whether thread stacks start
+    // small and grow on demand
+    HPX_CORE_EXPORT extern bool use_growable_stacks;
+
+    // this global variable holds the initially accessible size of growable
+    // stacks, a growable stack is extended by this amount whenever needed
+    HPX_CORE_EXPORT extern std::size_t growable_stack_initial_size;
+
+    // A growable stack reserves the address range [begin, end), but only the
+    // part [committed, end) is accessible. Touching memory below 'committed'
+    // makes the stack grow.
+    struct growable_stack
+    {
+        char* begin = nullptr;
+        char* committed = nullptr;
+        char* end = nullptr;
+        std::size_t initial_size = 0;
+        std::size_t guard_size = 0;
+    };
+
+    // Reserve the address range for a growable stack of the given (maximal)
+    // size and make its initial part accessible.
+    HPX_CORE_EXPORT void* alloc_growable_stack(
+        growable_stack& stack, std::size_t size);
+
+    HPX_CORE_EXPORT void free_growable_stack(growable_stack& stack) noexcept;
+
+    // Shrink the stack back to its initial size. Returns true if the stack
+    // had grown before.
+    HPX_CORE_EXPORT bool reset_growable_stack(growable_stack& stack) noexcept;
+
+    // Announce the growable stack the calling thread is about to run on,
+    // returns the previously announced stack.
+    HPX_CORE_EXPORT growable_stack* enter_growable_stack(
+        growable_stack* stack) noexcept;
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    HPX_CORE_EXPORT std::uint64_t get_stack_high_water_max(bool reset) noexcept;
+    HPX_CORE_EXPORT std::uint64_t get_stack_high_water_average(
+        bool reset) noexcept;
+#endif
+#endif
+
 #else
     // non-mmap()
 
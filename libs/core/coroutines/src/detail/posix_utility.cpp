@@ -12,12 +12,554 @@
 
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+#include <hpx/thread_support/spinlock.hpp>
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+#include <hpx/util/get_and_reset_value.hpp>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+#include <signal.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <utility>
+#endif
+
+#endif
+
 namespace hpx::threads::coroutines::detail::posix {
 
     ///////////////////////////////////////////////////////////////////////////
     // this global variable is used to control whether guard pages will be used
     // or not
     bool use_guard_pages = true;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<std::size_t> stack_pool_size(HPX_STACK_POOL_SIZE);
+    bool use_huge_pages = false;
+
+    namespace {
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        std::atomic<std::int64_t> stack_pool_hit_count(0);
+        std::atomic<std::int64_t> stack_bytes_reclaimed(0);
+#endif
+
+        // the number of stack pools (NUMA domains) we distinguish
+        constexpr std::size_t max_numa_domains = 16;
+
+        std::size_t query_numa_domain() noexcept
+        {
+#if defined(__linux__) && defined(SYS_getcpu)
+            unsigned cpu = 0;
+            unsigned node = 0;
+            if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+            {
+                return node % max_numa_domains;
+            }
+#endif
+            return 0;
+        }
+
+        // The worker threads are bound to their cores, thus the NUMA domain
+        // is queried only once for each OS thread.
+        std::size_t get_current_numa_domain() noexcept
+        {
+            thread_local std::size_t const domain = query_numa_domain();
+            return domain;
+        }
+
+        void unmap_stack(void* stack, std::size_t size, bool guard_page)
+        {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            if (guard_page)
+            {
+                void** real_stack = static_cast<void**>(stack) -
+                    (EXEC_PAGESIZE / sizeof(void*));
+                ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
+                return;
+            }
+#else
+            (void) guard_page;
+#endif
+            ::munmap(stack, size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Stacks are kept in separate slabs for each NUMA domain, this ensures
+        // that stacks whose pages were first touched on a given NUMA domain
+        // are reused on the same domain. Each slab keeps a LIFO list of
+        // stacks for each stack size, the most recently released stack is
+        // handed out first as its pages are most likely still resident.
+        struct stack_bucket
+        {
+            std::size_t size;
+            bool guard_page;
+            std::vector<void*> stacks;
+        };
+
+        struct stack_slab
+        {
+            // there are only a few different stack sizes
+            stack_bucket* find_bucket(std::size_t size) noexcept
+            {
+                for (stack_bucket& bucket : buckets)
+                {
+                    if (bucket.size == size &&
+                        bucket.guard_page == use_guard_pages)
+                    {
+                        return &bucket;
+                    }
+                }
+                return nullptr;
+            }
+
+            hpx::util::detail::spinlock mtx;
+            std::vector<stack_bucket> buckets;
+            std::size_t count = 0;
+        };
+
+        struct stack_pool
+        {
+            stack_pool() = default;
+
+            ~stack_pool()
+            {
+                // stacks released after this point are unmapped directly
+                stack_pool_size.store(0, std::memory_order_relaxed);
+                for (auto& slab : slabs)
+                {
+                    for (stack_bucket const& bucket : slab.buckets)
+                    {
+                        for (void* stack : bucket.stacks)
+                        {
+                            unmap_stack(
+                                stack, bucket.size, bucket.guard_page);
+                        }
+                    }
+                }
+            }
+
+            std::array<stack_slab, max_numa_domains> slabs;
+        };
+
+        stack_pool& get_stack_pool()
+        {
+            static stack_pool pool;
+            return pool;
+        }
+    }    // namespace
+
+    void* get_pooled_stack(std::size_t size) noexcept
+    {
+        if (stack_pool_size.load(std::memory_order_relaxed) == 0)
+        {
+            return nullptr;
+        }
+
+        stack_slab& slab = get_stack_pool().slabs[get_current_numa_domain()];
+
+        void* stack = nullptr;
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(slab.mtx);
+
+            stack_bucket* bucket = slab.find_bucket(size);
+            if (bucket == nullptr || bucket->stacks.empty())
+            {
+                return nullptr;
+            }
+
+            stack = bucket->stacks.back();
+            bucket->stacks.pop_back();
+            --slab.count;
+        }
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        ++stack_pool_hit_count;
+#endif
+        return stack;
+    }
+
+    bool put_pooled_stack(void* stack, std::size_t size)
+    {
+        std::size_t const max_size =
+            stack_pool_size.load(std::memory_order_relaxed);
+        if (max_size == 0)
+        {
+            return false;
+        }
+
+        stack_slab& slab = get_stack_pool().slabs[get_current_numa_domain()];
+
+        std::lock_guard<hpx::util::detail::spinlock> l(slab.mtx);
+        if (slab.count >= max_size)
+        {
+            return false;
+        }
+
+        stack_bucket* bucket = slab.find_bucket(size);
+        if (bucket == nullptr)
+        {
+            bucket = &slab.buckets.emplace_back(
+                stack_bucket{size, use_guard_pages, {}});
+        }
+
+        bucket->stacks.push_back(stack);
+        ++slab.count;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t reclaim_stack(void* stack, std::size_t size) noexcept
+    {
+        // We never free up the first page of the stack (at its upper end).
+        std::size_t const num_pages = size / EXEC_PAGESIZE - 1;
+        std::size_t first_page = 0;
+
+#if defined(__linux__)
+        // Find the lowest resident page, this is the high-water mark of the
+        // stack. Everything below it has never been touched since the stack
+        // was last reclaimed and does not need to be released.
+        constexpr std::size_t chunk_size = 128;
+        unsigned char resident[chunk_size];
+
+        bool found = false;
+        while (!found && first_page != num_pages)
+        {
+            std::size_t const count =
+                (std::min)(chunk_size, num_pages - first_page);
+            if (::mincore(static_cast<char*>(stack) +
+                        first_page * EXEC_PAGESIZE,
+                    count * EXEC_PAGESIZE, resident) != 0)
+            {
+                // fall back to releasing the whole stack
+                first_page = 0;
+                break;
+            }
+
+            std::size_t i = 0;
+            while (i != count && (resident[i] & 0x1) == 0)
+            {
+                ++i;
+            }
+
+            found = i != count;
+            first_page += i;
+        }
+#endif
+
+        std::size_t const bytes = (num_pages - first_page) * EXEC_PAGESIZE;
+        if (bytes == 0)
+        {
+            return 0;
+        }
+
+        void* begin = static_cast<char*>(stack) + first_page * EXEC_PAGESIZE;
+
+        // Pages released with MADV_FREE would stay resident until the kernel
+        // is under memory pressure and mincore would keep reporting them as
+        // touched. MADV_DONTNEED drops them immediately, so that the scan
+        // above finds only the pages touched since the last reclaim.
+        ::madvise(begin, bytes, MADV_DONTNEED);
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        stack_bytes_reclaimed += static_cast<std::int64_t>(bytes);
+#endif
+        return bytes;
+    }
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    std::uint64_t get_stack_pool_hit_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_pool_hit_count, reset);
+    }
+
+    std::uint64_t get_stack_bytes_reclaimed(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_bytes_reclaimed, reset);
+    }
+#endif
+
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+    ///////////////////////////////////////////////////////////////////////////
+    bool use_growable_stacks = false;
+    std::size_t growable_stack_initial_size = HPX_GROWABLE_STACK_INITIAL_SIZE;
+
+    namespace {
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        std::atomic<std::int64_t> stack_high_water_max(0);
+        std::atomic<std::int64_t> stack_high_water_sum(0);
+        std::atomic<std::int64_t> stack_high_water_count(0);
+
+        void record_stack_high_water(std::int64_t high_water) noexcept
+        {
+            std::int64_t max = stack_high_water_max.load();
+            while (max < high_water &&
+                !stack_high_water_max.compare_exchange_weak(max, high_water))
+            {
+            }
+            stack_high_water_sum += high_water;
+            ++stack_high_water_count;
+        }
+#endif
+
+        // the growable stack the current OS thread is running on
+        thread_local growable_stack* current_growable_stack = nullptr;
+
+        struct sigaction previous_sigsegv_action;
+        std::mutex sigsegv_action_mtx;
+
+        void forward_sigsegv(int signum, siginfo_t* info, void* ctx) noexcept
+        {
+            if (previous_sigsegv_action.sa_flags & SA_SIGINFO)
+            {
+                previous_sigsegv_action.sa_sigaction(signum, info, ctx);
+            }
+            else if (previous_sigsegv_action.sa_handler == SIG_DFL ||
+                previous_sigsegv_action.sa_handler == SIG_IGN)
+            {
+                // the faulting instruction is re-executed on return, which
+                // triggers the default action
+                ::signal(signum, SIG_DFL);
+            }
+            else
+            {
+                previous_sigsegv_action.sa_handler(signum);
+            }
+        }
+
+        void growable_stack_sigsegv_handler(
+            int signum, siginfo_t* info, void* ctx) noexcept
+        {
+            growable_stack* stack = current_growable_stack;
+            char* addr = static_cast<char*>(info->si_addr);
+
+            if (stack != nullptr && addr >= stack->begin &&
+                addr < stack->committed)
+            {
+                // Make the faulting page accessible, together with another
+                // increment of the initial stack size.
+                std::size_t const offset =
+                    (static_cast<std::size_t>(addr - stack->begin) /
+                        EXEC_PAGESIZE) *
+                    EXEC_PAGESIZE;
+                char* committed = offset > stack->initial_size ?
+                    stack->begin + offset - stack->initial_size :
+                    stack->begin;
+
+                if (::mprotect(committed,
+                        static_cast<std::size_t>(stack->committed - committed),
+                        PROT_READ | PROT_WRITE) == 0)
+                {
+                    stack->committed = committed;
+                    return;
+                }
+            }
+            else if (stack != nullptr && addr < stack->begin &&
+                addr >= stack->begin - stack->guard_size)
+            {
+                constexpr char const msg[] =
+                    "Stack overflow in coroutine (growable stack exhausted).\n"
+                    "Use the hpx.stacks.small_size, hpx.stacks.medium_size,\n"
+                    "hpx.stacks.large_size, or hpx.stacks.huge_size "
+                    "configuration\nflags to configure the maximal coroutine "
+                    "stack sizes.\n";
+                [[maybe_unused]] auto const r =
+                    ::write(STDERR_FILENO, msg, sizeof(msg) - 1);
+            }
+
+            forward_sigsegv(signum, info, ctx);
+        }
+
+        void install_sigsegv_handler()
+        {
+            std::lock_guard<std::mutex> l(sigsegv_action_mtx);
+
+            struct sigaction current;
+            ::sigaction(SIGSEGV, nullptr, &current);
+            if ((current.sa_flags & SA_SIGINFO) &&
+                current.sa_sigaction == &growable_stack_sigsegv_handler)
+            {
+                return;    // already installed
+            }
+
+            struct sigaction action;
+            std::memset(&action, '\0', sizeof(action));
+            action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+            action.sa_sigaction = &growable_stack_sigsegv_handler;
+            sigemptyset(&action.sa_mask);
+            ::sigaction(SIGSEGV, &action, &previous_sigsegv_action);
+        }
+
+        // The fault handler can't run on the faulting stack, thus every OS
+        // thread running growable stacks needs an alternate signal stack.
+        struct alternate_signal_stack
+        {
+            static constexpr std::size_t size = 0x10000;
+
+            alternate_signal_stack() noexcept
+              : stack(std::malloc(size))
+            {
+                stack_t ss;
+                ss.ss_sp = stack;
+                ss.ss_flags = 0;
+                ss.ss_size = size;
+                ::sigaltstack(&ss, nullptr);
+            }
+
+            alternate_signal_stack(alternate_signal_stack const&) = delete;
+            alternate_signal_stack& operator=(
+                alternate_signal_stack const&) = delete;
+
+            ~alternate_signal_stack()
+            {
+                // disable the alternate stack only if it is still ours
+                stack_t ss;
+                if (::sigaltstack(nullptr, &ss) == 0 && ss.ss_sp == stack)
+                {
+                    ss.ss_flags = SS_DISABLE;
+                    ::sigaltstack(&ss, nullptr);
+                }
+                std::free(stack);
+            }
+
+            void* stack;
+        };
+
+        std::size_t round_to_pages(std::size_t size) noexcept
+        {
+            return (size + EXEC_PAGESIZE - 1) / EXEC_PAGESIZE * EXEC_PAGESIZE;
+        }
+    }    // namespace
+
+    void* alloc_growable_stack(growable_stack& stack, std::size_t size)
+    {
+        std::size_t guard_size = 0;
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+        if (use_guard_pages)
+        {
+            guard_size = EXEC_PAGESIZE;
+        }
+#endif
+
+        // reserve the address range only, the memory is not committed
+        void* real_stack = ::mmap(nullptr, size + guard_size, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (real_stack == MAP_FAILED)
+        {
+            throw std::runtime_error(
+                "mmap() failed to reserve growable thread stack");
+        }
+
+        // the initially accessible part must hold at least two pages (the
+        // first page hosts the initial context)
+        std::size_t const initial_size = (std::min)(size,
+            (std::max)(round_to_pages(growable_stack_initial_size),
+                2 * static_cast<std::size_t>(EXEC_PAGESIZE)));
+
+        stack.begin = static_cast<char*>(real_stack) + guard_size;
+        stack.end = stack.begin + size;
+        stack.committed = stack.end - initial_size;
+        stack.initial_size = initial_size;
+        stack.guard_size = guard_size;
+
+        if (::mprotect(stack.committed, initial_size, PROT_READ | PROT_WRITE) !=
+            0)
+        {
+            ::munmap(real_stack, size + guard_size);
+            throw std::runtime_error(
+                "mprotect() failed to commit growable thread stack");
+        }
+
+        return stack.begin;
+    }
+
+    void free_growable_stack(growable_stack& stack) noexcept
+    {
+        ::munmap(stack.begin - stack.guard_size,
+            static_cast<std::size_t>(stack.end - stack.begin) +
+                stack.guard_size);
+        stack = growable_stack();
+    }
+
+    bool reset_growable_stack(growable_stack& stack) noexcept
+    {
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        record_stack_high_water(
+            static_cast<std::int64_t>(stack.end - stack.committed));
+#endif
+
+        char* initial = stack.end - stack.initial_size;
+        if (stack.committed >= initial)
+        {
+            return false;
+        }
+
+        // release the pages and make them inaccessible again
+        std::size_t const size =
+            static_cast<std::size_t>(initial - stack.committed);
+        ::madvise(stack.committed, size, MADV_DONTNEED);
+        ::mprotect(stack.committed, size, PROT_NONE);
+        stack.committed = initial;
+
+        return true;
+    }
+
+    growable_stack* enter_growable_stack(growable_stack* stack) noexcept
+    {
+        if (stack != nullptr)
+        {
+            thread_local bool initialized = false;
+            if (!initialized)
+            {
+                initialized = true;
+
+                thread_local alternate_signal_stack signal_stack;
+                install_sigsegv_handler();
+            }
+        }
+        return std::exchange(current_growable_stack, stack);
+    }
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    std::uint64_t get_stack_high_water_max(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_high_water_max, reset);
+    }
+
+    std::uint64_t get_stack_high_water_average(bool reset) noexcept
+    {
+        std::int64_t const count =
+            util::get_and_reset_value(stack_high_water_count, reset);
+        std::int64_t const sum =
+            util::get_and_reset_value(stack_high_water_sum, reset);
+        return count == 0 ? 0 : static_cast<std::uint64_t>(sum / count);
+    }
+#endif
+#endif
+#endif
 }    // namespace hpx::threads::coroutines::detail::posix
 
 #endif
@@ -0,0 +1,86 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that HPX threads running on growable stacks can use (much) more stack
+// space than initially accessible.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// use roughly 'depth' kilobytes of stack space, optionally suspend the thread
+// at the deepest point
+std::size_t recurse(std::size_t depth, bool suspend)
+{
+    volatile unsigned char buffer[1024];
+    std::memset(const_cast<unsigned char*>(buffer),
+        static_cast<int>(depth & 0xff), sizeof(buffer));
+
+    if (depth == 0)
+    {
+        if (suspend)
+        {
+            // the thread may be resumed by a different worker thread, the
+            // stack may grow further afterwards
+            hpx::this_thread::yield();
+        }
+        return buffer[0];
+    }
+
+    return buffer[depth % sizeof(buffer)] + recurse(depth - 1, suspend);
+}
+
+std::size_t expected(std::size_t depth)
+{
+    std::size_t result = 0;
+    for (std::size_t i = 0; i <= depth; ++i)
+    {
+        result += i & 0xff;
+    }
+    return result;
+}
+
+int hpx_main()
+{
+    std::size_t const depths[] = {1, 64, 256, 16, 512};
+
+    // run the threads repeatedly, growable stacks are shrunk again whenever a
+    // thread finishes
+    for (int i = 0; i != 4; ++i)
+    {
+        bool const suspend = i % 2 != 0;
+
+        std::vector<hpx::future<std::size_t>> results;
+        for (std::size_t depth : depths)
+        {
+            results.push_back(hpx::async(&recurse, depth, suspend));
+        }
+
+        for (std::size_t j = 0; j != results.size(); ++j)
+        {
+            HPX_TEST_EQ(results[j].get(), expected(depths[j]));
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.stacks.use_growable_stacks=1",
+        "hpx.stacks.small_size=0x100000",
+        "hpx.stacks.growable_initial_size=0x4000"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that released thread stacks are reused from the stack pool and that
+// only the touched part of a stack is released to the operating system.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(__linux__) && defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+constexpr std::size_t num_pages = 16;
+constexpr std::size_t stack_size = num_pages * EXEC_PAGESIZE;
+
+// touch the given number of pages below the first page of the stack
+void touch_stack(void* stack, std::size_t pages)
+{
+    char* first_page = static_cast<char*>(stack) + stack_size - EXEC_PAGESIZE;
+    std::memset(
+        first_page - pages * EXEC_PAGESIZE, 0x42, pages * EXEC_PAGESIZE);
+}
+
+void test_stack_reuse()
+{
+    posix::stack_pool_size = 4;
+
+    void* stack = posix::alloc_stack(stack_size);
+    posix::watermark_stack(stack, stack_size);
+    touch_stack(stack, 2);
+    posix::free_stack(stack, stack_size);
+
+    // the most recently released stack is handed out first
+    void* reused = posix::alloc_stack(stack_size);
+    HPX_TEST_EQ(reused, stack);
+
+    // the watermark has been re-armed while releasing the stack
+    HPX_TEST(!posix::reset_stack(reused, stack_size));
+
+    // stacks of a different size are not reused
+    posix::free_stack(reused, stack_size);
+    void* other = posix::alloc_stack(2 * stack_size);
+    HPX_TEST_NEQ(other, stack);
+
+    posix::free_stack(other, 2 * stack_size);
+    posix::stack_pool_size = 0;
+}
+
+void test_stack_lifo()
+{
+    posix::stack_pool_size = 8;
+
+    void* a = posix::alloc_stack(stack_size);
+    void* x = posix::alloc_stack(2 * stack_size);
+    void* b = posix::alloc_stack(stack_size);
+    void* y = posix::alloc_stack(2 * stack_size);
+    void* c = posix::alloc_stack(stack_size);
+
+    posix::free_stack(a, stack_size);
+    posix::free_stack(x, 2 * stack_size);
+    posix::free_stack(b, stack_size);
+    posix::free_stack(y, 2 * stack_size);
+    posix::free_stack(c, stack_size);
+
+    // stacks of each size are handed out in reverse order of their release
+    HPX_TEST_EQ(posix::alloc_stack(stack_size), c);
+    HPX_TEST_EQ(posix::alloc_stack(2 * stack_size), y);
+    HPX_TEST_EQ(posix::alloc_stack(stack_size), b);
+    HPX_TEST_EQ(posix::alloc_stack(stack_size), a);
+    HPX_TEST_EQ(posix::alloc_stack(2 * stack_size), x);
+
+    posix::stack_pool_size = 0;
+    posix::free_stack(a, stack_size);
+    posix::free_stack(b, stack_size);
+    posix::free_stack(c, stack_size);
+    posix::free_stack(x, 2 * stack_size);
+    posix::free_stack(y, 2 * stack_size);
+}
+
+void test_stack_reclaim()
+{
+    posix::stack_pool_size = 0;
+
+    void* stack = posix::alloc_stack(stack_size);
+    posix::watermark_stack(stack, stack_size);
+
+    // only the touched pages are released, the first page is kept
+    touch_stack(stack, 3);
+    HPX_TEST_EQ(posix::reclaim_stack(stack, stack_size),
+        static_cast<std::size_t>(3 * EXEC_PAGESIZE));
+
+    // pages released by the previous reclaim are not released again
+    touch_stack(stack, 1);
+    HPX_TEST_EQ(posix::reclaim_stack(stack, stack_size),
+        static_cast<std::size_t>(EXEC_PAGESIZE));
+
+    touch_stack(stack, num_pages - 1);
+    HPX_TEST_EQ(posix::reclaim_stack(stack, stack_size),
+        static_cast<std::size_t>((num_pages - 1) * EXEC_PAGESIZE));
+
+    posix::free_stack(stack, stack_size);
+}
+
+int main()
+{
+    test_stack_reuse();
+    test_stack_lifo();
+    test_stack_reclaim();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
@@ -18,7 +18,6 @@
 #include <hpx/allocator_support/traits/is_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
-#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/datastructures/variant.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
@@ -34,9 +33,7 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_priority_invoke.hpp>
 #include <hpx/functional/invoke_fused.hpp>
-#include <hpx/functional/move_only_function.hpp>
 #include <hpx/modules/memory.hpp>
-#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/type_support/meta.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -45,7 +42,6 @@
 #include <cstddef>
 #include <exception>
 #include <memory>
-#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -89,6 +85,25 @@ namespace hpx::execution::experimental {
             }
         };
 
+        // Every operation state connected to a split sender is a node of the
+        // intrusive list of continuations of the shared state, waiting for
+        // the predecessor to complete does not allocate any memory.
+        struct split_continuation
+        {
+            using complete_function_type =
+                void (*)(split_continuation*) noexcept;
+
+            explicit constexpr split_continuation(
+                complete_function_type complete) noexcept
+              : next(nullptr)
+              , complete(complete)
+            {
+            }
+
+            split_continuation* next;
+            complete_function_type complete;
+        };
+
         template <typename Sender, typename Allocator, submission_type Type,
             typename Scheduler = no_scheduler>
         struct split_sender
@@ -105,6 +120,16 @@ namespace hpx::execution::experimental {
                     std::add_lvalue_reference>;
             };
 
+            // The values sent by the predecessor are stored by value, even if
+            // it sends references (e.g. if it is a split sender itself). The
+            // value types of split senders add the references only after
+            // applying the given Tuple, decayed_tuple doesn't remove them.
+            template <typename Tuple>
+            struct decayed_value_types_helper
+            {
+                using type = hpx::util::detail::transform_t<Tuple, std::decay>;
+            };
+
             template <typename Env>
             struct generate_completion_signatures
             {
@@ -152,10 +177,13 @@ namespace hpx::execution::experimental {
                     Allocator>::template rebind_alloc<shared_state>;
                 HPX_NO_UNIQUE_ADDRESS allocator_type alloc;
 
-                hpx::spinlock mtx;
                 hpx::util::atomic_count reference_count{0};
                 std::atomic<bool> start_called{false};
-                std::atomic<bool> predecessor_done{false};
+
+                // Lock-free stack of the continuations added before the
+                // predecessor has completed. Holds the address of the shared
+                // state itself once the predecessor has completed.
+                std::atomic<void*> continuations{nullptr};
 
                 using operation_state_type =
                     std::decay_t<connect_result_t<Sender, split_receiver>>;
@@ -166,8 +194,10 @@ namespace hpx::execution::experimental {
                 struct stopped_type
                 {
                 };
-                using value_type = value_types_of_t<Sender, empty_env,
-                    decayed_tuple, hpx::variant>;
+                using value_type = hpx::util::detail::transform_t<
+                    value_types_of_t<Sender, empty_env, decayed_tuple,
+                        hpx::variant>,
+                    decayed_value_types_helper>;
                 using error_type = detail::error_types_from<signatures,
                     meta::func<hpx::variant>>;
 
@@ -175,9 +205,6 @@ namespace hpx::execution::experimental {
                     value_type>
                     v;
 
-                using continuation_type = hpx::move_only_function<void()>;
-                hpx::detail::small_vector<continuation_type, 1> continuations;
-
                 struct split_receiver
                 {
                     hpx::intrusive_ptr<shared_state> state;
@@ -220,8 +247,10 @@ namespace hpx::execution::experimental {
                     // This typedef is duplicated from the parent struct. The
                     // parent typedef is not instantiated early enough for use
                     // here.
-                    using value_type = value_types_of_t<Sender, empty_env,
-                        decayed_tuple, hpx::variant>;
+                    using value_type = hpx::util::detail::transform_t<
+                        value_types_of_t<Sender, empty_env, decayed_tuple,
+                            hpx::variant>,
+                        decayed_value_types_helper>;
 
                     // different versions of clang-format disagree
                     // clang-format off
@@ -302,113 +331,66 @@ namespace hpx::execution::experimental {
 
                 virtual void set_predecessor_done()
                 {
-                    predecessor_done = true;
+                    // Publish the stored values/errors and take ownership of
+                    // all continuations added so far. Continuations added
+                    // afterwards will see the marker and complete directly.
+                    auto* c = static_cast<split_continuation*>(
+                        continuations.exchange(static_cast<void*>(this),
+                            std::memory_order_acq_rel));
+
+                    if (c == nullptr)
+                    {
+                        return;
+                    }
 
+                    // The common case of a single continuation is completed
+                    // directly.
+                    if (c->next == nullptr)
                     {
-                        // We require taking the lock here to synchronize with
-                        // threads attempting to add continuations to the vector
-                        // of continuations. However, it is enough to take it
-                        // once and release it immediately.
-                        //
-                        // Without the lock we may not see writes to the vector.
-                        // With the lock threads attempting to add continuations
-                        // will either:
-                        // - See predecessor_done = true in which case they will
-                        //   call the continuation directly without adding it to
-                        //   the vector of continuations. Accessing the vector
-                        //   below without the lock is safe in this case because
-                        //   the vector is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done after taking
-                        //   the lock they can again release the lock and call
-                        //   the continuation directly. Accessing the vector
-                        //   without the lock is again safe because the vector
-                        //   is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done is still
-                        //   false after taking the lock, they will proceed to
-                        //   add a continuation to the vector. Since they keep
-                        //   the lock they can safely write to the vector. This
-                        //   thread will not proceed past the lock until they
-                        //   have finished writing to the vector.
-                        //
-                        // Importantly, once this thread has taken and released
-                        // this lock, threads attempting to add continuations to
-                        // the vector must see predecessor_done = true after
-                        // taking the lock in their threads and will not add
-                        // continuations to the vector.
-                        std::unique_lock l{mtx};
+                        c->complete(c);
+                        return;
                     }
 
-                    if (!continuations.empty())
+                    // The stack holds the continuations in reverse order,
+                    // complete them in the order they were added.
+                    split_continuation* head = nullptr;
+                    while (c != nullptr)
                     {
-                        for (auto const& continuation : continuations)
-                        {
-                            continuation();
-                        }
+                        split_continuation* next = c->next;
+                        c->next = head;
+                        head = c;
+                        c = next;
+                    }
 
-                        continuations.clear();
+                    while (head != nullptr)
+                    {
+                        // the continuation may be destroyed by completing it
+                        split_continuation* next = head->next;
+                        head->complete(head);
+                        head = next;
                     }
                 }
 
-                template <typename Receiver>
-                void add_continuation(Receiver& receiver) = delete;
-
-                template <typename Receiver>
-                void add_continuation(Receiver&& receiver)
+                void add_continuation(split_continuation* c) noexcept
                 {
-                    if (predecessor_done)
-                    {
-                        // If we read predecessor_done here it means that one of
-                        // set_error/set_stopped/set_value has been called and
-                        // values/errors have been stored into the shared state.
-                        // We can trigger the continuation directly.
-                        // TODO: Should this preserve the scheduler? It does not
-                        // if we call set_* inline.
-                        hpx::visit(
-                            done_error_value_visitor<Receiver>{
-                                HPX_FORWARD(Receiver, receiver)},
-                            v);
-                    }
-                    else
+                    void* head = continuations.load(std::memory_order_acquire);
+                    do
                     {
-                        // If predecessor_done is false, we have to take the
-                        // lock to potentially add the continuation to the
-                        // vector of continuations.
-                        std::unique_lock l{mtx};
-
-                        if (predecessor_done)
-                        {
-                            // By the time the lock has been taken,
-                            // predecessor_done might already be true and we can
-                            // release the lock early and call the continuation
-                            // directly again.
-                            l.unlock();
-                            hpx::visit(
-                                done_error_value_visitor<Receiver>{
-                                    HPX_FORWARD(Receiver, receiver)},
-                                v);
-                        }
-                        else
+                        if (head == static_cast<void*>(this))
                         {
-                            // If predecessor_done is still false, we add the
-                            // continuation to the vector of continuations. This
-                            // has to be done while holding the lock, since
-                            // other threads may also try to add continuations
-                            // to the vector and the vector is not threadsafe in
-                            // itself. The continuation will be called later
-                            // when set_error/set_stopped/set_value is called.
-                            continuations.emplace_back(
-                                [this,
-                                    receiver = HPX_FORWARD(
-                                        Receiver, receiver)]() mutable {
-                                    hpx::visit(
-                                        done_error_value_visitor<Receiver>{
-                                            HPX_MOVE(receiver)},
-                                        v);
-                                });
+                            // One of set_error/set_stopped/set_value has been
+                            // called and values/errors have been stored into
+                            // the shared state. We can trigger the
+                            // continuation directly.
+                            // TODO: Should this preserve the scheduler? It
+                            // does not if we call set_* inline.
+                            c->complete(c);
+                            return;
                         }
-                    }
+                        c->next = static_cast<split_continuation*>(head);
+                    } while (!continuations.compare_exchange_weak(head,
+                        static_cast<void*>(c), std::memory_order_release,
+                        std::memory_order_acquire));
                 }
 
                 void start() & noexcept
@@ -533,7 +515,7 @@ namespace hpx::execution::experimental {
             split_sender& operator=(split_sender&&) = default;
 
             template <typename Receiver>
-            struct operation_state
+            struct operation_state : split_continuation
             {
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
                 hpx::intrusive_ptr<shared_state> state;
@@ -541,11 +523,22 @@ namespace hpx::execution::experimental {
                 template <typename Receiver_>
                 operation_state(Receiver_&& receiver,
                     hpx::intrusive_ptr<shared_state> state)
-                  : receiver(HPX_FORWARD(Receiver_, receiver))
+                  : split_continuation(&operation_state::complete_receiver)
+                  , receiver(HPX_FORWARD(Receiver_, receiver))
                   , state(HPX_MOVE(state))
                 {
                 }
 
+                static void complete_receiver(split_continuation* c) noexcept
+                {
+                    using visitor_type = typename shared_state::
+                        template done_error_value_visitor<Receiver>;
+
+                    auto* os = static_cast<operation_state*>(c);
+                    hpx::visit(
+                        visitor_type{HPX_MOVE(os->receiver)}, os->state->v);
+                }
+
                 operation_state(operation_state&&) = delete;
                 operation_state& operator=(operation_state&&) = delete;
                 operation_state(operation_state const&) = delete;
@@ -561,7 +554,7 @@ namespace hpx::execution::experimental {
                         os.state->start();
                     }
 
-                    os.state->add_continuation(HPX_MOVE(os.receiver));
+                    os.state->add_continuation(&os);
                 }
             };
 
@@ -312,6 +312,55 @@ namespace hpx::detail {
         }
     };
 
+    template <>
+    struct async_launch_policy_dispatch<hpx::launch::inline_policy>
+    {
+        template <typename Policy, typename F, typename... Ts>
+        HPX_FORCEINLINE static std::enable_if_t<
+            traits::detail::is_deferred_invocable_v<F, Ts...>,
+            hpx::future<util::detail::invoke_deferred_result_t<F, Ts...>>>
+        call(Policy&& policy, hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, F&& f, Ts&&... ts)
+        {
+            // run the task directly, unless the nesting of directly run
+            // tasks and continuations is too deep
+            if (threads::can_run_continuation_inline())
+            {
+                threads::scoped_continuation_recursion_count cnt;
+                auto ann = hpx::scoped_annotation(desc.get_description());
+                return call_sync(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+            }
+
+            return async_launch_policy_dispatch<hpx::launch::async_policy>::
+                call(HPX_FORWARD(Policy, policy), desc, pool,
+                    HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename Policy, typename F, typename... Ts>
+        HPX_FORCEINLINE static std::enable_if_t<
+            traits::detail::is_deferred_invocable_v<F, Ts...>,
+            hpx::future<util::detail::invoke_deferred_result_t<F, Ts...>>>
+        call(Policy&& policy, hpx::threads::thread_description const& desc,
+            F&& f, Ts&&... ts)
+        {
+            return call(HPX_FORWARD(Policy, policy), desc,
+                threads::detail::get_self_or_default_pool(), HPX_FORWARD(F, f),
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename Policy, typename F, typename... Ts>
+        HPX_FORCEINLINE static std::enable_if_t<
+            traits::detail::is_deferred_invocable_v<F, Ts...>,
+            hpx::future<util::detail::invoke_deferred_result_t<F, Ts...>>>
+        call(Policy&& policy, F&& f, Ts&&... ts)
+        {
+            hpx::threads::thread_description desc(f);
+            return call(HPX_FORWARD(Policy, policy), desc,
+                threads::detail::get_self_or_default_pool(), HPX_FORWARD(F, f),
+                HPX_FORWARD(Ts, ts)...);
+        }
+    };
+
     template <typename Action>
     struct async_launch_policy_dispatch<Action,
         std::enable_if_t<!traits::is_action_v<Action>>>
@@ -347,6 +396,12 @@ namespace hpx::detail {
                     hpx::launch::fork_policy>::call(HPX_MOVE(policy), desc,
                     pool, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
             }
+            if (policy == launch::inline_)
+            {
+                return async_launch_policy_dispatch<
+                    hpx::launch::inline_policy>::call(HPX_MOVE(policy), desc,
+                    pool, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+            }
 
             return async_launch_policy_dispatch<
                 hpx::launch::async_policy>::call(HPX_MOVE(policy), desc, pool,
@@ -65,9 +65,8 @@ namespace hpx::lcos::detail {
             using continuation_result_type =
                 hpx::util::invoke_result_t<F, Future>;
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::thread_local_size_class_allocator<
+                char, hpx::util::internal_allocator<>>;
 
             hpx::traits::detail::shared_state_ptr_t<result_type> p =
                 detail::make_continuation_alloc<continuation_result_type>(
@@ -156,23 +155,25 @@ namespace hpx::lcos::detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // Spawns the continuation as a new thread, using the scheduling
+    // properties of the continuation's launch policy.
     struct post_policy_spawner
     {
         template <typename F>
         void operator()(F&& f, hpx::threads::thread_description desc,
-            threads::thread_id_ref_type& id) const
+            threads::thread_id_ref_type& id, launch const& policy) const
         {
             threads::thread_init_data data(
                 threads::make_thread_function_nullary(HPX_FORWARD(F, f)),
-                HPX_MOVE(desc), threads::thread_priority::default_,
-                threads::thread_schedule_hint(),
-                threads::thread_stacksize::default_,
-                threads::thread_schedule_state::pending);
+                HPX_MOVE(desc), policy.priority(), policy.hint(),
+                policy.stacksize(), threads::thread_schedule_state::pending);
 
             threads::register_thread(data, id);
         }
     };
 
+    // Spawns the continuation on the given executor, the executor's
+    // scheduling properties take precedence over the launch policy.
     template <typename Executor>
     struct executor_spawner
     {
@@ -180,7 +181,7 @@ namespace hpx::lcos::detail {
 
         template <typename F>
         void operator()(F&& f, hpx::threads::thread_description,
-            threads::thread_id_ref_type& id) const
+            threads::thread_id_ref_type& id, launch const&) const
         {
             id = threads::invalid_thread_id;
             hpx::parallel::execution::post(exec, HPX_FORWARD(F, f));
@@ -193,17 +194,19 @@ namespace hpx::lcos::detail {
     make_continuation(Future&& future, Policy&& policy, F&& f)
     {
         using result_type = continuation_result_t<ContResult>;
-        using shared_state = detail::continuation<Future, F, result_type>;
-        using init_no_addref = typename shared_state::init_no_addref;
         using spawner_type = post_policy_spawner;
+        using shared_state =
+            detail::continuation<Future, F, result_type, spawner_type>;
+        using init_no_addref = typename shared_state::init_no_addref;
 
         // create a continuation
         traits::detail::shared_state_ptr_t<result_type> p(
-            new shared_state(init_no_addref{}, HPX_FORWARD(F, f)), false);
+            new shared_state(
+                init_no_addref{}, HPX_FORWARD(F, f), spawner_type{}),
+            false);
 
         static_cast<shared_state*>(p.get())->template attach<true>(
-            HPX_FORWARD(Future, future), spawner_type{},
-            HPX_FORWARD(Policy, policy));
+            HPX_FORWARD(Future, future), HPX_FORWARD(Policy, policy));
 
         return p;
     }
@@ -218,8 +221,10 @@ namespace hpx::lcos::detail {
         using result_type = continuation_result_t<ContResult>;
 
         using base_allocator = Allocator;
+        using spawner_type = post_policy_spawner;
         using shared_state = traits::shared_state_allocator_t<
-            detail::continuation<Future, F, result_type>, base_allocator>;
+            detail::continuation<Future, F, result_type, spawner_type>,
+            base_allocator>;
 
         using other_allocator = typename std::allocator_traits<
             base_allocator>::template rebind_alloc<shared_state>;
@@ -230,21 +235,18 @@ namespace hpx::lcos::detail {
         using unique_ptr = std::unique_ptr<shared_state,
             util::allocator_deleter<other_allocator>>;
 
-        using spawner_type = post_policy_spawner;
-
         other_allocator alloc(a);
         unique_ptr p(traits::allocate(alloc, 1),
             util::allocator_deleter<other_allocator>{alloc});
-        traits::construct(
-            alloc, p.get(), init_no_addref{}, alloc, HPX_FORWARD(F, f));
+        traits::construct(alloc, p.get(), init_no_addref{}, alloc,
+            HPX_FORWARD(F, f), spawner_type{});
 
         // create a continuation
         hpx::traits::detail::shared_state_ptr_t<result_type> r(
             p.release(), false);
 
         static_cast<shared_state*>(r.get())->template attach<true>(
-            HPX_FORWARD(Future, future), spawner_type{},
-            HPX_FORWARD(Policy, policy));
+            HPX_FORWARD(Future, future), HPX_FORWARD(Policy, policy));
 
         return r;
     }
@@ -260,8 +262,10 @@ namespace hpx::lcos::detail {
         using result_type = ContResult;
 
         using base_allocator = Allocator;
+        using spawner_type = post_policy_spawner;
         using shared_state = traits::shared_state_allocator_t<
-            detail::continuation<Future, F, result_type>, base_allocator>;
+            detail::continuation<Future, F, result_type, spawner_type>,
+            base_allocator>;
 
         using other_allocator = typename std::allocator_traits<
             base_allocator>::template rebind_alloc<shared_state>;
@@ -272,21 +276,18 @@ namespace hpx::lcos::detail {
         using unique_ptr = std::unique_ptr<shared_state,
             util::allocator_deleter<other_allocator>>;
 
-        using spawner_type = post_policy_spawner;
-
         other_allocator alloc(a);
         unique_ptr p(traits::allocate(alloc, 1),
             util::allocator_deleter<other_allocator>{alloc});
-        traits::construct(
-            alloc, p.get(), init_no_addref{}, alloc, HPX_FORWARD(F, f));
+        traits::construct(alloc, p.get(), init_no_addref{}, alloc,
+            HPX_FORWARD(F, f), spawner_type{});
 
         // create a continuation
         hpx::traits::detail::shared_state_ptr_t<result_type> r(
             p.release(), false);
 
         static_cast<shared_state*>(r.get())->template attach<false>(
-            HPX_FORWARD(Future, future), spawner_type{},
-            HPX_FORWARD(Policy, policy));
+            HPX_FORWARD(Future, future), HPX_FORWARD(Policy, policy));
 
         return r;
     }
@@ -297,18 +298,19 @@ namespace hpx::lcos::detail {
     make_continuation_exec_policy(
         Future&& future, Executor&& exec, Policy&& policy, F&& f)
     {
-        using shared_state = detail::continuation<Future, F, ContResult>;
-        using init_no_addref = typename shared_state::init_no_addref;
         using spawner_type = executor_spawner<std::decay_t<Executor>>;
+        using shared_state =
+            detail::continuation<Future, F, ContResult, spawner_type>;
+        using init_no_addref = typename shared_state::init_no_addref;
 
         // create a continuation
         traits::detail::shared_state_ptr_t<ContResult> p(
-            new shared_state(init_no_addref{}, HPX_FORWARD(F, f)), false);
+            new shared_state(init_no_addref{}, HPX_FORWARD(F, f),
+                spawner_type{HPX_FORWARD(Executor, exec)}),
+            false);
 
         static_cast<shared_state*>(p.get())->template attach<false>(
-            HPX_FORWARD(Future, future),
-            spawner_type{HPX_FORWARD(Executor, exec)},
-            HPX_FORWARD(Policy, policy));
+            HPX_FORWARD(Future, future), HPX_FORWARD(Policy, policy));
 
         return p;
     }
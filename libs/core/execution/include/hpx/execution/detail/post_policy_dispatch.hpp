@@ -160,6 +160,41 @@ namespace hpx::detail {
         }
     };
 
+    template <>
+    struct post_policy_dispatch<launch::inline_policy>
+    {
+        template <typename Policy, typename F, typename... Ts>
+        static void call(Policy&& policy,
+            hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, F&& f, Ts&&... ts)
+        {
+            // run the task directly, unless the nesting of directly run
+            // tasks and continuations is too deep
+            if (threads::can_run_continuation_inline())
+            {
+                threads::scoped_continuation_recursion_count cnt;
+                hpx::detail::sync_launch_policy_dispatch<
+                    launch::sync_policy>::call(HPX_FORWARD(Policy, policy),
+                    HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+            }
+            else
+            {
+                post_policy_dispatch<launch::async_policy>::call(
+                    HPX_FORWARD(Policy, policy), desc, pool, HPX_FORWARD(F, f),
+                    HPX_FORWARD(Ts, ts)...);
+            }
+        }
+
+        template <typename Policy, typename F, typename... Ts>
+        static void call(Policy&& policy,
+            hpx::threads::thread_description const& desc, F&& f, Ts&&... ts)
+        {
+            call(HPX_FORWARD(Policy, policy), desc,
+                threads::detail::get_self_or_default_pool(), HPX_FORWARD(F, f),
+                HPX_FORWARD(Ts, ts)...);
+        }
+    };
+
     template <typename Policy>
     struct post_policy_dispatch
     {
@@ -189,6 +224,12 @@ namespace hpx::detail {
                     HPX_MOVE(policy), desc, pool, HPX_FORWARD(F, f),
                     HPX_FORWARD(Ts, ts)...);
             }
+            else if (policy == launch::inline_)
+            {
+                post_policy_dispatch<launch::inline_policy>::call(
+                    HPX_MOVE(policy), desc, pool, HPX_FORWARD(F, f),
+                    HPX_FORWARD(Ts, ts)...);
+            }
             else
             {
                 post_policy_dispatch<launch::async_policy>::call(
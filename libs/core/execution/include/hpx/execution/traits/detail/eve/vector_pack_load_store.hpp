@@ -14,6 +14,7 @@
 #include <eve/module/core.hpp>
 
 #include <memory>
+#include <type_traits>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::parallel::traits {
@@ -29,10 +30,18 @@ namespace hpx::parallel::traits {
                 eve::as_aligned(std::addressof(*iter), eve::cardinal_t<V>{}));
         }
 
+        // scalar packs are represented by the plain value type
         template <typename Iter>
         HPX_HOST_DEVICE HPX_FORCEINLINE static V unaligned(Iter const& iter)
         {
-            return *iter;
+            if constexpr (std::is_arithmetic_v<V>)
+            {
+                return *iter;
+            }
+            else
+            {
+                return V(std::addressof(*iter));
+            }
         }
     };
 
@@ -52,8 +61,14 @@ namespace hpx::parallel::traits {
         HPX_HOST_DEVICE HPX_FORCEINLINE static void unaligned(
             V& value, Iter const& iter)
         {
-            *iter = value;
-            return;
+            if constexpr (std::is_arithmetic_v<V>)
+            {
+                *iter = value;
+            }
+            else
+            {
+                eve::store(value, std::addressof(*iter));
+            }
         }
     };
 }    // namespace hpx::parallel::traits
@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::parallel::traits {
@@ -31,10 +32,19 @@ namespace hpx::parallel::traits {
                 std::addressof(*iter), datapar::experimental::vector_aligned);
         }
 
+        // scalar packs are represented by the plain value type
         template <typename Iter>
         HPX_HOST_DEVICE HPX_FORCEINLINE static V unaligned(Iter const& iter)
         {
-            return *iter;
+            if constexpr (std::is_arithmetic_v<V>)
+            {
+                return *iter;
+            }
+            else
+            {
+                return V(std::addressof(*iter),
+                    datapar::experimental::element_aligned);
+            }
         }
     };
 
@@ -54,7 +64,15 @@ namespace hpx::parallel::traits {
         HPX_HOST_DEVICE HPX_FORCEINLINE static void unaligned(
             V& value, Iter const& iter)
         {
-            *iter = value;
+            if constexpr (std::is_arithmetic_v<V>)
+            {
+                *iter = value;
+            }
+            else
+            {
+                value.copy_to(std::addressof(*iter),
+                    datapar::experimental::element_aligned);
+            }
         }
     };
 }    // namespace hpx::parallel::traits
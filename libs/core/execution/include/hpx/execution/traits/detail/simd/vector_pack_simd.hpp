@@ -25,6 +25,7 @@ namespace hpx::datapar::experimental {
 
     using std::experimental::simd_abi::native;
 
+    using std::experimental::element_aligned;
     using std::experimental::memory_alignment_v;
     using std::experimental::vector_aligned;
 
@@ -185,6 +185,19 @@ int main()
         HPX_TEST(set_value_called);
     }
 
+    // values sent as references by the predecessor are stored by value
+    {
+        std::atomic<bool> set_value_called{false};
+        std::string const value(100, 'a');
+        auto s = ex::split(ex::ensure_started(ex::just(value)));
+
+        auto f = [&](std::string const& x) { HPX_TEST_EQ(x, value); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
     // operator| overload
     {
         std::atomic<bool> set_value_called{false};
@@ -263,7 +263,7 @@ namespace hpx::lcos::detail {
 
         template <typename Futures_>
         HPX_FORCEINLINE void finalize(
-            hpx::detail::sync_policy, Futures_&& futures)
+            hpx::detail::sync_policy policy, Futures_&& futures)
         {
             // We need to run the completion on a new thread if we are on a
             // non HPX thread.
@@ -296,7 +296,30 @@ namespace hpx::lcos::detail {
             }
             else
             {
-                finalize(hpx::launch::async, HPX_FORWARD(Futures_, futures));
+                finalize(hpx::detail::async_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
+            }
+        }
+
+        template <typename Futures_>
+        void finalize(hpx::detail::inline_policy policy, Futures_&& futures)
+        {
+            // run the function directly, unless the nesting of directly run
+            // continuations is too deep
+            if (threads::can_run_continuation_inline())
+            {
+                threads::scoped_continuation_recursion_count cnt;
+                hpx::scoped_annotation annotate(func_);
+                execute(HPX_FORWARD(Futures_, futures));
+            }
+            else
+            {
+                // run the function on a new thread that is scheduled next on
+                // this core, as it would have been run right away otherwise
+                finalize(hpx::detail::fork_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
             }
         }
 
@@ -305,15 +328,27 @@ namespace hpx::lcos::detail {
         {
             if (policy == launch::sync)
             {
-                finalize(launch::sync, HPX_FORWARD(Futures_, futures));
+                finalize(hpx::detail::sync_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
             }
             else if (policy == launch::fork)
             {
-                finalize(launch::fork, HPX_FORWARD(Futures_, futures));
+                finalize(hpx::detail::fork_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
+            }
+            else if (policy == launch::inline_)
+            {
+                finalize(hpx::detail::inline_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
             }
             else
             {
-                finalize(launch::async, HPX_FORWARD(Futures_, futures));
+                finalize(hpx::detail::async_policy(policy.priority(),
+                             policy.stacksize(), policy.hint()),
+                    HPX_FORWARD(Futures_, futures));
             }
         }
 
@@ -359,6 +394,9 @@ namespace hpx::lcos::detail {
         auto operator()(util::async_traverse_visit_tag, T&& current)
             -> decltype(async_visit_future(HPX_FORWARD(T, current)))
         {
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+            hpx::lcos::detail::inherit_scheduling(*this, current);
+#endif
             return async_visit_future(HPX_FORWARD(T, current));
         }
 
@@ -378,6 +416,18 @@ namespace hpx::lcos::detail {
         HPX_FORCEINLINE void operator()(
             util::async_traverse_complete_tag, Futures_&& futures)
         {
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+            // the function runs with the scheduling properties inherited from
+            // the futures it depends on, unless the launch policy specifies
+            // those explicitly (executors always use their own)
+            if constexpr (traits::is_launch_policy_v<Policy>)
+            {
+                this->set_scheduling(policy_.priority(), policy_.hint());
+                finalize(this->scheduling_policy(policy_),
+                    HPX_FORWARD(Futures_, futures));
+                return;
+            }
+#endif
             finalize(policy_, HPX_FORWARD(Futures_, futures));
         }
 
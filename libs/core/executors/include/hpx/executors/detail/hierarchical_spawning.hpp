@@ -24,13 +24,17 @@
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/properties/property.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -40,6 +44,111 @@
 
 namespace hpx::parallel::execution::detail {
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Tasks running the chunks of a bulk operation are run on small stacks by
+    // default. If the launch policy explicitly asks for stackless threads
+    // (thread_stacksize::nostack), the chunks are run as stackless threads
+    // instead. This avoids allocating a stack and switching contexts for each
+    // of the chunks, but requires that the chunks never suspend.
+    template <typename Launch>
+    constexpr threads::thread_stacksize get_bulk_chunk_stacksize(
+        Launch const& policy) noexcept
+    {
+        if (hpx::execution::experimental::get_stacksize(policy) ==
+            threads::thread_stacksize::nostack)
+        {
+            return threads::thread_stacksize::nostack;
+        }
+        return threads::thread_stacksize::small_;
+    }
+
+    // Tasks that merely spawn other tasks never suspend, thus they can always
+    // be run as stackless threads. This is true only if the launch policy
+    // creates new threads without suspending the spawning thread (fork
+    // suspends the spawning thread, sync runs the spawned work inline).
+    template <typename Launch>
+    constexpr threads::thread_stacksize get_bulk_spawn_stacksize(
+        Launch const& policy) noexcept
+    {
+        if (policy.get_policy() == hpx::detail::launch_policy::async)
+        {
+            return threads::thread_stacksize::nostack;
+        }
+        return threads::thread_stacksize::small_;
+    }
+
+    // Tasks waiting for other tasks to finish need a stack.
+    template <typename Launch>
+    constexpr threads::thread_stacksize get_bulk_wait_stacksize(
+        Launch const& policy) noexcept
+    {
+        auto const stacksize =
+            hpx::execution::experimental::get_stacksize(policy);
+        if (stacksize == threads::thread_stacksize::nostack)
+        {
+            return threads::thread_stacksize::default_;
+        }
+        return stacksize;
+    }
+
+    // Stackless threads must never suspend, but acquiring the lock of a latch
+    // or of a shared state may have to wait for it if another thread holds it.
+    // The given function is therefore run on a new thread with a stack if the
+    // current thread is stackless.
+    template <typename F>
+    void invoke_on_stackful_thread(threads::thread_pool_base* pool, F&& f)
+    {
+        auto const* self = threads::get_self_id_data();
+        if (self == nullptr || !self->is_stackless())
+        {
+            HPX_INVOKE(f);
+            return;
+        }
+
+        threads::thread_init_data data(
+            threads::make_thread_function_nullary(HPX_FORWARD(F, f)),
+            "invoke_on_stackful_thread", threads::thread_priority::boost,
+            threads::thread_schedule_hint(), threads::thread_stacksize::small_,
+            threads::thread_schedule_state::pending);
+        threads::register_work(data, pool);
+    }
+
+    // Counts the finished chunks of a bulk operation. The chunks decrement an
+    // atomic counter only, which never suspends. The last one to finish
+    // releases the waiting thread, using a stackful thread if needed.
+    class bulk_countdown
+    {
+    public:
+        bulk_countdown(
+            threads::thread_pool_base* pool, std::size_t count) noexcept
+          : pool_(pool)
+          , remaining_(count + 1)
+          , l_(1)
+        {
+        }
+
+        void count_down(std::size_t n)
+        {
+            if (n != 0 &&
+                remaining_.fetch_sub(n, std::memory_order_acq_rel) == n)
+            {
+                invoke_on_stackful_thread(pool_, [this] { l_.count_down(1); });
+            }
+        }
+
+        // the waiting thread is counted as well, it must have a stack
+        void arrive_and_wait()
+        {
+            count_down(1);
+            l_.wait();
+        }
+
+    private:
+        threads::thread_pool_base* pool_;
+        std::atomic<std::size_t> remaining_;
+        hpx::latch l_;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     template <typename Launch, typename F, typename S, typename... Ts>
     std::vector<hpx::future<detail::bulk_function_result_t<F, S, Ts...>>>
@@ -58,10 +167,15 @@ namespace hpx::parallel::execution::detail {
         std::size_t const size = hpx::util::size(shape);
         results.resize(size);
 
+        // the spawning tasks only launch the tasks running the chunks
         auto post_policy = hpx::execution::experimental::with_stacksize(
-            policy, threads::thread_stacksize::small_);
+            policy, get_bulk_spawn_stacksize(policy));
+
+        // the tasks spawning the chunks apply the deadline set by the
+        // executor to the chunks as well
+        std::uint64_t const deadline = threads::get_scoped_deadline();
 
-        hpx::latch l(size + 1);
+        bulk_countdown l(pool, size);
         std::size_t part_begin = 0;
         auto it = std::begin(shape);
         for (std::size_t t = 0; t != num_threads; ++t)
@@ -79,6 +193,8 @@ namespace hpx::parallel::execution::detail {
                 hpx::detail::post_policy_dispatch<Launch>::call(post_policy,
                     desc, pool,
                     [&, part_begin, part_end, part_size, f, it]() mutable {
+                        threads::scoped_thread_deadline scoped_deadline(
+                            deadline);
                         for (std::size_t part_i = part_begin;
                              part_i != part_end; ++part_i)
                         {
@@ -127,20 +243,33 @@ namespace hpx::parallel::execution::detail {
     {
         HPX_ASSERT(pool);
 
+        // the task scheduling the chunks waits for all of them to finish
+        auto wait_policy = hpx::execution::experimental::with_stacksize(
+            policy, get_bulk_wait_stacksize(policy));
+
+        // the task scheduling the chunks applies the deadline set by the
+        // executor to the chunks as well
+        std::uint64_t const deadline = threads::get_scoped_deadline();
+
         return hpx::detail::async_launch_policy_dispatch<Launch>::call(
-            policy, desc, pool,
-            [](hpx::threads::thread_description const& desc,
+            wait_policy, desc, pool,
+            [deadline](hpx::threads::thread_description const& desc,
                 threads::thread_pool_base* pool, std::size_t first_thread,
                 std::size_t num_threads, std::size_t hierarchical_threshold,
                 Launch policy, std::decay_t<F> f, S const& shape,
                 std::decay_t<Ts>... ts) {
+                threads::scoped_thread_deadline scoped_deadline(deadline);
+
                 std::size_t const size = hpx::util::size(shape);
+                // the spawning tasks run the last of their chunks directly
                 auto post_policy = hpx::execution::experimental::with_stacksize(
-                    policy, threads::thread_stacksize::small_);
+                    policy, get_bulk_chunk_stacksize(policy));
 
+                // the chunks may run as stackless threads which can't yield,
+                // thus the first exception is stored without taking a lock
                 std::exception_ptr e;
-                hpx::spinlock mtx_e;
-                hpx::latch l(size + 1);
+                std::atomic<bool> has_exception(false);
+                bulk_countdown l(pool, size);
 
                 auto wrapped = [&, f](auto&&... args) mutable {
                     // properly handle all exceptions thrown from 'f'
@@ -150,9 +279,11 @@ namespace hpx::parallel::execution::detail {
                         },
                         [&](std::exception_ptr ep) {
                             // store the first caught exception only
-                            std::lock_guard<hpx::spinlock> lg(mtx_e);
-                            if (!e)
+                            if (!has_exception.exchange(
+                                    true, std::memory_order_relaxed))
+                            {
                                 e = HPX_MOVE(ep);
+                            }
                         });
                     l.count_down(1);
                 };
@@ -171,6 +302,9 @@ namespace hpx::parallel::execution::detail {
 
                     auto&& launcher = [&, wrapped, begin, end, it](
                                           bool direct) mutable {
+                        threads::scoped_thread_deadline scoped_deadline(
+                            deadline);
+
                         // launch N-1 tasks
                         auto iter = it;
                         for (std::size_t i = begin + direct; i != end;
@@ -210,9 +344,9 @@ namespace hpx::parallel::execution::detail {
                 l.arrive_and_wait();
 
                 // rethrow any exceptions caught during processing the
-                // bulk_execute, note that we don't need to acquire the lock at
-                // this point as no other threads may access the exception
-                // concurrently
+                // bulk_execute, the countdown synchronizes with the thread
+                // that has stored the exception and no other threads may
+                // access it concurrently
                 if (e)
                 {
                     std::rethrow_exception(HPX_MOVE(e));
@@ -281,9 +415,15 @@ namespace hpx::parallel::execution::detail {
         using future_type = std::decay_t<Future>;
 
         // vector<future<func_result_type>> -> vector<func_result_type>
+        // the continuation waits for all chunks to finish, thus it can't be
+        // run as a stackless thread
+        auto cont_executor = hpx::experimental::prefer(
+            hpx::execution::experimental::with_stacksize, executor,
+            get_bulk_wait_stacksize(policy));
+
         shared_state_type p = hpx::lcos::detail::make_continuation_exec_policy<
-            vector_result_type>(HPX_FORWARD(Future, predecessor), executor,
-            policy,
+            vector_result_type>(HPX_FORWARD(Future, predecessor),
+            HPX_MOVE(cont_executor), policy,
             [func = HPX_MOVE(func)](
                 future_type&& predecessor) mutable -> vector_result_type {
                 // use unwrap directly (instead of lazily) to avoid
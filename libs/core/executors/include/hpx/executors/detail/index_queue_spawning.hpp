@@ -25,6 +25,8 @@
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -150,33 +152,40 @@ namespace hpx::parallel::execution::detail {
         // Finish the work for one worker thread. If this is not the last worker
         // thread to finish, it will only decrement the counter. If it is the
         // last thread it will call set_exception if there is an exception.
-        // Otherwise it will call set_value on the shared state.
+        // Otherwise it will call set_value on the shared state. Setting the
+        // shared state is done on a stackful thread as it acquires a lock.
         void finish() const
         {
             if (--(state->tasks_remaining.data_) == 0)
             {
-                if (state->bad_alloc_thrown.load(std::memory_order_relaxed))
-                {
-                    try
-                    {
-                        throw std::bad_alloc();
-                    }
-                    catch (...)
-                    {
-                        state->set_exception(std::current_exception());
-                    }
-                }
-                else if (state->exceptions.size() != 0)
+                invoke_on_stackful_thread(
+                    state->pool, [state = state]() { complete(*state); });
+            }
+        }
+
+        static void complete(SharedState& state)
+        {
+            if (state.bad_alloc_thrown.load(std::memory_order_relaxed))
+            {
+                try
                 {
-                    state->set_exception(
-                        hpx::detail::construct_lightweight_exception(
-                            HPX_MOVE(state->exceptions)));
+                    throw std::bad_alloc();
                 }
-                else
+                catch (...)
                 {
-                    state->set_data(hpx::util::unused);
+                    state.set_exception(std::current_exception());
                 }
             }
+            else if (state.exceptions.size() != 0)
+            {
+                state.set_exception(
+                    hpx::detail::construct_lightweight_exception(
+                        HPX_MOVE(state.exceptions)));
+            }
+            else
+            {
+                state.set_data(hpx::util::unused);
+            }
         }
 
         // Entry point for the worker thread. It will attempt to do its local
@@ -298,11 +307,20 @@ namespace hpx::parallel::execution::detail {
                 part_begin, part_end, static_cast<std::uint32_t>(num_threads));
         }
 
+        // The tasks for all worker threads are created as one batch if the
+        // launch policy simply posts new threads.
+        bool use_batch() const noexcept
+        {
+            return policy.get_policy() == hpx::detail::launch_policy::async;
+        }
+
         // Spawn a task which will process a number of chunks. If the queue
-        // contains no chunks no task will be spawned.
+        // contains no chunks no task will be spawned. If a batch is given the
+        // data for creating the task is added to it instead.
         template <typename Task>
         void do_work_task(hpx::threads::thread_description const& desc,
             threads::thread_pool_base* pool, bool dont_bind_to_core,
+            std::vector<threads::thread_init_data>* batch,
             Task&& task_f) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
@@ -314,9 +332,9 @@ namespace hpx::parallel::execution::detail {
                 return;
             }
 
-            // run task on small stack
+            // run task on small stack, or stackless if requested
             auto post_policy = hpx::execution::experimental::with_stacksize(
-                policy, threads::thread_stacksize::small_);
+                policy, get_bulk_chunk_stacksize(policy));
 
             if (dont_bind_to_core)
             {
@@ -334,7 +352,29 @@ namespace hpx::parallel::execution::detail {
 
             // launch task on new HPX-thread
             auto hint = hpx::execution::experimental::get_hint(policy);
-            if (hint.mode == hpx::threads::thread_schedule_hint_mode::none &&
+            if (batch != nullptr)
+            {
+                if (hint.mode ==
+                        hpx::threads::thread_schedule_hint_mode::none &&
+                    hint.hint == -1)
+                {
+                    hint.mode = hpx::threads::thread_schedule_hint_mode::thread;
+                    hint.hint = worker_thread + first_thread;
+                }
+
+                // run_as_child doesn't make sense for posted tasks
+                hint.runs_as_child_mode(
+                    hpx::threads::thread_execution_hint::none);
+
+                batch->emplace_back(
+                    threads::make_thread_function_nullary(
+                        HPX_FORWARD(Task, task_f)),
+                    desc, post_policy.priority(), hint,
+                    post_policy.stacksize(),
+                    threads::thread_schedule_state::pending);
+            }
+            else if (hint.mode ==
+                    hpx::threads::thread_schedule_hint_mode::none &&
                 hint.hint == -1)
             {
                 // apply hint if none was given
@@ -374,6 +414,8 @@ namespace hpx::parallel::execution::detail {
         void execute(hpx::threads::thread_description const& desc,
             threads::thread_pool_base* pool)
         {
+            this->pool = pool;
+
             auto const size =
                 static_cast<std::uint32_t>(hpx::util::size(shape));
 
@@ -439,6 +481,15 @@ namespace hpx::parallel::execution::detail {
             bool allow_stealing =
                 !hpx::threads::do_not_share_function(hint.sharing_mode());
 
+            // collect the tasks for all worker threads to create them at once
+            std::vector<threads::thread_init_data> tasks;
+            std::vector<threads::thread_init_data>* batch = nullptr;
+            if (use_batch())
+            {
+                tasks.reserve(num_threads);
+                batch = &tasks;
+            }
+
             for (std::uint32_t pu = 0;
                  worker_thread != num_threads && pu != num_pus; ++pu)
             {
@@ -471,7 +522,7 @@ namespace hpx::parallel::execution::detail {
                 }
 
                 // Schedule task for this worker thread
-                do_work_task(desc, pool, false,
+                do_work_task(desc, pool, false, batch,
                     task_function<index_queue_bulk_state>{
                         hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
                         chunk_size, worker_thread, reverse_placement,
@@ -488,14 +539,20 @@ namespace hpx::parallel::execution::detail {
             if (main_thread_ok)
             {
                 // Handle the queue for the local thread.
-                do_work_task(desc, pool, true,
+                do_work_task(desc, pool, true, batch,
                     task_function<index_queue_bulk_state>{
                         hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
                         chunk_size, local_worker_thread, reverse_placement,
                         allow_stealing});
             }
+
+            if (!tasks.empty())
+            {
+                hpx::threads::register_work_batch(tasks, pool);
+            }
         }
 
+        threads::thread_pool_base* pool = nullptr;
         std::uint32_t first_thread;
         std::size_t num_threads;
         Launch policy;
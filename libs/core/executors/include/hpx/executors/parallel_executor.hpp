@@ -34,10 +34,14 @@
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/detail/get_default_pool.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -84,6 +88,14 @@ namespace hpx::execution {
     ///
     /// This executor conforms to the concepts of a TwoWayExecutor,
     /// and a BulkTwoWayExecutor
+    ///
+    /// The chunks of bulk operations are run on threads with small stacks.
+    /// If the executor was asked to use \a thread_stacksize::nostack (see
+    /// \a hpx::execution::experimental::with_stacksize), the chunks are run as
+    /// stackless threads instead, which avoids allocating a stack and
+    /// switching contexts for each of them. The executed function must not
+    /// suspend in this case (no blocking synchronization, no waiting for
+    /// futures).
     template <typename Policy>
     struct parallel_policy_executor
     {
@@ -272,6 +284,28 @@ namespace hpx::execution {
             return exec.get_first_core();
         }
 
+        // clang-format off
+        template <typename Executor_,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_convertible_v<Executor_, parallel_policy_executor>
+            )>
+        // clang-format on
+        friend constexpr auto tag_invoke(
+            hpx::execution::experimental::with_deadline_t,
+            Executor_ const& exec, std::chrono::nanoseconds deadline) noexcept
+        {
+            auto exec_with_deadline = exec;
+            exec_with_deadline.deadline_ = deadline;
+            return exec_with_deadline;
+        }
+
+        friend constexpr std::chrono::nanoseconds tag_invoke(
+            hpx::execution::experimental::get_deadline_t,
+            parallel_policy_executor const& exec) noexcept
+        {
+            return exec.deadline_;
+        }
+
         friend auto tag_invoke(
             hpx::execution::experimental::get_processing_units_mask_t,
             parallel_policy_executor const& exec)
@@ -307,7 +341,8 @@ namespace hpx::execution {
             parallel_policy_executor const& rhs) const noexcept
         {
             return policy_ == rhs.policy_ && pool_ == rhs.pool_ &&
-                hierarchical_threshold_ == rhs.hierarchical_threshold_;
+                hierarchical_threshold_ == rhs.hierarchical_threshold_ &&
+                deadline_ == rhs.deadline_;
         }
 
         constexpr bool operator!=(
@@ -367,6 +402,8 @@ namespace hpx::execution {
             auto pool = exec.pool_ ?
                 exec.pool_ :
                 threads::detail::get_self_or_default_pool();
+            threads::scoped_thread_deadline deadline(
+                exec.get_thread_deadline());
             return hpx::detail::async_launch_policy_dispatch<Policy>::call(
                 exec.policy_, desc, pool, HPX_FORWARD(F, f),
                 HPX_FORWARD(Ts, ts)...);
@@ -390,13 +427,25 @@ namespace hpx::execution {
                 hpx::bind_back(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
 #endif
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
-            hpx::traits::detail::shared_state_ptr_t<result_type> p =
-                lcos::detail::make_continuation_alloc_nounwrap<result_type>(
-                    allocator_type{}, HPX_FORWARD(Future, predecessor),
-                    exec.policy_, HPX_MOVE(func));
+            hpx::traits::detail::shared_state_ptr_t<result_type> p;
+            if (exec.deadline_.count() > 0)
+            {
+                // spawn the continuation through this executor, which
+                // applies the deadline to the new thread
+                p = lcos::detail::make_continuation_exec_policy<result_type>(
+                    HPX_FORWARD(Future, predecessor), exec, exec.policy_,
+                    HPX_MOVE(func));
+            }
+            else
+            {
+                using allocator_type =
+                    hpx::util::thread_local_size_class_allocator<char,
+                        hpx::util::internal_allocator<>>;
+                p = lcos::detail::make_continuation_alloc_nounwrap<
+                    result_type>(allocator_type{},
+                    HPX_FORWARD(Future, predecessor), exec.policy_,
+                    HPX_MOVE(func));
+            }
 
             return hpx::traits::future_access<hpx::future<result_type>>::create(
                 HPX_MOVE(p));
@@ -413,6 +462,7 @@ namespace hpx::execution {
 #endif
             auto pool =
                 pool_ ? pool_ : threads::detail::get_self_or_default_pool();
+            threads::scoped_thread_deadline deadline(get_thread_deadline());
             hpx::detail::post_policy_dispatch<Policy>::call(
                 policy_, desc, pool, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
         }
@@ -445,6 +495,9 @@ namespace hpx::execution {
                 exec.pool_ :
                 threads::detail::get_self_or_default_pool();
 
+            threads::scoped_thread_deadline deadline(
+                exec.get_thread_deadline());
+
             // use scheduling based on index_queue if no hierarchical threshold
             // is given
             bool const do_not_combine_tasks =
@@ -550,6 +603,18 @@ namespace hpx::execution {
             return first_core_;
         }
 
+        // the deadline of the threads created on behalf of this executor,
+        // work run directly on the calling thread is not affected
+        [[nodiscard]] std::uint64_t get_thread_deadline() const noexcept
+        {
+            if (deadline_.count() <= 0 ||
+                !hpx::detail::has_async_policy(policy_))
+            {
+                return 0;
+            }
+            return threads::make_thread_deadline(deadline_);
+        }
+
         friend class hpx::serialization::access;
 
         template <typename Archive>
@@ -570,6 +635,7 @@ namespace hpx::execution {
         std::size_t hierarchical_threshold_ = hierarchical_threshold_default_;
         std::size_t first_core_ = 0;
         std::size_t num_cores_ = 0;
+        std::chrono::nanoseconds deadline_ = std::chrono::nanoseconds(0);
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         char const* annotation_ = nullptr;
 #endif
@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the chunks of bulk operations are run as stackless threads if
+// the parallel_executor was asked to use thread_stacksize::nostack.
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> count_invocations(0);
+std::atomic<std::size_t> count_stackless(0);
+
+bool is_stackless()
+{
+    auto const* thrd = hpx::threads::get_self_id_data();
+    return thrd != nullptr && thrd->is_stackless();
+}
+
+void bulk_test(int, int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+
+    ++count_invocations;
+    if (is_stackless())
+    {
+        ++count_stackless;
+    }
+}
+
+int bulk_test_result(int value, int passed_through)
+{
+    bulk_test(value, passed_through);
+    return value;
+}
+
+void reset_counts()
+{
+    count_invocations = 0;
+    count_stackless = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The hierarchical scheduling runs the last chunk directly on the thread that
+// waits for all chunks to finish.
+template <typename Executor>
+void test_bulk_async(
+    Executor const& exec, bool expect_stackless, std::size_t run_directly)
+{
+    std::vector<int> v(1007);
+    std::iota(v.begin(), v.end(), 0);
+
+    reset_counts();
+    hpx::parallel::execution::bulk_async_execute(exec, &bulk_test, v, 42)
+        .get();
+
+    HPX_TEST_EQ(count_invocations.load(), v.size());
+    HPX_TEST_EQ(
+        count_stackless.load(), expect_stackless ? v.size() - run_directly : 0);
+
+    reset_counts();
+    std::vector<hpx::future<int>> results =
+        hpx::parallel::execution::bulk_async_execute(
+            exec, &bulk_test_result, v, 42);
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), v[i]);
+    }
+
+    HPX_TEST_EQ(count_invocations.load(), v.size());
+    HPX_TEST_EQ(count_stackless.load(), expect_stackless ? v.size() : 0);
+}
+
+template <typename Executor>
+void test_bulk_then(
+    Executor const& exec, bool expect_stackless, std::size_t run_directly)
+{
+    std::vector<int> v(1007);
+    std::iota(v.begin(), v.end(), 0);
+
+    reset_counts();
+
+    hpx::shared_future<void> f = hpx::make_ready_future();
+    hpx::parallel::execution::bulk_then_execute(
+        exec,
+        [](int value, hpx::shared_future<void> const&, int passed_through) {
+            bulk_test(value, passed_through);
+        },
+        v, f, 42)
+        .get();
+
+    HPX_TEST_EQ(count_invocations.load(), v.size());
+    HPX_TEST_EQ(
+        count_stackless.load(), expect_stackless ? v.size() - run_directly : 0);
+}
+
+// The chunks finish at about the time the waiting thread starts waiting. The
+// last chunk has to release the waiting thread without suspending, even if
+// the waiting thread holds the lock of the latch at that point.
+template <typename Executor>
+void test_bulk_contended(Executor const& exec)
+{
+    std::vector<int> v(hpx::get_os_thread_count());
+    std::iota(v.begin(), v.end(), 0);
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        reset_counts();
+        hpx::parallel::execution::bulk_async_execute(exec, &bulk_test, v, 42)
+            .get();
+        HPX_TEST_EQ(count_invocations.load(), v.size());
+
+        reset_counts();
+        std::vector<hpx::future<int>> results =
+            hpx::parallel::execution::bulk_async_execute(
+                exec, &bulk_test_result, v, 42);
+        hpx::wait_all(results);
+        HPX_TEST_EQ(count_invocations.load(), v.size());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_executor(
+    hpx::execution::parallel_executor const& exec, std::size_t run_directly)
+{
+    // chunks are run on stackful threads by default
+    test_bulk_async(exec, false, run_directly);
+    test_bulk_then(exec, false, run_directly);
+
+    auto stackless_exec = hpx::execution::experimental::with_stacksize(
+        exec, hpx::threads::thread_stacksize::nostack);
+
+    HPX_TEST(hpx::execution::experimental::get_stacksize(stackless_exec) ==
+        hpx::threads::thread_stacksize::nostack);
+
+    test_bulk_async(stackless_exec, true, run_directly);
+    test_bulk_then(stackless_exec, true, run_directly);
+    test_bulk_contended(stackless_exec);
+}
+
+int hpx_main()
+{
+    // index queue based scheduling
+    test_executor(hpx::execution::parallel_executor(), 0);
+
+    // hierarchical scheduling
+    test_executor(hpx::execution::parallel_executor(
+        hpx::threads::thread_priority::default_,
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_hint(), hpx::launch::async, 16),
+        1);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -14,6 +14,7 @@
 #include <hpx/condition_variable.hpp>
 #include <hpx/execution.hpp>
 #include <hpx/functional.hpp>
+#include <hpx/future.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/mutex.hpp>
@@ -1233,6 +1234,50 @@ void test_split_when_all()
     }
 }
 
+template <typename Algorithm>
+void test_split_fan_out(Algorithm&& algorithm)
+{
+    ex::thread_pool_scheduler sched{};
+
+    // many successors are connected and started concurrently, while the
+    // predecessor is still running or after it has completed already, all
+    // of them have to see its result
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        std::size_t const num_successors = 100;
+        std::atomic<bool> release{false};
+        std::atomic<std::size_t> first_task_calls{0};
+        std::atomic<std::size_t> successor_task_calls{0};
+
+        auto s = algorithm(ex::schedule(sched) | ex::then([&]() {
+            ++first_task_calls;
+            while (!release.load())
+            {
+                hpx::this_thread::yield();
+            }
+            return 42;
+        }));
+
+        std::vector<hpx::future<void>> successors;
+        successors.reserve(num_successors);
+        for (std::size_t j = 0; j != num_successors; ++j)
+        {
+            if (j == num_successors / 2)
+            {
+                release = true;
+            }
+            successors.push_back(hpx::async([&, s]() mutable {
+                HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(std::move(s))), 42);
+                ++successor_task_calls;
+            }));
+        }
+        hpx::wait_all(successors);
+
+        HPX_TEST_EQ(first_task_calls, std::size_t(1));
+        HPX_TEST_EQ(successor_task_calls, num_successors);
+    }
+}
+
 void test_let_value()
 {
     ex::thread_pool_scheduler sched{};
@@ -2222,6 +2267,9 @@ int hpx_main()
     test_ensure_started_when_all();
     test_split();
     test_split_when_all();
+    test_split_fan_out([](auto&& s) { return ex::split(HPX_MOVE(s)); });
+    test_split_fan_out(
+        [](auto&& s) { return ex::split(ex::ensure_started(HPX_MOVE(s))); });
     test_let_value();
     test_let_error();
     test_detach();
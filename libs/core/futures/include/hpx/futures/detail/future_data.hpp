@@ -13,6 +13,7 @@
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/config/defines.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
@@ -236,6 +237,9 @@ namespace hpx::lcos::detail {
           : state_(empty)
           , runs_child_(threads::invalid_thread_id)
         {
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+            init_scheduling();
+#endif
         }
 
         explicit future_data_base(init_no_addref no_addref) noexcept
@@ -243,6 +247,9 @@ namespace hpx::lcos::detail {
           , state_(empty)
           , runs_child_(threads::invalid_thread_id)
         {
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+            init_scheduling();
+#endif
         }
 
         using future_data_refcnt_base::completed_callback_type;
@@ -329,6 +336,94 @@ namespace hpx::lcos::detail {
             on_completed_.reserve(capacity);
         }
 
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+        // The thread priority and scheduling hint threads depending on this
+        // shared state are launched with, unless they are launched with
+        // explicit ones. These are initialized from the thread creating the
+        // shared state.
+        threads::thread_priority get_priority() const noexcept
+        {
+            return priority_;
+        }
+
+        threads::thread_schedule_hint get_schedule_hint() const noexcept
+        {
+            return schedulehint_;
+        }
+
+        // Overwrite the recorded priority and hint with the given ones, as
+        // far as those were specified explicitly.
+        void set_scheduling(threads::thread_priority priority,
+            threads::thread_schedule_hint hint) noexcept
+        {
+            if (priority != threads::thread_priority::default_)
+            {
+                priority_ = priority;
+            }
+            if (hint.mode != threads::thread_schedule_hint_mode::none)
+            {
+                schedulehint_ = hint;
+            }
+        }
+
+        // Inherit the priority recorded for the given shared state if it is
+        // more urgent than the one recorded for this one, inherit its hint if
+        // no hint was recorded for this one.
+        void inherit_scheduling(future_data_base const& other) noexcept
+        {
+            if (priority_urgency(other.priority_) >
+                priority_urgency(priority_))
+            {
+                priority_ = other.priority_;
+            }
+            if (schedulehint_.mode == threads::thread_schedule_hint_mode::none)
+            {
+                schedulehint_ = other.schedulehint_;
+            }
+        }
+
+        // Return the given launch policy, using the recorded priority and
+        // hint unless the policy specifies those explicitly.
+        template <typename Policy>
+        Policy scheduling_policy(Policy policy) const noexcept
+        {
+            if (policy.priority() == threads::thread_priority::default_)
+            {
+                policy.set_priority(priority_);
+            }
+            if (policy.hint().mode == threads::thread_schedule_hint_mode::none)
+            {
+                policy.set_hint(schedulehint_);
+            }
+            return policy;
+        }
+
+    private:
+        static constexpr int priority_urgency(
+            threads::thread_priority priority) noexcept
+        {
+            switch (priority)
+            {
+            case threads::thread_priority::low:
+                return 1;
+            case threads::thread_priority::normal:
+                [[fallthrough]];
+            case threads::thread_priority::bound:
+                return 2;
+            case threads::thread_priority::boost:
+                return 3;
+            case threads::thread_priority::high_recursive:
+                [[fallthrough]];
+            case threads::thread_priority::high:
+                return 4;
+            default:
+                return 0;
+            }
+        }
+
+        void init_scheduling() noexcept;
+#endif
+
     protected:
         // try to perform scoped execution of the associated thread (if any)
         bool execute_thread();
@@ -340,8 +435,29 @@ namespace hpx::lcos::detail {
         completed_callback_vector_type on_completed_;
         local::detail::condition_variable cond_;    // threads waiting in read
         threads::thread_id_ref_type runs_child_;
+
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+        threads::thread_priority priority_ = threads::thread_priority::default_;
+        threads::thread_schedule_hint schedulehint_;
+#endif
     };
 
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+    // Let the given shared state inherit the scheduling properties recorded
+    // for the shared state of the given future (if any).
+    template <typename Future>
+    void inherit_scheduling(
+        future_data_base<traits::detail::future_data_void>& target,
+        Future const& f) noexcept
+    {
+        if (auto const& state =
+                traits::future_access<Future>::get_shared_state(f))
+        {
+            target.inherit_scheduling(*state);
+        }
+    }
+#endif
+
     template <typename Result>
     struct future_data_base : future_data_base<traits::detail::future_data_void>
     {
@@ -17,6 +17,7 @@
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/execution_base/execution.hpp>
 #include <hpx/functional/deferred_call.hpp>
+#include <hpx/futures/config/defines.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_access.hpp>
@@ -771,18 +772,16 @@ namespace hpx::lcos::local {
                 !std::is_same_v<std::decay_t<F>, futures_factory>>>
         explicit futures_factory(F&& f)
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::thread_local_caching_allocator<
-                    hpx::lockfree::variable_size_stack, char,
-                    hpx::util::internal_allocator<>>{},
+                hpx::util::thread_local_size_class_allocator<
+                    char, hpx::util::internal_allocator<>>{},
                 HPX_FORWARD(F, f)))
         {
         }
 
         explicit futures_factory(Result (*f)())
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::thread_local_caching_allocator<
-                    hpx::lockfree::variable_size_stack, char,
-                    hpx::util::internal_allocator<>>{},
+                hpx::util::thread_local_size_class_allocator<
+                    char, hpx::util::internal_allocator<>>{},
                 f))
         {
         }
@@ -844,6 +843,10 @@ namespace hpx::lcos::local {
                     "futures_factory<Result()>::post()",
                     "futures_factory invalid (has it been moved?)");
             }
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+            // continuations inherit the scheduling of the task
+            task_->set_scheduling(policy.priority(), policy.hint());
+#endif
             return task_->post(pool, annotation, HPX_MOVE(policy), ec);
         }
 
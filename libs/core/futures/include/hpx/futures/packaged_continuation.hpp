@@ -15,6 +15,7 @@
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/concurrency/stack.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/futures/config/defines.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/futures/traits/future_access.hpp>
@@ -24,6 +25,7 @@
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/scoped_annotation.hpp>
 #include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 
 #include <exception>
 #include <functional>
@@ -127,7 +129,11 @@ namespace hpx::lcos::detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Future, typename F, typename ContResult>
+    // The spawner and the launch policy needed for running the continuation
+    // are stored in place, this keeps the completion handler registered with
+    // the future small enough to not require any additional allocation.
+    template <typename Future, typename F, typename ContResult,
+        typename Spawner>
     class continuation : public detail::future_data<ContResult>
     {
     private:
@@ -175,23 +181,22 @@ namespace hpx::lcos::detail {
     public:
         using init_no_addref = typename base_type::init_no_addref;
 
-        template <typename Func,
-            typename Enable = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Func>, continuation>>>
-        // NOLINTNEXTLINE(bugprone-forwarding-reference-overload)
-        explicit continuation(Func&& f)
+        template <typename Func, typename Spawner_>
+        continuation(Func&& f, Spawner_&& spawner)
           : started_(false)
           , id_(threads::invalid_thread_id)
           , f_(HPX_FORWARD(Func, f))
+          , spawner_(HPX_FORWARD(Spawner_, spawner))
         {
         }
 
-        template <typename Func>
-        continuation(init_no_addref no_addref, Func&& f)
+        template <typename Func, typename Spawner_>
+        continuation(init_no_addref no_addref, Func&& f, Spawner_&& spawner)
           : base_type(no_addref)
           , started_(false)
           , id_(threads::invalid_thread_id)
           , f_(HPX_FORWARD(Func, f))
+          , spawner_(HPX_FORWARD(Spawner_, spawner))
         {
         }
 
@@ -230,9 +235,8 @@ namespace hpx::lcos::detail {
             run_impl<Unwrap>(HPX_MOVE(f));
         }
 
-        template <bool Unwrap, typename Spawner>
-        void async(traits::detail::shared_state_ptr_for_t<Future>&& f,
-            Spawner&& spawner)
+        template <bool Unwrap>
+        void async(traits::detail::shared_state_ptr_for_t<Future>&& f)
         {
             ensure_started();
 
@@ -240,11 +244,11 @@ namespace hpx::lcos::detail {
 
             hpx::intrusive_ptr<continuation> this_(this);
             hpx::threads::thread_description desc(f_, "async");
-            spawner(
+            spawner_(
                 [this_ = HPX_MOVE(this_), f = HPX_MOVE(f)]() mutable -> void {
                     this_->template run_impl<Unwrap>(HPX_MOVE(f));
                 },
-                desc, this->runs_child_);
+                desc, this->runs_child_, policy_);
         }
 
     public:
@@ -304,10 +308,9 @@ namespace hpx::lcos::detail {
 
     public:
         ///////////////////////////////////////////////////////////////////////
-        template <bool Unwrap, typename Spawner, typename Future_,
-            typename Policy>
-        void attach(Future_&& future, Spawner&& spawner, Policy&& policy,
-            error_code& /*ec*/ = throws)
+        template <bool Unwrap, typename Future_, typename Policy>
+        void attach(
+            Future_&& future, Policy&& policy, error_code& /*ec*/ = throws)
         {
             using shared_state_ptr =
                 traits::detail::shared_state_ptr_for_t<Future_>;
@@ -326,15 +329,32 @@ namespace hpx::lcos::detail {
                     "the future to attach has no valid shared state");
             }
 
+            policy_ = HPX_FORWARD(Policy, policy);
+
             ptr->execute_deferred();
             ptr->set_on_completed(
-                [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
-                    policy = HPX_FORWARD(Policy, policy),
-                    spawner = HPX_FORWARD(Spawner, spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                [this_ = HPX_MOVE(this_),
+                    state = HPX_MOVE(state)]() mutable -> void {
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+                    // the continuation runs with the scheduling properties
+                    // inherited from the future it depends on, unless the
+                    // launch policy specifies those explicitly
+                    this_->inherit_scheduling(*state);
+                    this_->set_scheduling(
+                        this_->policy_.priority(), this_->policy_.hint());
+                    this_->policy_ = this_->scheduling_policy(this_->policy_);
+#endif
+                    // launch::inline_ runs the continuation right away unless
+                    // the nesting of directly run continuations is too deep
+                    // (the nesting depth is accounted for by the future)
+                    if (hpx::detail::has_inline_policy(this_->policy_) &&
+                        threads::can_run_continuation_inline())
+                    {
+                        this_->template run<Unwrap>(HPX_MOVE(state));
+                    }
+                    else if (hpx::detail::has_async_policy(this_->policy_))
                     {
-                        this_->template async<Unwrap>(
-                            HPX_MOVE(state), HPX_FORWARD(Spawner, spawner));
+                        this_->template async<Unwrap>(HPX_MOVE(state));
                     }
                     else
                     {
@@ -347,13 +367,16 @@ namespace hpx::lcos::detail {
         bool started_;
         threads::thread_id_type id_;
         std::decay_t<F> f_;
+        HPX_NO_UNIQUE_ADDRESS Spawner spawner_;
+        hpx::launch policy_;
     };
 
     template <typename Allocator, typename Future, typename F,
-        typename ContResult>
-    class continuation_allocator : public continuation<Future, F, ContResult>
+        typename ContResult, typename Spawner>
+    class continuation_allocator
+      : public continuation<Future, F, ContResult, Spawner>
     {
-        using base_type = continuation<Future, F, ContResult>;
+        using base_type = continuation<Future, F, ContResult, Spawner>;
 
         using other_allocator = typename std::allocator_traits<
             Allocator>::template rebind_alloc<continuation_allocator>;
@@ -361,17 +384,19 @@ namespace hpx::lcos::detail {
     public:
         using init_no_addref = typename base_type::init_no_addref;
 
-        template <typename Func>
-        continuation_allocator(other_allocator const& alloc, Func&& f)
-          : base_type(HPX_FORWARD(Func, f))
+        template <typename Func, typename Spawner_>
+        continuation_allocator(
+            other_allocator const& alloc, Func&& f, Spawner_&& spawner)
+          : base_type(HPX_FORWARD(Func, f), HPX_FORWARD(Spawner_, spawner))
           , alloc_(alloc)
         {
         }
 
-        template <typename Func>
-        continuation_allocator(
-            init_no_addref no_addref, other_allocator const& alloc, Func&& f)
-          : base_type(no_addref, HPX_FORWARD(Func, f))
+        template <typename Func, typename Spawner_>
+        continuation_allocator(init_no_addref no_addref,
+            other_allocator const& alloc, Func&& f, Spawner_&& spawner)
+          : base_type(no_addref, HPX_FORWARD(Func, f),
+                HPX_FORWARD(Spawner_, spawner))
           , alloc_(alloc)
         {
         }
@@ -390,12 +415,13 @@ namespace hpx::lcos::detail {
     };
 }    // namespace hpx::lcos::detail
 
-template <typename Future, typename F, typename ContResult, typename Allocator>
+template <typename Future, typename F, typename ContResult, typename Spawner,
+    typename Allocator>
 struct hpx::traits::detail::shared_state_allocator<
-    hpx::lcos::detail::continuation<Future, F, ContResult>, Allocator>
+    hpx::lcos::detail::continuation<Future, F, ContResult, Spawner>, Allocator>
 {
-    using type =
-        lcos::detail::continuation_allocator<Allocator, Future, F, ContResult>;
+    using type = lcos::detail::continuation_allocator<Allocator, Future, F,
+        ContResult, Spawner>;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -584,9 +610,8 @@ namespace hpx::lcos::detail {
     traits::detail::shared_state_ptr_t<future_unwrap_result_t<Future>> unwrap(
         Future&& future, error_code& ec)
     {
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack, char,
-            hpx::util::internal_allocator<>>;
+        using allocator_type = hpx::util::thread_local_size_class_allocator<
+            char, hpx::util::internal_allocator<>>;
         return unwrap_impl_alloc(
             allocator_type{}, HPX_FORWARD(Future, future), ec);
     }
@@ -19,6 +19,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/thread_data.hpp>
 
 #include <cstddef>
 #include <exception>
@@ -111,6 +112,18 @@ namespace hpx::lcos::detail {
         }
     }
 
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+    void future_data_base<traits::detail::future_data_void>::init_scheduling()
+        noexcept
+    {
+        if (threads::thread_data const* self = threads::get_self_id_data())
+        {
+            priority_ = self->get_priority();
+            schedulehint_ = self->get_schedule_hint();
+        }
+    }
+#endif
+
     // try to performed scoped execution of the associated thread (if any)
     bool future_data_base<traits::detail::future_data_void>::execute_thread()
     {
@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that attaching a continuation to a future does not allocate memory
+// once the per-thread pool the shared states are taken from has been warmed
+// up, i.e. that a chain of continuations does not require any allocation.
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The shared states are allocated from per-thread pools which take their
+// memory from hpx::util::internal_allocator. Unless HPX uses a prefixed
+// jemalloc, this is std::allocator, i.e. every block that is not served
+// from the pool shows up as a call to the global operator new. Allocations
+// are counted for the calling OS thread only, which avoids interference
+// from other threads of the runtime.
+using shared_state_allocator = hpx::util::thread_local_size_class_allocator<
+    char, hpx::util::internal_allocator<>>;
+
+inline constexpr bool counts_shared_state_allocations =
+    std::is_same_v<hpx::util::internal_allocator<char>,
+        std::allocator<char>> &&
+    !std::is_same_v<shared_state_allocator, std::allocator<char>>;
+
+thread_local std::size_t num_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++num_allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+// the replaced operators are matching, the memory is always allocated using
+// std::malloc
+#if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 110000
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 110000
+#pragma GCC diagnostic pop
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_links = 100;
+
+// attach a chain of continuations to a pending future, return the number of
+// allocations needed for attaching them
+template <typename Attach>
+std::size_t count_chain_allocations(Attach& attach)
+{
+    hpx::promise<int> p;
+    hpx::future<int> f = p.get_future();
+
+    std::size_t const allocations = num_allocations;
+    for (std::size_t i = 0; i != num_links; ++i)
+    {
+        f = attach(HPX_MOVE(f));
+    }
+    std::size_t const link_allocations = num_allocations - allocations;
+
+    p.set_value(0);
+    HPX_TEST_EQ(f.get(), static_cast<int>(num_links));
+
+    return link_allocations;
+}
+
+template <typename Attach>
+void test_then_chain(Attach&& attach)
+{
+    // the first chain fills the pool with the released shared states
+    count_chain_allocations(attach);
+
+    // all shared states of the second chain are taken from the pool and
+    // no other memory may be allocated
+    std::size_t const link_allocations = count_chain_allocations(attach);
+    if constexpr (counts_shared_state_allocations)
+    {
+        HPX_TEST_EQ(link_allocations, std::size_t(0));
+    }
+}
+
+int hpx_main()
+{
+    auto const cont = [](hpx::future<int>&& f) { return f.get() + 1; };
+
+    test_then_chain([&](hpx::future<int>&& f) { return f.then(cont); });
+    test_then_chain([&](hpx::future<int>&& f) {
+        return f.then(hpx::launch::sync, cont);
+    });
+    test_then_chain([&](hpx::future<int>&& f) {
+        return f.then(hpx::launch::async, cont);
+    });
+
+    hpx::execution::parallel_executor exec;
+    test_then_chain(
+        [&](hpx::future<int>&& f) { return f.then(exec, cont); });
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // all continuations are run on the same worker thread, thus all shared
+    // states are returned to the pool they were taken from
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,166 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that launch::inline_ runs tasks and continuations directly on the
+// calling thread while the nesting depth permits, and that it falls back to
+// running them on new threads otherwise.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_then_ready()
+{
+    hpx::thread::id const id = hpx::this_thread::get_id();
+
+    hpx::future<int> f = hpx::make_ready_future(41).then(
+        hpx::launch::inline_, [id](hpx::future<int>&& f) {
+            HPX_TEST(hpx::this_thread::get_id() == id);
+            return f.get() + 1;
+        });
+
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+void test_then_chain()
+{
+    // a chain of continuations much longer than the maximal nesting depth
+    // has to be partially run on new threads to avoid stack overflows
+    std::size_t constexpr num_links = 1000;
+
+    std::vector<hpx::thread::id> ids(num_links);
+
+    hpx::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+    for (std::size_t i = 0; i != num_links; ++i)
+    {
+        f = f.then(hpx::launch::inline_,
+            [&ids](hpx::future<std::size_t>&& f) {
+                std::size_t const value = f.get();
+                ids[value] = hpx::this_thread::get_id();
+                return value + 1;
+            });
+    }
+
+    p.set_value(0);
+    HPX_TEST_EQ(f.get(), num_links);
+
+    // most of the continuations have been run directly
+    std::set<hpx::thread::id> const distinct_ids(ids.begin(), ids.end());
+    HPX_TEST_LT(distinct_ids.size(), num_links / 2);
+}
+
+void test_then_non_hpx_thread()
+{
+    // continuations triggered on a non-HPX thread are run on new threads
+    hpx::promise<int> p;
+    hpx::future<int> f =
+        p.get_future().then(hpx::launch::inline_, [](hpx::future<int>&& f) {
+            HPX_TEST(hpx::threads::get_self_ptr() != nullptr);
+            return f.get() + 1;
+        });
+
+    std::thread t([&p]() { p.set_value(41); });
+    HPX_TEST_EQ(f.get(), 42);
+    t.join();
+}
+
+void test_async()
+{
+    hpx::thread::id const id = hpx::this_thread::get_id();
+
+    hpx::future<void> f = hpx::async(hpx::launch::inline_,
+        [id]() { HPX_TEST(hpx::this_thread::get_id() == id); });
+
+    HPX_TEST(f.is_ready());
+    f.get();
+
+    // the generic launch policy dispatches to launch::inline_ as well
+    hpx::launch const policy = hpx::launch::inline_;
+    HPX_TEST(hpx::async(policy, [id]() {
+        return hpx::this_thread::get_id() == id;
+    }).get());
+}
+
+void test_dataflow()
+{
+    hpx::thread::id const id = hpx::this_thread::get_id();
+
+    hpx::future<int> f = hpx::dataflow(
+        hpx::launch::inline_,
+        [id](hpx::future<int>&& f1, hpx::future<int>&& f2) {
+            HPX_TEST(hpx::this_thread::get_id() == id);
+            return f1.get() + f2.get();
+        },
+        hpx::make_ready_future(20), hpx::make_ready_future(22));
+
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), 42);
+
+    hpx::promise<int> p;
+    hpx::future<int> f3 = hpx::dataflow(
+        hpx::launch::inline_,
+        [](hpx::future<int>&& f) { return f.get() + 1; }, p.get_future());
+
+    p.set_value(41);
+    HPX_TEST_EQ(f3.get(), 42);
+}
+
+void test_when_all()
+{
+    hpx::promise<int> p1;
+    hpx::promise<int> p2;
+
+    hpx::thread::id const id = hpx::this_thread::get_id();
+
+    auto f = hpx::when_all(p1.get_future(), p2.get_future())
+                 .then(hpx::launch::inline_, [id](auto&& f) {
+                     HPX_TEST(hpx::this_thread::get_id() == id);
+                     auto results = f.get();
+                     return hpx::get<0>(results).get() +
+                         hpx::get<1>(results).get();
+                 });
+
+    p1.set_value(20);
+    HPX_TEST(!f.is_ready());
+    p2.set_value(22);
+
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+int hpx_main()
+{
+    test_then_ready();
+    test_then_chain();
+    test_then_non_hpx_thread();
+    test_async();
+    test_dataflow();
+    test_when_all();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the thread priority continuations, dataflow, and when_all are run
+// with. Continuations always honor the priority of an explicitly given launch
+// policy. If HPX_FUTURES_WITH_PRIORITY_PROPAGATION is enabled, they inherit
+// the priority of the futures they depend on otherwise.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::threads::thread_priority;
+
+///////////////////////////////////////////////////////////////////////////////
+thread_priority current_priority()
+{
+    return hpx::threads::get_self_id_data()->get_priority();
+}
+
+template <typename Future>
+thread_priority continuation_priority(Future&& f)
+{
+    return f.then([](auto&&) { return current_priority(); }).get();
+}
+
+hpx::future<void> make_future(thread_priority priority)
+{
+    return hpx::async(hpx::launch::async_policy(priority), []() {});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_explicit_policy()
+{
+    auto const high = hpx::launch::async_policy(thread_priority::high);
+
+    // a continuation launched with an explicit priority runs with that
+    // priority, regardless of whether the future is ready already
+    thread_priority priority =
+        hpx::make_ready_future()
+            .then(high, [](hpx::future<void>&&) { return current_priority(); })
+            .get();
+    HPX_TEST_EQ(priority, thread_priority::high);
+
+    hpx::promise<void> p;
+    hpx::future<thread_priority> f = p.get_future().then(
+        high, [](hpx::future<void>&&) { return current_priority(); });
+    p.set_value();
+    HPX_TEST_EQ(f.get(), thread_priority::high);
+
+    // dataflow as well
+    priority = hpx::dataflow(
+        high, [](hpx::future<void>&&) { return current_priority(); },
+        make_future(thread_priority::normal))
+                   .get();
+    HPX_TEST_EQ(priority, thread_priority::high);
+}
+
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+void test_then()
+{
+    // continuations inherit the priority of the task they depend on
+    HPX_TEST_EQ(continuation_priority(make_future(thread_priority::high)),
+        thread_priority::high);
+    HPX_TEST_EQ(continuation_priority(make_future(thread_priority::normal)),
+        thread_priority::normal);
+
+    // ... along the whole chain
+    thread_priority const priority =
+        make_future(thread_priority::high)
+            .then([](hpx::future<void>&&) {})
+            .then([](hpx::future<void>&&) {})
+            .then([](hpx::future<void>&&) { return current_priority(); })
+            .get();
+    HPX_TEST_EQ(priority, thread_priority::high);
+
+    // shared futures as well
+    hpx::shared_future<void> sf = make_future(thread_priority::high);
+    HPX_TEST_EQ(continuation_priority(sf), thread_priority::high);
+}
+
+void test_dataflow()
+{
+    // dataflow inherits the most urgent priority of its inputs
+    thread_priority const priority = hpx::dataflow(
+        [](auto&&...) { return current_priority(); },
+        make_future(thread_priority::normal),
+        make_future(thread_priority::high))
+                                         .get();
+    HPX_TEST_EQ(priority, thread_priority::high);
+
+    // the future returned by dataflow passes the priority on
+    HPX_TEST_EQ(continuation_priority(hpx::dataflow([](auto&&...) {},
+                    make_future(thread_priority::high))),
+        thread_priority::high);
+}
+
+void test_when_all()
+{
+    HPX_TEST_EQ(continuation_priority(
+                    hpx::when_all(make_future(thread_priority::normal),
+                        make_future(thread_priority::high))),
+        thread_priority::high);
+
+    std::vector<hpx::future<void>> futures;
+    futures.push_back(make_future(thread_priority::normal));
+    futures.push_back(make_future(thread_priority::high));
+    futures.push_back(make_future(thread_priority::normal));
+    HPX_TEST_EQ(continuation_priority(hpx::when_all(std::move(futures))),
+        thread_priority::high);
+}
+
+void test_override()
+{
+    // an explicit launch policy overrides the inherited priority
+    thread_priority priority =
+        make_future(thread_priority::high)
+            .then(hpx::launch::async_policy(thread_priority::low),
+                [](hpx::future<void>&&) { return current_priority(); })
+            .get();
+    HPX_TEST_EQ(priority, thread_priority::low);
+
+    // executors always use their own priority
+    hpx::execution::parallel_executor exec(thread_priority::low);
+    priority = make_future(thread_priority::high)
+                   .then(exec,
+                       [](hpx::future<void>&&) { return current_priority(); })
+                   .get();
+    HPX_TEST_EQ(priority, thread_priority::low);
+
+    priority = hpx::dataflow(
+        exec, [](hpx::future<void>&&) { return current_priority(); },
+        make_future(thread_priority::high))
+                   .get();
+    HPX_TEST_EQ(priority, thread_priority::low);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_explicit_policy();
+
+#if defined(HPX_FUTURES_HAVE_PRIORITY_PROPAGATION)
+    test_then();
+    test_dataflow();
+    test_when_all();
+    test_override();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -52,9 +52,8 @@ namespace hpx::lcos::local {
         explicit base_and_gate(std::size_t count = 0)
           : received_segments_(count)
           , promise_(std::allocator_arg,
-                hpx::util::thread_local_caching_allocator<
-                    hpx::lockfree::variable_size_stack, char,
-                    hpx::util::internal_allocator<>>{})
+                hpx::util::thread_local_size_class_allocator<
+                    char, hpx::util::internal_allocator<>>{})
           , generation_(1)
         {
         }
@@ -211,9 +210,8 @@ namespace hpx::lcos::local {
                 {
                     // we have received the last missing segment
                     using allocator_type =
-                        hpx::util::thread_local_caching_allocator<
-                            hpx::lockfree::variable_size_stack, char,
-                            hpx::util::internal_allocator<>>;
+                        hpx::util::thread_local_size_class_allocator<
+                            char, hpx::util::internal_allocator<>>;
 
                     hpx::promise<void> p(std::allocator_arg, allocator_type{});
                     std::swap(p, promise_);
@@ -0,0 +1,221 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of the different local channel implementations with
+// a configurable number of producers and consumers.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/lcos_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data() = default;
+
+    explicit data(std::size_t d)
+    {
+        data_[0] = d;
+    }
+
+    std::size_t data_[8];
+};
+
+std::size_t num_items = 0;
+std::size_t num_producers = 0;
+std::size_t num_consumers = 0;
+std::size_t batch_size = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Every producer sets num_items items, every consumer retrieves its share of
+// all items.
+template <typename Channel, typename Set, typename Get>
+void run_benchmark(std::string const& name, Channel& c, Set&& set, Get&& get)
+{
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_producers + num_consumers);
+
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        tasks.push_back(hpx::async([&]() { set(c, num_items); }));
+    }
+
+    std::size_t const total = num_producers * num_items;
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        std::size_t const count = total / num_consumers +
+            (i < total % num_consumers ? 1 : 0);
+        tasks.push_back(hpx::async([&, count]() { get(c, count); }));
+    }
+
+    hpx::wait_all(tasks);
+
+    double const elapsed = static_cast<double>(
+                               hpx::chrono::high_resolution_clock::now() -
+                               start) /
+        1e9;
+
+    std::cout << name << ": " << (static_cast<double>(total) / elapsed)
+              << " [op/s] (" << (elapsed / static_cast<double>(total))
+              << " [s/op])" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void measure_channel()
+{
+    hpx::lcos::local::channel<data> c;
+
+    // every task uses its own handle to the channel, otherwise a blocking get
+    // would be reported as a deadlock
+    run_benchmark(
+        "lcos::local::channel", c,
+        [](auto c, std::size_t n) {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                c.set(data{i});
+            }
+        },
+        [](auto c, std::size_t n) {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                c.get(hpx::launch::sync);
+            }
+        });
+}
+
+void measure_channel_mpmc()
+{
+    hpx::lcos::local::channel_mpmc<data> c(10000);
+
+    run_benchmark(
+        "channel_mpmc", c,
+        [](auto& c, std::size_t n) {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                while (!c.set(data{i}))
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+        },
+        [](auto& c, std::size_t n) {
+            data d;
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                while (!c.get(&d))
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+        });
+}
+
+void measure_channel_mpmc_unbounded()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<data> c;
+
+    run_benchmark(
+        "channel_mpmc_unbounded", c,
+        [](auto& c, std::size_t n) {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                c.set(data{i});
+            }
+        },
+        [](auto& c, std::size_t n) {
+            data d;
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                c.get_wait(d);
+            }
+        });
+}
+
+void measure_channel_mpmc_unbounded_batched()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<data> c;
+
+    run_benchmark(
+        "channel_mpmc_unbounded (batched)", c,
+        [](auto& c, std::size_t n) {
+            std::vector<data> values(batch_size);
+            for (std::size_t i = 0; i < n; i += batch_size)
+            {
+                std::size_t const count = (std::min)(batch_size, n - i);
+                c.set_n(values.begin(), count);
+            }
+        },
+        [](auto& c, std::size_t n) {
+            std::vector<data> values(batch_size);
+            while (n != 0)
+            {
+                n -= c.get_n_wait(values.begin(), (std::min)(batch_size, n));
+            }
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    num_items = vm["items"].as<std::size_t>();
+    num_producers = vm["producers"].as<std::size_t>();
+    num_consumers = vm["consumers"].as<std::size_t>();
+    batch_size = vm["batch-size"].as<std::size_t>();
+
+    if (num_producers == 0 || num_consumers == 0 || batch_size == 0)
+    {
+        std::cerr << "the number of producers, consumers, and the batch size "
+                     "must be larger than zero"
+                  << std::endl;
+        return hpx::local::finalize();
+    }
+
+    measure_channel();
+    measure_channel_mpmc();
+    measure_channel_mpmc_unbounded();
+    measure_channel_mpmc_unbounded_batched();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("items", value<std::size_t>()->default_value(100000),
+         "number of items set by each producer (default: 100000)")
+        ("producers", value<std::size_t>()->default_value(1),
+         "number of producers (default: 1)")
+        ("consumers", value<std::size_t>()->default_value(1),
+         "number of consumers (default: 1)")
+        ("batch-size", value<std::size_t>()->default_value(64),
+         "number of items per batch operation (default: 64)")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -142,6 +142,9 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::local_priority_lifo:
             sched = "local_priority_lifo";
             break;
+        case resource::scheduling_policy::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         case resource::scheduling_policy::local_workrequesting_fifo:
             sched = "local_workrequesting_fifo";
@@ -255,21 +258,6 @@ namespace hpx::resource::detail {
         }
 #endif
 
-        std::string const default_scheduler_mode_str =
-            rtcfg_.get_entry("hpx.default_scheduler_mode", std::string());
-        if (!default_scheduler_mode_str.empty())
-        {
-            default_scheduler_mode_ =
-                static_cast<threads::policies::scheduler_mode>(
-                    hpx::util::from_string<std::size_t>(
-                        default_scheduler_mode_str));
-            HPX_ASSERT_MSG(
-                (default_scheduler_mode_ &
-                    ~threads::policies::scheduler_mode::all_flags) == 0,
-                "hpx.default_scheduler_mode contains unknown scheduler "
-                "modes");
-        }
-
         // Create the default pool
         initial_thread_pools_.emplace_back(
             "default", scheduling_policy::unspecified, default_scheduler_mode_);
@@ -487,6 +475,12 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::local_priority_lifo;
         }
+        else if (0 ==
+            std::string("local-priority-chase-lev")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         else if (0 ==
             std::string("local-workrequesting-fifo")
@@ -979,6 +973,25 @@ namespace hpx::resource::detail {
         rtcfg_ = rtcfg;
         affinity_data_ = affinity_data;
 
+        // the configuration is available only now, the default pool has
+        // already been created with the default scheduler mode
+        std::string const default_scheduler_mode_str =
+            rtcfg_.get_entry("hpx.default_scheduler_mode", std::string());
+        if (!default_scheduler_mode_str.empty())
+        {
+            default_scheduler_mode_ =
+                static_cast<threads::policies::scheduler_mode>(
+                    hpx::util::from_string<std::size_t>(
+                        default_scheduler_mode_str));
+            HPX_ASSERT_MSG(
+                (default_scheduler_mode_ &
+                    ~threads::policies::scheduler_mode::all_flags) == 0,
+                "hpx.default_scheduler_mode contains unknown scheduler "
+                "modes");
+
+            initial_thread_pools_[0].mode_ = default_scheduler_mode_;
+        }
+
         fill_topology_vectors();
 
         pus_needed_ = assign_cores(0);
@@ -110,6 +110,16 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Maximal number of stacks kept for reuse per NUMA domain
+        std::size_t get_stack_pool_size() const;
+
+        // Back thread stacks with (transparent) huge pages
+        bool use_stack_huge_pages() const;
+
+        // Let thread stacks start small and grow on demand
+        bool use_growable_stacks() const;
+        std::size_t get_growable_stack_initial_size() const;
 #endif
 
         // return trace_depth for stack-backtraces
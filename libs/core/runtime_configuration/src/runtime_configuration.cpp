@@ -214,6 +214,13 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "pool_size = ${HPX_STACK_POOL_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_POOL_SIZE)) "}",
+            "use_huge_pages = ${HPX_USE_HUGE_PAGES:0}",
+            "use_growable_stacks = ${HPX_USE_GROWABLE_STACKS:0}",
+            "growable_initial_size = "
+            "${HPX_GROWABLE_STACK_INITIAL_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_GROWABLE_STACK_INITIAL_SIZE)) "}",
 #endif
 
             "[hpx.threadpools]",
@@ -257,6 +264,9 @@ namespace hpx::util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "max_runnext_count = "
+            "${HPX_THREAD_QUEUE_MAX_RUNNEXT_COUNT:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_RUNNEXT_COUNT)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -1099,6 +1109,46 @@ namespace hpx::util {
         }
         return true;    // default is true
     }
+
+    std::size_t runtime_configuration::get_stack_pool_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_size", HPX_STACK_POOL_SIZE);
+        }
+        return HPX_STACK_POOL_SIZE;
+    }
+
+    bool runtime_configuration::use_stack_huge_pages() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_huge_pages", 0) !=
+                0;
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::use_growable_stacks() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "use_growable_stacks", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    std::size_t runtime_configuration::get_growable_stack_initial_size() const
+    {
+        return static_cast<std::size_t>(init_stack_size("growable_initial_size",
+            HPX_PP_STRINGIZE(HPX_GROWABLE_STACK_INITIAL_SIZE),
+            HPX_GROWABLE_STACK_INITIAL_SIZE));
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
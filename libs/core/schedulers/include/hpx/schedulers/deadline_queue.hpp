@@ -0,0 +1,96 @@
+//  Copyright (c) 2007-2024 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies::detail {
+
+    // Pending threads that have a deadline are kept in a separate binary
+    // heap, ordered earliest deadline first (EDF). The scheduler queues
+    // consult this heap before their regular queue of pending threads.
+    template <typename T>
+    class deadline_queue
+    {
+        struct deadline_item
+        {
+            std::uint64_t deadline;
+            T thrd;
+
+            friend bool operator<(
+                deadline_item const& lhs, deadline_item const& rhs) noexcept
+            {
+                // std::push_heap/std::pop_heap maintain a max-heap
+                return lhs.deadline > rhs.deadline;
+            }
+        };
+
+    public:
+        deadline_queue() = default;
+
+        deadline_queue(deadline_queue const&) = delete;
+        deadline_queue(deadline_queue&&) = delete;
+        deadline_queue& operator=(deadline_queue const&) = delete;
+        deadline_queue& operator=(deadline_queue&&) = delete;
+
+        ~deadline_queue()
+        {
+            HPX_ASSERT(items_.empty());
+        }
+
+        void push(std::uint64_t deadline, T thrd)
+        {
+            std::lock_guard<hpx::util::spinlock> l(mtx_);
+            items_.push_back(deadline_item{deadline, HPX_MOVE(thrd)});
+            std::push_heap(items_.begin(), items_.end());
+            ++count_;
+        }
+
+        // retrieve the thread with the earliest deadline, return false if
+        // none is available
+        bool pop(T& thrd)
+        {
+            // avoid touching the lock if the heap is obviously empty
+            if (count_.load(std::memory_order_relaxed) == 0)
+            {
+                return false;
+            }
+
+            std::lock_guard<hpx::util::spinlock> l(mtx_);
+            if (items_.empty())
+            {
+                return false;
+            }
+
+            std::pop_heap(items_.begin(), items_.end());
+            thrd = HPX_MOVE(items_.back().thrd);
+            items_.pop_back();
+            --count_;
+            return true;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed) == 0;
+        }
+
+    private:
+        hpx::util::spinlock mtx_;
+        std::vector<deadline_item> items_;
+        std::atomic<std::int64_t> count_ = 0;
+    };
+}    // namespace hpx::threads::policies::detail
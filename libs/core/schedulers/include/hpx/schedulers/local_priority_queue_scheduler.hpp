@@ -23,6 +23,7 @@
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
@@ -653,6 +654,101 @@ namespace hpx::threads::policies {
             }
         }
 
+        // Create a batch of new threads. Consecutive normal priority threads
+        // are handed to their target queues as a whole: threads with a hint
+        // for the same worker are grouped, threads without a hint are
+        // distributed round-robin in contiguous blocks, one per queue.
+        void create_thread_batch(
+            thread_init_data* data, std::size_t count, error_code& ec) override
+        {
+            auto const can_batch = [](thread_init_data const& d) {
+                return !d.run_now &&
+                    d.initial_state == thread_schedule_state::pending &&
+                    (d.priority == thread_priority::normal ||
+                        d.priority == thread_priority::default_);
+            };
+
+            // NOTE: This scheduler ignores NUMA hints.
+            auto const get_hint = [](thread_init_data const& d) {
+                return d.schedulehint.mode ==
+                        thread_schedule_hint_mode::thread ?
+                    static_cast<std::size_t>(d.schedulehint.hint) :
+                    static_cast<std::size_t>(-1);
+            };
+
+            auto const create_threads = [&](std::size_t num_thread,
+                                            std::size_t begin,
+                                            std::size_t end) {
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    data[i].schedulehint.mode =
+                        thread_schedule_hint_mode::thread;
+                    data[i].schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+                }
+
+                HPX_ASSERT(num_thread < num_queues_);
+                queues_[num_thread].data_->create_threads(
+                    data + begin, end - begin);
+
+                LTM_(debug).format(
+                    "local_priority_queue_scheduler::create_thread_batch, "
+                    "normal priority queue: pool({}), scheduler({}), "
+                    "worker_thread({}), count({})",
+                    *this->get_parent_pool(), *this, num_thread, end - begin);
+            };
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!can_batch(data[i]))
+                {
+                    create_thread(data[i], nullptr, ec);
+                    if (ec)
+                        return;
+
+                    ++i;
+                    continue;
+                }
+
+                std::size_t const hint = get_hint(data[i]);
+                std::size_t end = i + 1;
+                while (end != count && can_batch(data[end]) &&
+                    get_hint(data[end]) == hint)
+                {
+                    ++end;
+                }
+
+                if (hint != static_cast<std::size_t>(-1))
+                {
+                    create_threads(
+                        select_active_pu(hint % num_queues_), i, end);
+                }
+                else
+                {
+                    std::size_t const size = end - i;
+                    std::size_t const num_blocks =
+                        (std::min)(size, num_queues_);
+                    std::size_t const first_queue =
+                        curr_queue_.fetch_add(num_blocks);
+
+                    for (std::size_t block = 0; block != num_blocks; ++block)
+                    {
+                        std::size_t const num_thread =
+                            (first_queue + block) % num_queues_;
+                        create_threads(select_active_pu(num_thread),
+                            i + block * size / num_blocks,
+                            i + (block + 1) * size / num_blocks);
+                    }
+                }
+
+                i = end;
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         bool attempt_stealing_pending(std::size_t num_thread,
             threads::thread_id_ref_type& thrd,
             [[maybe_unused]] thread_queue_type* this_high_priority_queue,
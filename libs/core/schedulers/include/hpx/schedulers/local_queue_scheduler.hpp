@@ -22,6 +22,7 @@
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -322,6 +323,88 @@ namespace hpx::threads::policies {
                 ;
         }
 
+        // Create a batch of new threads. Consecutive threads are handed to
+        // their target queues as a whole: threads with a hint for the same
+        // worker are grouped, threads without a hint are distributed
+        // round-robin in contiguous blocks, one per queue.
+        void create_thread_batch(
+            thread_init_data* data, std::size_t count, error_code& ec) override
+        {
+            auto const can_batch = [](thread_init_data const& d) {
+                return !d.run_now &&
+                    d.initial_state == thread_schedule_state::pending;
+            };
+
+            auto const get_hint = [](thread_init_data const& d) {
+                return d.schedulehint.mode ==
+                        thread_schedule_hint_mode::thread ?
+                    static_cast<std::size_t>(d.schedulehint.hint) :
+                    static_cast<std::size_t>(-1);
+            };
+
+            std::size_t const queue_size = queues_.size();
+            auto const create_threads = [&](std::size_t num_thread,
+                                            std::size_t begin,
+                                            std::size_t end) {
+                HPX_ASSERT(num_thread < queue_size);
+                queues_[num_thread]->create_threads(data + begin, end - begin);
+
+                LTM_(debug).format(
+                    "local_queue_scheduler::create_thread_batch: pool({}), "
+                    "scheduler({}), worker_thread({}), count({})",
+                    *this->get_parent_pool(), *this, num_thread, end - begin);
+            };
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!can_batch(data[i]))
+                {
+                    create_thread(data[i], nullptr, ec);
+                    if (ec)
+                        return;
+
+                    ++i;
+                    continue;
+                }
+
+                std::size_t const hint = get_hint(data[i]);
+                std::size_t end = i + 1;
+                while (end != count && can_batch(data[end]) &&
+                    get_hint(data[end]) == hint)
+                {
+                    ++end;
+                }
+
+                if (hint != static_cast<std::size_t>(-1))
+                {
+                    create_threads(select_active_pu(hint % queue_size), i, end);
+                }
+                else
+                {
+                    std::size_t const size = end - i;
+                    std::size_t const num_blocks =
+                        (std::min)(size, queue_size);
+                    std::size_t const first_queue =
+                        curr_queue_.fetch_add(num_blocks);
+
+                    for (std::size_t block = 0; block != num_blocks; ++block)
+                    {
+                        std::size_t const num_thread =
+                            (first_queue + block) % queue_size;
+                        create_threads(select_active_pu(num_thread),
+                            i + block * size / num_blocks,
+                            i + (block + 1) * size / num_blocks);
+                    }
+                }
+
+                i = end;
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         // Return the next thread to be executed, return false if none is
         // available
         bool get_next_thread(std::size_t num_thread, bool running,
@@ -20,9 +20,12 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
@@ -87,6 +90,14 @@
 // case tasks do not need to be copied. While steal-half is important to tackle
 // fine-grained parallelism, polling is necessary to achieve short message
 // handling delays when workers schedule long-running tasks.
+//
+// If scheduler_mode::steal_hierarchically is set, victims are not selected
+// randomly from all workers but from the topologically closest group of
+// workers that has not been asked yet: workers sharing the same physical core
+// (SMT siblings) are asked first, then workers sharing the same (L3) cache,
+// then workers in the same NUMA domain, and only then all remaining workers.
+// This keeps most of the stolen work (and the data it touches) close to the
+// thief.
 
 namespace hpx::threads::policies {
 
@@ -200,6 +211,18 @@ namespace hpx::threads::policies {
         using workrequesting_steal_request_channel =
             lcos::local::channel_mpsc<workrequesting_steal_request,
                 lcos::local::channel_mode::dont_support_close>;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Topological distance between a thief and a victim
+        enum class workrequesting_steal_level : std::uint8_t
+        {
+            core = 0,     // victim runs on the same physical core
+            cache = 1,    // victim shares the same (L3) cache
+            numa = 2,     // victim runs in the same NUMA domain
+            remote = 3    // everything else
+        };
+
+        inline constexpr std::size_t num_workrequesting_steal_levels = 4;
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -228,6 +251,10 @@ namespace hpx::threads::policies {
         using steal_request_channel =
             detail::workrequesting_steal_request_channel;
 
+        using steal_level = detail::workrequesting_steal_level;
+        static constexpr std::size_t num_steal_levels =
+            detail::num_workrequesting_steal_levels;
+
         ////////////////////////////////////////////////////////////////////////
         struct scheduler_data
         {
@@ -277,6 +304,15 @@ namespace hpx::threads::policies {
             // initial affinity mask for this core
             mask_type victims_ = mask_type();
 
+            // all other cores grouped by their topological distance to this
+            // core (see steal_level)
+            std::array<std::vector<std::uint16_t>, num_steal_levels>
+                steal_levels_;
+
+            // topological distance of each core to this core, indexed by
+            // core number (see steal_level)
+            std::vector<steal_level> victim_levels_;
+
             // queues for threads scheduled on this core
             thread_queue_type* queue_ = nullptr;
             thread_queue_type* high_priority_queue_ = nullptr;
@@ -309,6 +345,20 @@ namespace hpx::threads::policies {
             std::uint32_t steal_requests_sent_ = 0;
             std::uint32_t steal_requests_received_ = 0;
             std::uint32_t steal_requests_discarded_ = 0;
+#endif
+            // number of steal requests sent to victims on behalf of this
+            // core, by topological distance between this core and the victim
+            std::array<std::atomic<std::int64_t>, num_steal_levels>
+                num_steal_requests_by_level_ = {};
+
+            // number of steal requests sent on behalf of this core to a
+            // victim while a topologically closer core had not been asked yet
+            std::atomic<std::int64_t> num_steal_requests_skipping_level_{0};
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+            // number of tasks received from victims, by topological distance
+            std::array<std::atomic<std::int64_t>, num_steal_levels>
+                num_stolen_by_level_ = {};
 #endif
         };
 
@@ -615,8 +665,99 @@ namespace hpx::threads::policies {
             count += d.queue_->get_num_stolen_to_staged(reset);
             return count + d.bound_queue_->get_num_stolen_to_staged(reset);
         }
+
+        std::int64_t get_num_stolen_by_level(
+            std::size_t num_thread, steal_level level, bool reset)
+        {
+            auto const index = static_cast<std::size_t>(level);
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_stolen_by_level_[index], reset);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_stolen_by_level_[index], reset);
+        }
+
+        std::int64_t get_num_stolen_same_core(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_by_level(
+                num_thread, steal_level::core, reset);
+        }
+
+        std::int64_t get_num_stolen_same_cache(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_by_level(
+                num_thread, steal_level::cache, reset);
+        }
+
+        std::int64_t get_num_stolen_same_numa_domain(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_by_level(
+                num_thread, steal_level::numa, reset);
+        }
+
+        std::int64_t get_num_stolen_remote(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_by_level(
+                num_thread, steal_level::remote, reset);
+        }
 #endif
 
+        std::int64_t get_num_steal_requests_by_distance(std::size_t num_thread,
+            std::size_t distance, bool reset) override
+        {
+            HPX_ASSERT(distance < num_steal_levels);
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_steal_requests_by_level_[distance],
+                        reset);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_steal_requests_by_level_[distance],
+                reset);
+        }
+
+        std::int64_t get_num_steal_requests_skipping_closer(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_steal_requests_skipping_level_,
+                        reset);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_steal_requests_skipping_level_,
+                reset);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void abort_all_suspended_threads() override
         {
@@ -1523,6 +1664,78 @@ namespace hpx::threads::policies {
             return result;
         }
 
+        // return a random victim out of the topologically closest group of
+        // cores that has not been asked by the current stealing operation
+        std::size_t hierarchical_victim(steal_request const& req) noexcept
+        {
+            auto const& thief = data_[req.num_thread_].data_;
+            for (auto const& level : thief.steal_levels_)
+            {
+                std::size_t num_candidates = 0;
+                for (std::uint16_t const victim : level)
+                {
+                    if (!test(req.victims_, victim))
+                        ++num_candidates;
+                }
+
+                if (num_candidates == 0)
+                {
+                    continue;    // everybody on this level was asked already
+                }
+
+                std::uniform_int_distribution<std::size_t> uniform(
+                    0, num_candidates - 1);
+
+                std::size_t selected_victim = uniform(gen_);
+                for (std::uint16_t const victim : level)
+                {
+                    if (!test(req.victims_, victim) && selected_victim-- == 0)
+                    {
+                        HPX_ASSERT(victim < num_queues_ &&
+                            victim != req.num_thread_);
+                        return victim;
+                    }
+                }
+            }
+
+            // no victim left, the caller will return the request to the thief
+            return static_cast<std::size_t>(-1);
+        }
+
+        // return the topological distance between the given thief and victim
+        static steal_level get_steal_level(
+            scheduler_data const& thief, std::size_t victim) noexcept
+        {
+            HPX_ASSERT(victim < thief.victim_levels_.size());
+            return thief.victim_levels_[victim];
+        }
+
+        // keep track of the topological distance of the victims a steal
+        // request is sent to, and of whether a closer victim was skipped
+        void count_steal_request(
+            steal_request const& req, std::size_t victim) noexcept
+        {
+            auto& thief = data_[req.num_thread_].data_;
+            auto const level =
+                static_cast<std::size_t>(get_steal_level(thief, victim));
+
+            thief.num_steal_requests_by_level_[level].fetch_add(
+                1, std::memory_order_relaxed);
+
+            for (std::size_t i = 0; i != level; ++i)
+            {
+                for (std::uint16_t const closer : thief.steal_levels_[i])
+                {
+                    if (!test(req.victims_, closer))
+                    {
+                        thief.num_steal_requests_skipping_level_.fetch_add(
+                            1, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+            }
+        }
+
         // return the number of the next victim core
         std::size_t next_victim([[maybe_unused]] scheduler_data& d,
             steal_request const& req) noexcept
@@ -1549,7 +1762,10 @@ namespace hpx::threads::policies {
                 else
 #endif
                 {
-                    victim = random_victim(req);
+                    bool const hierarchical = has_scheduler_mode(
+                        policies::scheduler_mode::steal_hierarchically);
+                    victim = hierarchical ? hierarchical_victim(req) :
+                                            random_victim(req);
                 }
             }
 
@@ -1559,6 +1775,12 @@ namespace hpx::threads::policies {
                 victim = req.num_thread_;
                 HPX_ASSERT(victim != d.num_thread_);
             }
+            else if (victim != req.num_thread_ &&
+                has_scheduler_mode(
+                    policies::scheduler_mode::steal_hierarchically))
+            {
+                count_steal_request(req, victim);
+            }
 
             HPX_ASSERT(victim < num_queues_);
             HPX_ASSERT(req.attempt_ < num_queues_);
@@ -1619,7 +1841,7 @@ namespace hpx::threads::policies {
         // Try receiving tasks that are sent by another core as a response to
         // one of our steal requests. This returns true if new tasks were
         // received.
-        static bool try_receiving_tasks(scheduler_data& d, std::size_t& added,
+        bool try_receiving_tasks(scheduler_data& d, std::size_t& added,
             thread_id_ref_type* next_thrd)
         {
             task_data thrds{};
@@ -1653,6 +1875,17 @@ namespace hpx::threads::policies {
                     // operation
                     d.last_victim_ = thrds.num_thread_;
                     HPX_ASSERT(d.last_victim_ != d.num_thread_);
+#endif
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                    if (has_scheduler_mode(
+                            policies::scheduler_mode::steal_hierarchically))
+                    {
+                        auto const level = static_cast<std::size_t>(
+                            get_steal_level(d, thrds.num_thread_));
+                        d.num_stolen_by_level_[level].fetch_add(
+                            static_cast<std::int64_t>(thrds.tasks_.size()),
+                            std::memory_order_relaxed);
+                    }
 #endif
                     // the last of the received tasks will be either directly
                     // executed or normally scheduled
@@ -1807,6 +2040,58 @@ namespace hpx::threads::policies {
             resize(d.victims_, num_queues_);
             reset(d.victims_);
             set(d.victims_, num_thread);
+
+            init_steal_levels(num_thread);
+        }
+
+        // Group all other cores by their topological distance to the given
+        // core, this is used for hierarchical victim selection and for
+        // keeping track of how far stolen tasks have traveled.
+        void init_steal_levels(std::size_t num_thread)
+        {
+            auto const& topo = create_topology();
+
+            std::size_t const num_pu = affinity_data_.get_pu_num(num_thread);
+            mask_cref_type core_mask = topo.get_core_affinity_mask(num_pu);
+            mask_type const cache_mask =
+                topo.get_cache_affinity_mask(num_pu, 3);
+            mask_cref_type numa_mask = topo.get_numa_node_affinity_mask(num_pu);
+
+            auto& steal_levels = data_[num_thread].data_.steal_levels_;
+            for (auto& level : steal_levels)
+            {
+                level.clear();
+            }
+
+            auto& victim_levels = data_[num_thread].data_.victim_levels_;
+            victim_levels.assign(num_queues_, steal_level::remote);
+
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                if (i == num_thread)
+                    continue;
+
+                mask_cref_type pu_mask = topo.get_thread_affinity_mask(
+                    affinity_data_.get_pu_num(i));
+
+                steal_level level = steal_level::remote;
+                if (any(core_mask & pu_mask))
+                {
+                    level = steal_level::core;
+                }
+                else if (any(cache_mask & pu_mask))
+                {
+                    level = steal_level::cache;
+                }
+                else if (any(numa_mask & pu_mask))
+                {
+                    level = steal_level::numa;
+                }
+
+                steal_levels[static_cast<std::size_t>(level)].push_back(
+                    static_cast<std::uint16_t>(i));
+                victim_levels[i] = level;
+            }
         }
 
         void on_stop_thread(std::size_t num_thread) override
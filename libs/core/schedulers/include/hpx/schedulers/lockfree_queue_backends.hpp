@@ -20,10 +20,13 @@
 #include <hpx/allocator_support/aligned_allocator.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -166,6 +169,102 @@ namespace hpx::threads::policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // LIFO for the owning worker thread + FIFO stealing at the opposite end,
+    // based on a Chase-Lev deque. The owner is the thread that has last called
+    // set_owner(). Items pushed by any other thread (or pushed to the other
+    // end) are kept in a separate MPMC queue which is drained after the deque.
+    template <typename T>
+    struct chase_lev_lifo_backend
+    {
+        using container_type = hpx::concurrency::chase_lev_deque<T>;
+        using inbox_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+
+        explicit chase_lev_lifo_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+          : queue_(initial_size != 0 ? static_cast<std::size_t>(initial_size) :
+                                       64)
+          , inbox_(static_cast<std::size_t>(initial_size))
+          , owner_(std::thread::id())
+        {
+        }
+
+        void set_owner() noexcept
+        {
+            owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        }
+
+        void reset_owner() noexcept
+        {
+            owner_.store(std::thread::id(), std::memory_order_relaxed);
+        }
+
+        bool push(const_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push(val);
+                return true;
+            }
+            return inbox_.enqueue(val);
+        }
+
+        bool pop(reference val, bool steal = true) noexcept
+        {
+            if (!steal && is_owner())
+            {
+                if (queue_.pop(val))
+                    return true;
+            }
+            else if (queue_.steal_retry(val))
+            {
+                return true;
+            }
+            return inbox_.try_dequeue(val);
+        }
+
+        bool empty() noexcept
+        {
+            return queue_.empty() && inbox_.size_approx() == 0;
+        }
+
+    private:
+        bool is_owner() const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        container_type queue_;
+        inbox_type inbox_;
+        std::atomic<std::thread::id> owner_;
+    };
+
+    struct chase_lev_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = chase_lev_lifo_backend<T>;
+        };
+    };
+
+    namespace detail {
+
+        // queue backends which distinguish between their owner and other
+        // threads expose set_owner() and reset_owner()
+        template <typename Queue>
+        using queue_set_owner_t = decltype(std::declval<Queue&>().set_owner());
+    }    // namespace detail
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     struct lockfree_lifo;
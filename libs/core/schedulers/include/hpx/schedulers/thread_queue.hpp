@@ -11,9 +11,14 @@
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/concurrency/stack.hpp>
+#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/schedulers/deadline_queue.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
@@ -22,6 +27,7 @@
 #include <hpx/threading_base/thread_data_stackless.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
+#include <hpx/type_support/detected.hpp>
 
 #if defined(HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION)
 #include <hpx/schedulers/deadlock_detection.hpp>
@@ -44,9 +50,11 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -100,7 +108,9 @@ namespace hpx::threads::policies {
             std::unordered_set<thread_id_type, std::hash<thread_id_type>,
                 std::equal_to<>, util::internal_allocator<thread_id_type>>;
 
-        using thread_heap_type = std::vector<thread_id_type,
+        // recycled thread objects are kept in lock-free stacks, this allows
+        // for reusing them without acquiring the queue's mutex
+        using thread_heap_type = hpx::lockfree::stack<thread_id_type,
             util::internal_allocator<thread_id_type>>;
 
         struct task_description
@@ -132,76 +142,114 @@ namespace hpx::threads::policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_ref_type& thrd,
-            threads::thread_init_data& data, Lock& lk)
+        thread_heap_type* get_thread_heap(std::ptrdiff_t stacksize) noexcept
         {
-            HPX_ASSERT_OWNS_LOCK(lk);
-
-            std::ptrdiff_t const stacksize =
-                data.scheduler_base->get_stack_size(data.stacksize);
-
-#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            thread_heap_type* heap = nullptr;
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                heap = &thread_heap_small_;
+                return &thread_heap_small_;
             }
-            else if (stacksize == parameters_.medium_stacksize_)
+            if (stacksize == parameters_.medium_stacksize_)
             {
-                heap = &thread_heap_medium_;
+                return &thread_heap_medium_;
             }
-            else if (stacksize == parameters_.large_stacksize_)
+            if (stacksize == parameters_.large_stacksize_)
             {
-                heap = &thread_heap_large_;
+                return &thread_heap_large_;
             }
-            else if (stacksize == parameters_.huge_stacksize_)
+            if (stacksize == parameters_.huge_stacksize_)
             {
-                heap = &thread_heap_huge_;
+                return &thread_heap_huge_;
             }
-            else if (stacksize == parameters_.nostack_stacksize_)
+            if (stacksize == parameters_.nostack_stacksize_)
             {
-                heap = &thread_heap_nostack_;
+                return &thread_heap_nostack_;
             }
+            return nullptr;
+        }
+
+        // Take ownership of an unused thread object (if any) and rebind it.
+        // This does not require holding the lock.
+        bool reuse_thread_object([[maybe_unused]] std::ptrdiff_t stacksize,
+            [[maybe_unused]] threads::thread_id_ref_type& thrd,
+            [[maybe_unused]] threads::thread_init_data& data)
+        {
+            // ASAN gets confused by reusing threads/stacks
+#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
+            thread_heap_type* heap = get_thread_heap(stacksize);
             HPX_ASSERT(heap);
+
+            thread_id_type tid;
+            if (heap != nullptr && heap->pop(tid))    //-V522
+            {
+                thrd = tid;
+                get_thread_id_data(thrd)->rebind(data);
+                return true;
+            }
 #endif
+            return false;
+        }
 
+        // Allocate a new thread object.
+        void allocate_thread_object(std::ptrdiff_t stacksize,
+            threads::thread_id_ref_type& thrd, threads::thread_init_data& data)
+        {
+            threads::thread_data* p;
+            if (stacksize == parameters_.nostack_stacksize_)
+            {
+                p = threads::thread_data_stackless::create(
+                    data, this, stacksize);
+            }
+            else
+            {
+                p = threads::thread_data_stackful::create(
+                    data, this, stacksize);
+            }
+            thrd = thread_id_ref_type(p, thread_id_addref::no);
+        }
+
+        static void prepare_initial_state(
+            threads::thread_init_data& data) noexcept
+        {
             if (data.initial_state ==
                     thread_schedule_state::pending_do_not_schedule ||
                 data.initial_state == thread_schedule_state::pending_boost)
             {
                 data.initial_state = thread_schedule_state::pending;
             }
+        }
 
-            // ASAN gets confused by reusing threads/stacks
-#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            // Check for an unused thread object.
-            if (heap && !heap->empty())    //-V522
-            {
-                // Take ownership of the thread object and rebind it.
-                thrd = heap->back();
-                heap->pop_back();
-                get_thread_id_data(thrd)->rebind(data);
-            }
-            else
-#endif
+        // Create a thread object while holding the given lock, the lock is
+        // released while a new thread object is allocated.
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, Lock& lk)
+        {
+            HPX_ASSERT_OWNS_LOCK(lk);
+
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            prepare_initial_state(data);
+
+            if (!reuse_thread_object(stacksize, thrd, data))
             {
                 hpx::unlock_guard<Lock> ull(lk);
+                allocate_thread_object(stacksize, thrd, data);
+            }
+        }
 
-                // Allocate a new thread object.
-                threads::thread_data* p;
-                if (stacksize == parameters_.nostack_stacksize_)
-                {
-                    p = threads::thread_data_stackless::create(
-                        data, this, stacksize);
-                }
-                else
-                {
-                    p = threads::thread_data_stackful::create(
-                        data, this, stacksize);
-                }
-                thrd = thread_id_ref_type(p, thread_id_addref::no);
+        // Create a thread object without holding the lock.
+        void create_thread_object(
+            threads::thread_id_ref_type& thrd, threads::thread_init_data& data)
+        {
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            prepare_initial_state(data);
+
+            if (!reuse_thread_object(stacksize, thrd, data))
+            {
+                allocate_thread_object(stacksize, thrd, data);
             }
         }
 
@@ -276,9 +324,11 @@ namespace hpx::threads::policies {
                 HPX_ASSERT(schedule_now);
 
                 // pushing the new thread into the pending queue of the
-                // specified thread_queue
+                // specified thread_queue (bypassing the runnext slot, as this
+                // converts a whole batch of staged tasks)
                 ++added;
-                schedule_thread(HPX_MOVE(thrd));
+                ++work_items_count_.data_;
+                push_work_item(HPX_MOVE(thrd));
             }
 
             if (added)
@@ -314,7 +364,7 @@ namespace hpx::threads::policies {
             if (HPX_LIKELY(parameters_.max_thread_count_))
             {
                 std::int64_t const count =
-                    static_cast<std::int64_t>(thread_map_.size());
+                    thread_map_count_.load(std::memory_order_relaxed);
                 if (parameters_.max_thread_count_ >=
                     count + parameters_.min_add_new_count_)
                 {    //-V104
@@ -346,30 +396,25 @@ namespace hpx::threads::policies {
             return addednew != 0;
         }
 
+        // Add the threads created without holding the lock to the map of all
+        // threads, this has to be done before accessing the map.
+        void update_thread_map_locked() const
+        {
+            new_threads_.consume_all([this](thread_id_type const& tid) {
+                [[maybe_unused]] auto const p = thread_map_.emplace(tid);
+                HPX_ASSERT(p.second);
+            });
+        }
+
         void recycle_thread(thread_id_type const& thrd)
         {
             std::ptrdiff_t const stacksize =
                 get_thread_id_data(thrd)->get_stack_size();
 
-            if (stacksize == parameters_.small_stacksize_)
+            thread_heap_type* heap = get_thread_heap(stacksize);
+            if (heap != nullptr)
             {
-                thread_heap_small_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
-            {
-                thread_heap_medium_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.large_stacksize_)
-            {
-                thread_heap_large_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.huge_stacksize_)
-            {
-                thread_heap_huge_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.nostack_stacksize_)
-            {
-                thread_heap_nostack_.push_back(thrd);
+                heap->push(thrd);
             }
             else
             {
@@ -380,12 +425,17 @@ namespace hpx::threads::policies {
 
     public:
         // This function makes sure all threads which are marked for deletion
-        // (state is terminated) are properly destroyed.
+        // (state is terminated) are properly destroyed. The terminated threads
+        // are removed from the map while holding the lock, the lock is
+        // released before their thread objects are recycled.
         //
         // This returns 'true' if there are no more terminated threads waiting
         // to be deleted.
-        bool cleanup_terminated_locked(bool delete_all = false)
+        bool cleanup_terminated_locked(
+            std::unique_lock<mutex_type>& lk, bool delete_all = false)
         {
+            HPX_ASSERT_OWNS_LOCK(lk);
+
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             util::tick_counter tc(cleanup_terminated_time_);
 #endif
@@ -393,63 +443,55 @@ namespace hpx::threads::policies {
             if (terminated_items_count_.load(std::memory_order_acquire) == 0)
                 return true;
 
-            if (delete_all)
-            {
-                // delete all threads
-                thread_data* todelete;
-                while (terminated_items_.pop(todelete))
-                {
-                    thread_id_type tid(todelete);
-                    --terminated_items_count_;
-
-                    // this thread has to be managed by this queue, it may have
-                    // ended up on the terminate threads list more than once,
-                    // however
-                    HPX_ASSERT(
-                        &get_thread_id_data(tid)->get_queue<thread_queue>() ==
-                        this);
-
-                    if (thread_map_.erase(tid) != 0)
-                    {
-                        recycle_thread(tid);
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
-                }
-            }
-            else
+            // delete all threads
+            std::int64_t delete_count =
+                (std::numeric_limits<std::int64_t>::max)();
+            if (!delete_all)
             {
                 // delete only this many threads
-                std::int64_t delete_count = (std::min)(
+                delete_count = (std::min)(
                     static_cast<std::int64_t>(terminated_items_count_ / 10),
                     static_cast<std::int64_t>(parameters_.max_delete_count_));
 
                 // delete at least this many threads
                 delete_count = (std::max)(delete_count,
                     static_cast<std::int64_t>(parameters_.min_delete_count_));
+            }
 
-                thread_data* todelete;
-                while (delete_count && terminated_items_.pop(todelete))
-                {
-                    thread_id_type tid(todelete);
-                    --terminated_items_count_;
+            // the terminated threads may not have been added to the map yet
+            update_thread_map_locked();
 
-                    // this thread has to be managed by this queue, it may have
-                    // ended up on the terminate threads list more than once,
-                    // however
-                    HPX_ASSERT(
-                        &get_thread_id_data(tid)->get_queue<thread_queue>() ==
-                        this);
+            hpx::detail::small_vector<thread_id_type, 64> deleted;
 
-                    if (thread_map_.erase(tid) != 0)
-                    {
-                        recycle_thread(tid);
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
-                    --delete_count;
+            thread_data* todelete;
+            while (delete_count && terminated_items_.pop(todelete))
+            {
+                thread_id_type tid(todelete);
+                --terminated_items_count_;
+
+                // this thread has to be managed by this queue, it may have
+                // ended up on the terminate threads list more than once,
+                // however
+                HPX_ASSERT(
+                    &get_thread_id_data(tid)->get_queue<thread_queue>() ==
+                    this);
+
+                if (thread_map_.erase(tid) != 0)
+                {
+                    deleted.push_back(tid);
+                    --thread_map_count_;
+                    HPX_ASSERT(thread_map_count_ >= 0);
                 }
+                --delete_count;
             }
+
+            lk.unlock();
+
+            for (thread_id_type const& tid : deleted)
+            {
+                recycle_thread(tid);
+            }
+
             return terminated_items_count_.load(std::memory_order_acquire) == 0;
         }
 
@@ -468,7 +510,7 @@ namespace hpx::threads::policies {
                     if (!lk.owns_lock())
                         break;    // avoid long wait on lock
 
-                    if (cleanup_terminated_locked(false))
+                    if (cleanup_terminated_locked(lk, false))
                     {
                         return true;
                     }
@@ -480,12 +522,13 @@ namespace hpx::threads::policies {
             if (!lk.owns_lock())
                 return false;    // avoid long wait on lock
 
-            return cleanup_terminated_locked(false);
+            return cleanup_terminated_locked(lk, false);
         }
 
         explicit thread_queue(thread_queue_init_parameters const& parameters =
                                   thread_queue_init_parameters{})
           : parameters_(parameters)
+          , new_threads_(0)
           , thread_map_count_(0)
           , work_items_(128)
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -499,6 +542,11 @@ namespace hpx::threads::policies {
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
+          , thread_heap_small_(0)
+          , thread_heap_medium_(0)
+          , thread_heap_large_(0)
+          , thread_heap_huge_(0)
+          , thread_heap_nostack_(0)
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -511,6 +559,9 @@ namespace hpx::threads::policies {
           , stolen_to_pending_(0)
           , stolen_to_staged_(0)
 #endif
+          , runnext_(nullptr)
+          , runnext_owner_(std::thread::id())
+          , runnext_count_(0)
         {
             new_tasks_count_.data_ = 0;
             work_items_count_.data_ = 0;
@@ -523,20 +574,17 @@ namespace hpx::threads::policies {
 
         ~thread_queue()
         {
-            for (auto const& t : thread_heap_small_)
+            auto const deallocate_thread = [](thread_id_type const& t) {
                 deallocate(get_thread_id_data(t));
+            };
 
-            for (auto const& t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
+            thread_heap_small_.consume_all(deallocate_thread);
+            thread_heap_medium_.consume_all(deallocate_thread);
+            thread_heap_large_.consume_all(deallocate_thread);
+            thread_heap_huge_.consume_all(deallocate_thread);
+            thread_heap_nostack_.consume_all(deallocate_thread);
 
-            for (auto const& t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
+            HPX_ASSERT(runnext_.load(std::memory_order_relaxed) == nullptr);
         }
 
         thread_queue(thread_queue const&) = delete;
@@ -708,27 +756,21 @@ namespace hpx::threads::policies {
                 // suspended.
                 threads::thread_id_ref_type thrd;
 
-                std::unique_lock<mutex_type> lk(mtx_);
-
                 bool const schedule_now =
                     data.initial_state == thread_schedule_state::pending;
 
-                create_thread_object(thrd, data, lk);
+                // recycled thread objects can be reused without holding the
+                // lock, the new thread is added to the map of all threads
+                // lazily (see update_thread_map_locked)
+                create_thread_object(thrd, data);
 
-                // add a new entry in the map for this thread
-                std::pair<thread_map_type::iterator, bool> const p =
-                    thread_map_.emplace(thrd.noref());
-
-                if (HPX_UNLIKELY(!p.second))
+                if (HPX_UNLIKELY(!new_threads_.push(thrd.noref())))
                 {
-                    lk.unlock();
                     HPX_THROWS_BAD_ALLOC_IF(ec, "thread_queue::create_thread");
                     return;
                 }
                 ++thread_map_count_;
 
-                // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd.noref()) != thread_map_.end());
                 HPX_ASSERT(
                     &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
                     this);
@@ -783,6 +825,36 @@ namespace hpx::threads::policies {
                 ec = make_success_code();
         }
 
+        // register a batch of task descriptions for later thread creation,
+        // all of them must be pending and must not be run right away
+        void create_threads(thread_init_data* data, std::size_t count)
+        {
+            // reserve the slots for all new tasks at once
+            new_tasks_count_.data_ += static_cast<std::int64_t>(count);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+
+                HPX_ASSERT(!d.run_now);
+                HPX_ASSERT(d.initial_state == thread_schedule_state::pending);
+
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{
+                    HPX_MOVE(d), hpx::chrono::high_resolution_clock::now()};
+#else
+                new (td) task_description{HPX_MOVE(d)};    //-V106
+#endif
+                new_tasks_.push(td);
+            }
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description_ptr trd;
@@ -861,37 +933,111 @@ namespace hpx::threads::policies {
                 return false;
             }
 
-#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
-            thread_description_ptr tdesc;
-            if (work_items_.pop(tdesc, steal))
+            // The owning worker prefers the thread in the runnext slot, but
+            // only for a limited number of times in a row to avoid starving
+            // the threads waiting in the queue.
+            if (!allow_stealing && !steal &&
+                parameters_.max_runnext_count_ != 0 && is_runnext_owner())
             {
-                --work_items_count_.data_;
-
-                if (get_maintain_queue_wait_times_enabled())
+                if (runnext_count_ < parameters_.max_runnext_count_ &&
+                    pop_runnext(thrd))
                 {
-                    work_items_wait_ +=
-                        hpx::chrono::high_resolution_clock::now() -
-                        tdesc->waittime;
-                    ++work_items_wait_count_;
+                    ++runnext_count_;
+                    return true;
                 }
+                runnext_count_ = 0;
+            }
 
-                thrd = HPX_MOVE(tdesc->data);
-                delete tdesc;
-
+            if (pop_work_item(thrd, steal))
+            {
                 return true;
             }
-#else
-            thread_description_ptr next_thrd;
-            if (work_items_.pop(next_thrd, steal))
+
+            // the runnext slot is the last resort for everybody else
+            return pop_runnext(thrd);
+        }
+
+    private:
+        bool is_runnext_owner() const noexcept
+        {
+            return runnext_owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        bool pop_runnext(threads::thread_id_ref_type& thrd) noexcept
+        {
+            if (runnext_.load(std::memory_order_relaxed) == nullptr)
             {
-                thrd.reset(next_thrd, false);    // do not addref!
-                --work_items_count_.data_;
-                return true;
+                return false;
+            }
+
+            thread_id_ref_type::thread_repr* next_thrd =
+                runnext_.exchange(nullptr, std::memory_order_acquire);
+            if (next_thrd == nullptr)
+            {
+                return false;
+            }
+
+            thrd.reset(next_thrd, false);    // do not addref!
+            --work_items_count_.data_;
+            return true;
+        }
+
+        // threads with a deadline are run before all other pending threads
+        bool pop_work_item(threads::thread_id_ref_type& thrd, bool steal)
+        {
+            thread_description_ptr tdesc;
+            if (!deadline_items_.pop(tdesc) && !work_items_.pop(tdesc, steal))
+            {
+                return false;
             }
+
+            --work_items_count_.data_;
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            if (get_maintain_queue_wait_times_enabled())
+            {
+                work_items_wait_ +=
+                    hpx::chrono::high_resolution_clock::now() - tdesc->waittime;
+                ++work_items_wait_count_;
+            }
+
+            thrd = HPX_MOVE(tdesc->data);
+            delete tdesc;
+#else
+            thrd.reset(tdesc, false);    // do not addref!
 #endif
-            return false;
+            return true;
         }
 
+        // push the passed thread onto the queue of pending work items, the
+        // caller is responsible for updating work_items_count_
+        void push_work_item(
+            threads::thread_id_ref_type thrd, bool other_end = false)
+        {
+            std::uint64_t const deadline =
+                get_thread_id_data(thrd)->get_deadline();
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            thread_description_ptr tdesc = new thread_description{
+                HPX_MOVE(thrd), hpx::chrono::high_resolution_clock::now()};
+#else
+            // detach the thread from the id_ref without decrementing
+            // the reference count
+            thread_description_ptr tdesc = thrd.detach();
+#endif
+            if (deadline != 0)
+            {
+                deadline_items_.push(deadline, tdesc);
+            }
+            else
+            {
+                work_items_.push(tdesc, other_end);
+            }
+        }
+
+    public:
+
         // Return the next thread to be executed, return false if none is
         // available
         template <typename Iterator>
@@ -969,20 +1115,33 @@ namespace hpx::threads::policies {
         }
 
         // Schedule the passed thread
+        //
+        // If enabled, a thread scheduled by the worker owning this queue is
+        // put into the runnext slot instead, from where it will be picked up
+        // next by that worker (similar to Go's or Tokio's runnext). A thread
+        // previously held by the slot is moved to the queue.
         void schedule_thread(
             threads::thread_id_ref_type thrd, bool other_end = false)
         {
             ++work_items_count_.data_;
 
-#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
-            work_items_.push(new thread_description{HPX_MOVE(thrd),
-                                 hpx::chrono::high_resolution_clock::now()},
-                other_end);
-#else
-            // detach the thread from the id_ref without decrementing
-            // the reference count
-            work_items_.push(thrd.detach(), other_end);
-#endif
+            // threads with a deadline are ordered by their deadline instead
+            if (!other_end && parameters_.max_runnext_count_ != 0 &&
+                is_runnext_owner() &&
+                get_thread_id_data(thrd)->get_deadline() == 0)
+            {
+                thread_id_ref_type::thread_repr* prev_thrd = runnext_.exchange(
+                    thrd.detach(), std::memory_order_acq_rel);
+                if (prev_thrd == nullptr)
+                {
+                    return;
+                }
+
+                // do not addref!
+                thrd = thread_id_ref_type(prev_thrd, thread_id_addref::no);
+            }
+
+            push_work_item(HPX_MOVE(thrd), other_end);
         }
 
         // Destroy the passed thread as it has been terminated
@@ -1017,6 +1176,7 @@ namespace hpx::threads::policies {
 
             // acquire lock only if absolutely necessary
             std::lock_guard<mutex_type> lk(mtx_);
+            update_thread_map_locked();
 
             std::int64_t num_threads = 0;
             auto const end = thread_map_.end();
@@ -1032,6 +1192,7 @@ namespace hpx::threads::policies {
         void abort_all_suspended_threads()
         {
             std::lock_guard<mutex_type> lk(mtx_);
+            update_thread_map_locked();
             auto const end = thread_map_.end();
             for (auto it = thread_map_.begin(); it != end; ++it)
             {
@@ -1071,6 +1232,7 @@ namespace hpx::threads::policies {
             if (state == thread_schedule_state::unknown)
             {
                 std::lock_guard<mutex_type> lk(mtx_);
+                update_thread_map_locked();
                 auto const end = thread_map_.end();
                 for (auto it = thread_map_.begin(); it != end; ++it)
                 {
@@ -1080,6 +1242,7 @@ namespace hpx::threads::policies {
             else
             {
                 std::lock_guard<mutex_type> lk(mtx_);
+                update_thread_map_locked();
                 auto const end = thread_map_.end();
                 for (auto it = thread_map_.begin(); it != end; ++it)
                 {
@@ -1180,7 +1343,7 @@ namespace hpx::threads::policies {
                     // Before exiting each of the OS threads deletes the
                     // remaining terminated HPX threads
                     // REVIEW: Should we be doing this if we are stealing?
-                    bool const canexit = cleanup_terminated_locked(true);
+                    bool const canexit = cleanup_terminated_locked(lk, true);
                     if (!running && canexit)
                     {
                         // we don't have any registered work items anymore
@@ -1191,7 +1354,7 @@ namespace hpx::threads::policies {
                 }
                 else
                 {
-                    cleanup_terminated_locked();
+                    cleanup_terminated_locked(lk);
                     return false;
                 }
             }
@@ -1217,6 +1380,7 @@ namespace hpx::threads::policies {
             if (get_minimal_deadlock_detection_enabled())
             {
                 std::lock_guard<mutex_type> lk(mtx_);
+                update_thread_map_locked();
                 return detail::dump_suspended_threads(
                     num_thread, thread_map_, idle_loop_count, running);
             }
@@ -1227,10 +1391,24 @@ namespace hpx::threads::policies {
         ///////////////////////////////////////////////////////////////////////
         void on_start_thread(std::size_t /* num_thread */)
         {
-            thread_heap_small_.reserve(parameters_.init_threads_count_);
-            thread_heap_medium_.reserve(parameters_.init_threads_count_);
-            thread_heap_large_.reserve(parameters_.init_threads_count_);
-            thread_heap_huge_.reserve(parameters_.init_threads_count_);
+            // the worker starting this queue owns the runnext slot
+            runnext_owner_.store(
+                std::this_thread::get_id(), std::memory_order_relaxed);
+            runnext_count_ = 0;
+
+            // ... and the local end of the pending queue, if applicable
+            if constexpr (hpx::util::is_detected_v<detail::queue_set_owner_t,
+                              work_items_type>)
+            {
+                work_items_.set_owner();
+            }
+
+            auto const init_threads_count =
+                static_cast<std::size_t>(parameters_.init_threads_count_);
+            thread_heap_small_.reserve(init_threads_count);
+            thread_heap_medium_.reserve(init_threads_count);
+            thread_heap_large_.reserve(init_threads_count);
+            thread_heap_huge_.reserve(init_threads_count);
 
             // Pre-allocate init_threads_count threads, with accompanying stack,
             // with the default stack size
@@ -1241,7 +1419,6 @@ namespace hpx::threads::policies {
                 "fails you've most likely changed the default without changing "
                 "the code here.");
 
-            std::lock_guard<mutex_type> lk(mtx_);
             for (std::int64_t i = 0; i < parameters_.init_threads_count_; ++i)
             {
                 // We don't care about the init parameters since this thread
@@ -1256,10 +1433,19 @@ namespace hpx::threads::policies {
                 HPX_ASSERT(p);
 
                 // Finally, store the thread for later use
-                thread_heap_small_.emplace_back(p);
+                thread_heap_small_.push(thread_id_type(p));
+            }
+        }
+        void on_stop_thread(std::size_t) noexcept
+        {
+            runnext_owner_.store(std::thread::id(), std::memory_order_relaxed);
+
+            if constexpr (hpx::util::is_detected_v<detail::queue_set_owner_t,
+                              work_items_type>)
+            {
+                work_items_.reset_owner();
             }
         }
-        static constexpr void on_stop_thread(std::size_t) noexcept {}
         static constexpr void on_error(
             std::size_t, std::exception_ptr const&) noexcept
         {
@@ -1270,7 +1456,12 @@ namespace hpx::threads::policies {
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
-        thread_map_type thread_map_;    // mapping of thread id's to HPX-threads
+        // mapping of thread id's to HPX-threads
+        mutable thread_map_type thread_map_;
+
+        // threads created without holding the lock, these are added to
+        // thread_map_ by the next thread accessing the map
+        mutable thread_heap_type new_threads_;
 
         // overall count of work items
         std::atomic<std::int64_t> thread_map_count_;
@@ -1328,8 +1519,21 @@ namespace hpx::threads::policies {
         // sharing
         util::cache_line_data<std::atomic<std::int64_t>> new_tasks_count_;
 
-        // count of active work items
+        // count of active work items (including the one in the runnext slot)
         util::cache_line_data<std::atomic<std::int64_t>> work_items_count_;
+
+        // the thread most recently scheduled by the owning worker
+        std::atomic<thread_id_ref_type::thread_repr*> runnext_;
+
+        // the worker owning the runnext slot
+        std::atomic<std::thread::id> runnext_owner_;
+
+        // number of consecutive threads taken from the runnext slot, only
+        // accessed by the owning worker
+        std::int64_t runnext_count_;
+
+        // pending threads that have a deadline
+        detail::deadline_queue<thread_description_ptr> deadline_items_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -11,7 +11,9 @@
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/deadline_queue.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/queue_holder_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -21,6 +23,7 @@
 #include <hpx/timing/tick_counter.hpp>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -31,6 +34,7 @@
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #if !defined(THREAD_QUEUE_MC_DEBUG)
 #if defined(HPX_DEBUG)
@@ -260,7 +264,9 @@ namespace hpx::threads::policies {
             std::int64_t const work_items_count_count =
                 work_items_count_.data_.load(std::memory_order_relaxed);
 
-            if (0 != work_items_count_count && work_items_.pop(thrd, other_end))
+            // threads with a deadline are run before all other pending threads
+            if (0 != work_items_count_count &&
+                (deadline_items_.pop(thrd) || work_items_.pop(thrd, other_end)))
             {
                 --work_items_count_.data_;
                 tqmc_deb.debug(debug::str<>("get_next_thread"), "stealing",
@@ -291,6 +297,14 @@ namespace hpx::threads::policies {
                 debug::dec<4>(work_items_count_.data_),
                 debug::threadinfo<threads::thread_id_ref_type*>(&thrd));
 
+            if (std::uint64_t const deadline =
+                    get_thread_id_data(thrd)->get_deadline();
+                deadline != 0)
+            {
+                deadline_items_.push(deadline, HPX_MOVE(thrd));
+                return;
+            }
+
             work_items_.push(HPX_MOVE(thrd), other_end);
 #ifdef DEBUG_QUEUE_EXTRA
             debug_queue(work_items_);
@@ -349,6 +363,9 @@ namespace hpx::threads::policies {
         util::cache_line_data<std::atomic<std::int32_t>> new_tasks_count_;
         util::cache_line_data<std::atomic<std::int32_t>> work_items_count_;
 
+        // pending threads that have a deadline
+        detail::deadline_queue<threads::thread_id_ref_type> deadline_items_;
+
 #ifdef DEBUG_QUEUE_EXTRA
         std::mutex debug_mtx_;
 #endif
@@ -0,0 +1,212 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that pending threads with a deadline are run earliest deadline first
+// and that threads finishing after their deadline are counted.
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+void register_thread_with_deadline(
+    hpx::threads::thread_function_type&& f, std::uint64_t deadline)
+{
+    hpx::threads::thread_init_data data(HPX_MOVE(f),
+        "register_thread_with_deadline", hpx::threads::thread_priority::normal,
+        hpx::threads::thread_schedule_hint(
+            static_cast<std::int16_t>(hpx::get_worker_thread_num())),
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_state::pending, true);
+    data.deadline = deadline;
+    hpx::threads::register_thread(data);
+}
+
+void test_run_order()
+{
+    std::mutex mtx;
+    std::vector<int> order;
+    hpx::latch l(5);
+
+    auto make_thread = [&](int id) {
+        register_thread_with_deadline(
+            hpx::threads::make_thread_function_nullary([&, id]() {
+                {
+                    std::lock_guard<std::mutex> lk(mtx);
+                    order.push_back(id);
+                }
+                l.count_down(1);
+            }),
+            hpx::threads::make_thread_deadline(std::chrono::seconds(id)));
+    };
+
+    // the threads are run in the order of their deadlines
+    make_thread(3);
+    make_thread(1);
+    make_thread(4);
+    make_thread(2);
+
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(order.size(), static_cast<std::size_t>(4));
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], static_cast<int>(i + 1));
+    }
+}
+
+void test_missed_deadlines()
+{
+    auto* pool = hpx::threads::detail::get_self_or_default_pool();
+    std::int64_t const missed = pool->get_num_missed_deadlines(
+        static_cast<std::size_t>(-1), false);
+
+    hpx::latch l(3);
+    auto const count_down = [&]() { l.count_down(1); };
+
+    // the first thread has missed its deadline before it even started
+    register_thread_with_deadline(
+        hpx::threads::make_thread_function_nullary(count_down), 1);
+    register_thread_with_deadline(
+        hpx::threads::make_thread_function_nullary(count_down),
+        hpx::threads::make_thread_deadline(std::chrono::hours(1)));
+
+    l.arrive_and_wait();
+
+    // the counters are updated only after the threads have terminated
+    hpx::this_thread::yield();
+    while (pool->get_num_missed_deadlines(
+               static_cast<std::size_t>(-1), false) == missed)
+    {
+        hpx::this_thread::yield();
+    }
+
+    HPX_TEST_EQ(pool->get_num_missed_deadlines(
+                    static_cast<std::size_t>(-1), false),
+        missed + 1);
+}
+
+void test_executor_deadline()
+{
+    namespace ex = hpx::execution::experimental;
+
+    hpx::execution::parallel_executor exec;
+    HPX_TEST(ex::get_deadline(exec) == std::chrono::nanoseconds(0));
+
+    hpx::async(exec, []() {
+        HPX_TEST_EQ(hpx::threads::get_self_id_data()->get_deadline(),
+            static_cast<std::uint64_t>(0));
+    }).get();
+
+    auto deadline_exec = ex::with_deadline(exec, std::chrono::seconds(10));
+    HPX_TEST(ex::get_deadline(deadline_exec) == std::chrono::seconds(10));
+
+    std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+    hpx::async(deadline_exec, [now]() {
+        std::uint64_t const deadline =
+            hpx::threads::get_self_id_data()->get_deadline();
+        HPX_TEST_LT(now, deadline);
+        HPX_TEST_LTE(deadline,
+            hpx::chrono::high_resolution_clock::now() + 10'000'000'000ULL);
+    }).get();
+
+    hpx::latch l(2);
+    hpx::parallel::execution::post(deadline_exec, [&]() {
+        HPX_TEST_NEQ(hpx::threads::get_self_id_data()->get_deadline(),
+            static_cast<std::uint64_t>(0));
+        l.count_down(1);
+    });
+    l.arrive_and_wait();
+
+    // the deadline is applied to continuations and to bulk tasks as well
+    auto const has_deadline = []() {
+        return hpx::threads::get_self_id_data()->get_deadline() != 0;
+    };
+
+    hpx::future<bool> f = hpx::make_ready_future().then(
+        deadline_exec, [&](hpx::future<void>&&) { return has_deadline(); });
+    HPX_TEST(f.get());
+
+    auto hierarchical_exec = deadline_exec;
+    hierarchical_exec.set_hierarchical_threshold(10);
+
+    for (auto const& bulk_exec : {deadline_exec, hierarchical_exec})
+    {
+        std::atomic<int> count(0);
+        hpx::parallel::execution::bulk_async_execute(
+            bulk_exec,
+            [&](int) {
+                if (has_deadline())
+                {
+                    ++count;
+                }
+            },
+            100)
+            .get();
+        HPX_TEST_EQ(count.load(), 100);
+
+        auto results = hpx::parallel::execution::bulk_async_execute(
+            bulk_exec, [&](int) { return has_deadline(); }, 100);
+        for (auto& r : results)
+        {
+            HPX_TEST(r.get());
+        }
+    }
+
+    // threads created outside of the executor are not affected
+    hpx::async([&]() { HPX_TEST(!has_deadline()); }).get();
+}
+
+int hpx_main()
+{
+    // the run order is deterministic only if a single worker is used
+    if (hpx::get_num_worker_threads() == 1)
+    {
+        test_run_order();
+    }
+
+    test_missed_deadlines();
+    test_executor_deadline();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // clang-format off
+    std::vector<std::string> const schedulers = {
+        "local",
+        "local-priority-fifo",
+        "local-priority-chase-lev",
+        "static",
+        "shared-priority",
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        "local-workrequesting-fifo",
+#endif
+    };
+    // clang-format on
+
+    for (auto const& scheduler : schedulers)
+    {
+        hpx::local::init_params init_args;
+        init_args.cfg = {"--hpx:queuing=" + scheduler};
+
+        HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    }
+
+    return hpx::util::report_errors();
+}
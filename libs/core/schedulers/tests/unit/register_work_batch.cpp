@@ -0,0 +1,152 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that batches of work items are created and run by all schedulers,
+// independently of their priorities and scheduling hints.
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+hpx::threads::thread_init_data make_thread_init_data(hpx::latch& l,
+    hpx::threads::thread_priority priority,
+    hpx::threads::thread_schedule_hint hint,
+    hpx::threads::thread_schedule_state initial_state)
+{
+    return hpx::threads::thread_init_data(
+        hpx::threads::make_thread_function_nullary([&l]() {
+            ++count;
+            l.count_down(1);
+        }),
+        "register_work_batch", priority, hint,
+        hpx::threads::thread_stacksize::default_, initial_state);
+}
+
+void test_register_work_batch(hpx::threads::thread_priority priority,
+    bool use_hint,
+    hpx::threads::thread_schedule_state initial_state =
+        hpx::threads::thread_schedule_state::pending)
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    std::size_t constexpr num_tasks = 100;
+
+    count = 0;
+    hpx::latch l(num_tasks + 1);
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // group a few consecutive tasks for the same worker thread
+        hpx::threads::thread_schedule_hint hint;
+        if (use_hint)
+        {
+            hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>((i / 3) % num_threads));
+        }
+        data.push_back(
+            make_thread_init_data(l, priority, hint, initial_state));
+    }
+
+    hpx::threads::register_work_batch(data);
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+void test_invalid_state()
+{
+    std::vector<hpx::threads::thread_init_data> data;
+    data.emplace_back(hpx::threads::make_thread_function_nullary([]() {}),
+        "test_invalid_state", hpx::threads::thread_priority::normal,
+        hpx::threads::thread_schedule_hint(),
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_state::suspended);
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    hpx::threads::register_work_batch(data, ec);
+    HPX_TEST(ec);
+    HPX_TEST(ec.value() == hpx::error::bad_parameter);
+}
+
+void test_bulk_async_execute()
+{
+    std::vector<int> v(1007);
+    std::iota(v.begin(), v.end(), 0);
+
+    std::atomic<std::size_t> invocations(0);
+    hpx::parallel::execution::bulk_async_execute(
+        hpx::execution::parallel_executor(),
+        [&](int) { ++invocations; }, v)
+        .get();
+
+    HPX_TEST_EQ(invocations.load(), v.size());
+}
+
+int hpx_main()
+{
+    for (bool const use_hint : {false, true})
+    {
+        test_register_work_batch(
+            hpx::threads::thread_priority::default_, use_hint);
+        test_register_work_batch(
+            hpx::threads::thread_priority::normal, use_hint);
+        test_register_work_batch(
+            hpx::threads::thread_priority::high, use_hint);
+        test_register_work_batch(hpx::threads::thread_priority::low, use_hint);
+
+        // high priority work items are run right away, pending_boost work
+        // items must be scheduled nevertheless
+        test_register_work_batch(hpx::threads::thread_priority::high,
+            use_hint, hpx::threads::thread_schedule_state::pending_boost);
+        test_register_work_batch(hpx::threads::thread_priority::normal,
+            use_hint, hpx::threads::thread_schedule_state::pending_boost);
+    }
+
+    test_invalid_state();
+    test_bulk_async_execute();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // clang-format off
+    std::vector<std::string> const schedulers = {
+        "local",
+        "local-priority-fifo",
+        "local-priority-chase-lev",
+        "static",
+        "static-priority",
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        "local-workrequesting-fifo",
+#endif
+    };
+    // clang-format on
+
+    for (auto const& scheduler : schedulers)
+    {
+        hpx::local::init_params init_args;
+        init_args.cfg = {"--hpx:queuing=" + scheduler};
+
+        HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    }
+
+    return hpx::util::report_errors();
+}
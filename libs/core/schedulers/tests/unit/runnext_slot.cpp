@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that a thread made ready by a worker is run next by that worker if
+// the runnext slot of the thread queues is enabled.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+bool runnext_enabled = false;
+std::atomic<std::size_t> count(0);
+
+void test_run_order()
+{
+    std::mutex mtx;
+    std::vector<int> order;
+    hpx::latch l(3);
+
+    auto make_thread = [&](int id) {
+        hpx::threads::thread_init_data data(
+            hpx::threads::make_thread_function_nullary([&, id]() {
+                {
+                    std::lock_guard<std::mutex> lk(mtx);
+                    order.push_back(id);
+                }
+                l.count_down(1);
+            }),
+            "test_run_order", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(hpx::get_worker_thread_num())),
+            hpx::threads::thread_stacksize::default_,
+            hpx::threads::thread_schedule_state::pending, true);
+        hpx::threads::register_thread(data);
+    };
+
+    // the second thread displaces the first one from the runnext slot
+    make_thread(1);
+    make_thread(2);
+
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(order.size(), static_cast<std::size_t>(2));
+    if (runnext_enabled)
+    {
+        HPX_TEST_EQ(order[0], 2);
+        HPX_TEST_EQ(order[1], 1);
+    }
+    else
+    {
+        HPX_TEST_EQ(order[0], 1);
+        HPX_TEST_EQ(order[1], 2);
+    }
+}
+
+void spawn_tree(std::size_t depth)
+{
+    ++count;
+    if (depth == 0)
+        return;
+
+    std::vector<hpx::future<void>> children;
+    children.reserve(2);
+    for (int i = 0; i != 2; ++i)
+    {
+        children.push_back(hpx::async(&spawn_tree, depth - 1));
+    }
+    hpx::wait_all(children);
+}
+
+int hpx_main()
+{
+    // the run order is deterministic only if a single worker is used
+    if (hpx::get_num_worker_threads() == 1)
+    {
+        test_run_order();
+    }
+
+    std::size_t constexpr depth = 12;
+    spawn_tree(depth);
+
+    HPX_TEST_EQ(count.load(), (std::size_t(1) << (depth + 1)) - 1);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // clang-format off
+    std::vector<std::string> const schedulers = {
+        "local",
+        "local-priority-fifo",
+        "static",
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        "local-workrequesting-fifo",
+#endif
+    };
+    // clang-format on
+
+    for (auto const& scheduler : schedulers)
+    {
+        for (bool const enabled : {false, true})
+        {
+            count = 0;
+            runnext_enabled = enabled;
+
+            hpx::local::init_params init_args;
+            init_args.cfg = {"--hpx:queuing=" + scheduler,
+                std::string("hpx.thread_queue.max_runnext_count=") +
+                    (enabled ? "3" : "0")};
+
+            HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+        }
+    }
+
+    return hpx::util::report_errors();
+}
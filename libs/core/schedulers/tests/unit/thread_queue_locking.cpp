@@ -0,0 +1,181 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that creating and terminating threads does not acquire the mutex of
+// the thread queues for each of the threads. The scheduler used here counts
+// the acquisitions of the mutex of its thread queues.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/thread_pools/scheduled_thread_pool_impl.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_threads = 1000;
+
+std::atomic<std::size_t> lock_count(0);
+
+// counts acquisitions made by the OS thread it is set on only
+thread_local bool count_locks_on_this_thread = false;
+thread_local std::size_t locks_on_this_thread = 0;
+
+struct counting_mutex
+{
+    void lock()
+    {
+        mtx_.lock();
+        count();
+    }
+
+    bool try_lock()
+    {
+        if (!mtx_.try_lock())
+        {
+            return false;
+        }
+        count();
+        return true;
+    }
+
+    void unlock()
+    {
+        mtx_.unlock();
+    }
+
+private:
+    static void count() noexcept
+    {
+        ++lock_count;
+        if (count_locks_on_this_thread)
+        {
+            ++locks_on_this_thread;
+        }
+    }
+
+    std::mutex mtx_;
+};
+
+void create_thread(hpx::latch& l)
+{
+    hpx::threads::thread_init_data data(
+        hpx::threads::make_thread_function_nullary(
+            [&l]() { l.count_down(1); }),
+        "create_thread", hpx::threads::thread_priority::normal,
+        hpx::threads::thread_schedule_hint(),
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_state::pending, true);
+    hpx::threads::register_thread(data);
+}
+
+// creating a thread doesn't touch the queue's mutex
+void test_create_threads()
+{
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_threads + 1));
+
+    count_locks_on_this_thread = true;
+    locks_on_this_thread = 0;
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        create_thread(l);
+    }
+
+    std::size_t const locks = locks_on_this_thread;
+    count_locks_on_this_thread = false;
+
+    HPX_TEST_EQ(locks, static_cast<std::size_t>(0));
+
+    l.arrive_and_wait();
+}
+
+// threads created and terminated concurrently on all workers take the mutex
+// only for cleaning up a whole batch of terminated threads
+void test_create_terminate_threads()
+{
+    std::size_t const num_workers = hpx::get_num_worker_threads();
+    std::size_t const threads_per_worker = num_threads / num_workers;
+
+    hpx::latch l(
+        static_cast<std::ptrdiff_t>(num_workers * threads_per_worker + 1));
+
+    lock_count = 0;
+
+    std::vector<hpx::future<void>> creators;
+    creators.reserve(num_workers);
+    for (std::size_t i = 0; i != num_workers; ++i)
+    {
+        creators.push_back(hpx::async([&l, threads_per_worker]() {
+            for (std::size_t j = 0; j != threads_per_worker; ++j)
+            {
+                create_thread(l);
+            }
+        }));
+    }
+
+    hpx::wait_all(creators);
+    l.arrive_and_wait();
+
+    HPX_TEST_LT(lock_count.load(), num_threads / 2);
+}
+
+int hpx_main()
+{
+    test_create_threads();
+    test_create_terminate_threads();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using scheduler_type =
+        hpx::threads::policies::local_priority_queue_scheduler<counting_mutex,
+            hpx::threads::policies::lockfree_fifo>;
+
+    hpx::local::init_params init_args;
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [](hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                scheduler_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, std::size_t(-1),
+                    thread_queue_init);
+                std::unique_ptr<scheduler_type> scheduler(
+                    new scheduler_type(init));
+
+                thread_pool_init.mode_ = hpx::threads::policies::scheduler_mode(
+                    hpx::threads::policies::scheduler_mode::do_background_work |
+                    hpx::threads::policies::scheduler_mode::
+                        reduce_thread_priority |
+                    hpx::threads::policies::scheduler_mode::delay_exit);
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        scheduler_type>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the work-requesting scheduler runs all work when victims are
+// selected by their topological distance to the thief, and that closer
+// victims are always asked before more distant ones.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void test_cache_affinity_masks()
+{
+    auto const& topo = hpx::threads::create_topology();
+    for (std::size_t i = 0; i != topo.get_number_of_pus(); ++i)
+    {
+        // a PU shares its caches with all PUs on the same core
+        auto const cache_mask = topo.get_cache_affinity_mask(i, 3);
+        auto const& core_mask = topo.get_core_affinity_mask(i);
+
+        HPX_TEST(hpx::threads::any(cache_mask));
+        HPX_TEST(hpx::threads::equal(
+            cache_mask & core_mask, core_mask, topo.get_number_of_pus()));
+    }
+}
+
+void spawn_tree(std::size_t depth)
+{
+    ++count;
+    if (depth == 0)
+        return;
+
+    std::vector<hpx::future<void>> children;
+    children.reserve(2);
+    for (int i = 0; i != 2; ++i)
+    {
+        children.push_back(hpx::async(&spawn_tree, depth - 1));
+    }
+    hpx::wait_all(children);
+}
+
+void test_steal_order()
+{
+    auto* scheduler = hpx::threads::get_self_id_data()->get_scheduler_base();
+    auto const all_threads = static_cast<std::size_t>(-1);
+
+    // idle workers keep sending steal requests, so some must have been sent
+    // (a single worker has nobody to send steal requests to)
+    std::int64_t num_requests = 0;
+    for (std::size_t distance = 0; distance != 4; ++distance)
+    {
+        num_requests += scheduler->get_num_steal_requests_by_distance(
+            all_threads, distance, false);
+    }
+    if (hpx::get_os_thread_count() > 1)
+    {
+        HPX_TEST_LT(std::int64_t(0), num_requests);
+    }
+
+    // no steal request may have been sent on to a victim while a
+    // topologically closer core had not been asked yet
+    HPX_TEST_EQ(
+        scheduler->get_num_steal_requests_skipping_closer(all_threads, false),
+        std::int64_t(0));
+}
+
+int hpx_main()
+{
+    test_cache_affinity_masks();
+
+    std::size_t constexpr depth = 14;
+    spawn_tree(depth);
+
+    HPX_TEST_EQ(count.load(), (std::size_t(1) << (depth + 1)) - 1);
+
+    test_steal_order();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // clang-format off
+    std::vector<std::string> const schedulers = {
+        "local-workrequesting-fifo",
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        "local-workrequesting-lifo",
+#endif
+        "local-workrequesting-mc",
+    };
+    // clang-format on
+
+    // idle workers start sending steal requests right away only in fast
+    // idle mode
+    auto const mode = hpx::threads::policies::scheduler_mode::default_ |
+        hpx::threads::policies::scheduler_mode::fast_idle_mode |
+        hpx::threads::policies::scheduler_mode::steal_hierarchically;
+
+    for (auto const& scheduler : schedulers)
+    {
+        count = 0;
+
+        hpx::local::init_params init_args;
+        init_args.cfg = {"--hpx:queuing=!" + scheduler,
+            "hpx.default_scheduler_mode=" +
+                std::to_string(static_cast<std::uint32_t>(mode))};
+
+        HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    }
+
+    return hpx::util::report_errors();
+}
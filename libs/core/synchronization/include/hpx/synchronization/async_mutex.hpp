@@ -0,0 +1,62 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/synchronization/async_semaphore.hpp>
+
+namespace hpx::experimental {
+
+    /// Mutex where the lock is acquired through senders.
+    ///
+    /// The sender returned by lock() calls set_value on a connected receiver
+    /// once the mutex has been locked on behalf of that receiver. The mutex
+    /// has to be released by calling unlock() afterwards, which hands the
+    /// lock directly to the next waiting operation (if any), in the order in
+    /// which the waiting operations were started. No thread is blocked while
+    /// waiting for the lock and waiting does not allocate any memory (see
+    /// async_semaphore).
+    ///
+    /// \code
+    ///     mtx.lock() | then([&] {
+    ///         // critical section
+    ///         mtx.unlock();
+    ///     });
+    /// \endcode
+    ///
+    /// The mutex is neither copyable nor movable, it has to outlive all
+    /// operations started on it.
+    class async_mutex
+    {
+    public:
+        async_mutex() noexcept
+          : sem_(1)
+        {
+        }
+
+        // Return a sender that completes once the mutex has been locked.
+        [[nodiscard]] auto lock() noexcept
+        {
+            return sem_.acquire();
+        }
+
+        // Try to lock the mutex without waiting.
+        [[nodiscard]] bool try_lock() noexcept
+        {
+            return sem_.try_acquire();
+        }
+
+        // Unlock the mutex, completes the next waiting operation (if any).
+        void unlock()
+        {
+            sem_.release(1);
+        }
+
+    private:
+        async_semaphore sem_;
+    };
+}    // namespace hpx::experimental
@@ -0,0 +1,350 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::experimental {
+
+    namespace detail {
+
+        ////////////////////////////////////////////////////////////////////////
+        // Every operation state waiting for an async_semaphore embeds one of
+        // these. Waiters are linked through the embedded pointer, enqueuing a
+        // waiter does not allocate any memory.
+        struct async_semaphore_waiter
+        {
+            using complete_function_type =
+                void (*)(async_semaphore_waiter*) noexcept;
+
+            explicit constexpr async_semaphore_waiter(
+                complete_function_type complete) noexcept
+              : next(nullptr)
+              , complete(complete)
+            {
+            }
+
+            std::atomic<async_semaphore_waiter*> next;
+            complete_function_type complete;
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Intrusive multi-producer single-consumer FIFO queue of waiters (see
+        // Dmitry Vyukov, "Intrusive MPSC node-based queue"). Pushing is
+        // wait-free, popping may transiently fail while a push is in flight.
+        class async_semaphore_queue
+        {
+        public:
+            async_semaphore_queue() noexcept
+              : stub_(nullptr)
+              , tail_(&stub_)
+            {
+                head_.data_.store(&stub_, std::memory_order_relaxed);
+            }
+
+            async_semaphore_queue(async_semaphore_queue const&) = delete;
+            async_semaphore_queue(async_semaphore_queue&&) = delete;
+            async_semaphore_queue& operator=(
+                async_semaphore_queue const&) = delete;
+            async_semaphore_queue& operator=(async_semaphore_queue&&) = delete;
+
+            void push(async_semaphore_waiter* waiter) noexcept
+            {
+                waiter->next.store(nullptr, std::memory_order_relaxed);
+                async_semaphore_waiter* prev =
+                    head_.data_.exchange(waiter, std::memory_order_acq_rel);
+                prev->next.store(waiter, std::memory_order_release);
+            }
+
+            // may be called by a single thread at a time only
+            async_semaphore_waiter* pop() noexcept
+            {
+                async_semaphore_waiter* tail = tail_;
+                async_semaphore_waiter* next =
+                    tail->next.load(std::memory_order_acquire);
+
+                if (tail == &stub_)
+                {
+                    if (next == nullptr)
+                    {
+                        return nullptr;
+                    }
+                    tail_ = next;
+                    tail = next;
+                    next = next->next.load(std::memory_order_acquire);
+                }
+
+                if (next != nullptr)
+                {
+                    tail_ = next;
+                    return tail;
+                }
+
+                // a concurrent push has not linked its waiter yet
+                if (tail != head_.data_.load(std::memory_order_acquire))
+                {
+                    return nullptr;
+                }
+
+                // the queue holds a single waiter, re-insert the stub to be
+                // able to detach it
+                push(&stub_);
+
+                next = tail->next.load(std::memory_order_acquire);
+                if (next != nullptr)
+                {
+                    tail_ = next;
+                    return tail;
+                }
+                return nullptr;
+            }
+
+        private:
+            hpx::util::cache_aligned_data<std::atomic<async_semaphore_waiter*>>
+                head_;
+            async_semaphore_waiter stub_;
+            async_semaphore_waiter* tail_;
+        };
+    }    // namespace detail
+
+    /// Counting semaphore where permits are acquired through senders.
+    ///
+    /// The sender returned by acquire() calls set_value on a connected
+    /// receiver once a permit has been acquired on behalf of that receiver.
+    /// No thread is blocked while waiting for a permit, the operation states
+    /// are kept in an intrusive lock-free FIFO queue instead, i.e. waiting
+    /// does not allocate any memory. Permits are handed to waiting
+    /// operations in the order in which those were started.
+    ///
+    /// A waiting operation is completed on the thread calling release().
+    /// Operations completed while releasing the semaphore that themselves
+    /// release it do not recurse but are completed one after another by the
+    /// thread that released the semaphore first. Use transfer to move the
+    /// work depending on the permit to a different scheduler.
+    ///
+    /// The semaphore is neither copyable nor movable, it has to outlive all
+    /// operations started on it.
+    class async_semaphore
+    {
+    private:
+        struct sender;
+
+    public:
+        explicit async_semaphore(std::ptrdiff_t count) noexcept
+        {
+            HPX_ASSERT(count >= 0);
+            count_.data_.store(count, std::memory_order_relaxed);
+            pending_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        async_semaphore(async_semaphore const&) = delete;
+        async_semaphore(async_semaphore&&) = delete;
+        async_semaphore& operator=(async_semaphore const&) = delete;
+        async_semaphore& operator=(async_semaphore&&) = delete;
+
+        ~async_semaphore()
+        {
+            HPX_ASSERT_MSG(count_.data_.load(std::memory_order_relaxed) >= 0,
+                "async_semaphore destroyed while operations are waiting");
+        }
+
+        // Return a sender that completes once a permit has been acquired.
+        [[nodiscard]] sender acquire() noexcept;
+
+        // Try to acquire a permit without waiting.
+        [[nodiscard]] bool try_acquire() noexcept
+        {
+            std::ptrdiff_t count =
+                count_.data_.load(std::memory_order_relaxed);
+            while (count > 0)
+            {
+                if (count_.data_.compare_exchange_weak(count, count - 1,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Release the given number of permits, completes up to that many
+        // waiting operations.
+        void release(std::ptrdiff_t update = 1)
+        {
+            HPX_ASSERT(update >= 0);
+            if (update == 0)
+            {
+                return;
+            }
+
+            std::ptrdiff_t const count =
+                count_.data_.fetch_add(update, std::memory_order_acq_rel);
+            if (count >= 0)
+            {
+                return;
+            }
+
+            // no waiter may be completed without having been handed a permit
+            std::ptrdiff_t const wakeups = (std::min)(-count, update);
+            HPX_ASSERT(wakeups > 0);
+            if (pending_.data_.fetch_add(
+                    wakeups, std::memory_order_acq_rel) == 0)
+            {
+                // this thread is responsible for completing all waiting
+                // operations that have been handed a permit
+                complete_waiters();
+            }
+        }
+
+    private:
+        // Returns true if the permit was acquired without waiting.
+        bool acquire_or_enqueue(detail::async_semaphore_waiter* waiter) noexcept
+        {
+            if (count_.data_.fetch_sub(1, std::memory_order_acq_rel) > 0)
+            {
+                return true;
+            }
+
+            // a concurrent release may have handed a permit to this waiter
+            // already, it will wait for the waiter to show up in the queue
+            waiters_.push(waiter);
+            return false;
+        }
+
+        void complete_waiters() noexcept
+        {
+            do
+            {
+                // the waiter might not have been linked into the queue yet
+                detail::async_semaphore_waiter* waiter = nullptr;
+                hpx::util::yield_while(
+                    [&] { return (waiter = waiters_.pop()) == nullptr; },
+                    "hpx::experimental::async_semaphore::release");
+
+                waiter->complete(waiter);
+
+            } while (
+                pending_.data_.fetch_sub(1, std::memory_order_acq_rel) > 1);
+        }
+
+        struct sender
+        {
+            async_semaphore* sem;
+
+#if defined(HPX_HAVE_STDEXEC)
+            using sender_concept = hpx::execution::experimental::sender_t;
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                sender const&, Env const&)
+                -> hpx::execution::experimental::completion_signatures<
+                    hpx::execution::experimental::set_value_t()>;
+#else
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                sender const&, Env) -> generate_completion_signatures<Env>;
+#endif
+
+            template <typename R>
+            struct operation_state : detail::async_semaphore_waiter
+            {
+                std::decay_t<R> r;
+                async_semaphore* sem;
+
+                template <typename R_>
+                operation_state(R_&& r, async_semaphore* sem)
+                  : detail::async_semaphore_waiter(&complete_waiter)
+                  , r(HPX_FORWARD(R_, r))
+                  , sem(sem)
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                static void complete_waiter(
+                    detail::async_semaphore_waiter* waiter) noexcept
+                {
+                    auto* os = static_cast<operation_state*>(waiter);
+                    hpx::execution::experimental::set_value(HPX_MOVE(os->r));
+                }
+
+                void start() & noexcept
+                {
+                    if (sem->acquire_or_enqueue(this))
+                    {
+                        hpx::execution::experimental::set_value(HPX_MOVE(r));
+                    }
+                }
+
+                friend void tag_invoke(hpx::execution::experimental::start_t,
+                    operation_state& os) noexcept
+                {
+                    os.start();
+                }
+            };
+
+            template <typename R>
+            friend auto tag_invoke(
+                hpx::execution::experimental::connect_t, sender&& s, R&& r)
+            {
+                return operation_state<R>{HPX_FORWARD(R, r), s.sem};
+            }
+
+            template <typename R>
+            friend auto tag_invoke(hpx::execution::experimental::connect_t,
+                sender const& s, R&& r)
+            {
+                return operation_state<R>{HPX_FORWARD(R, r), s.sem};
+            }
+        };
+
+        // number of available permits minus the number of waiting operations
+        hpx::util::cache_aligned_data<std::atomic<std::ptrdiff_t>> count_;
+
+        // number of waiting operations that have been handed a permit but
+        // have not been completed yet
+        hpx::util::cache_aligned_data<std::atomic<std::ptrdiff_t>> pending_;
+
+        detail::async_semaphore_queue waiters_;
+    };
+
+    inline async_semaphore::sender async_semaphore::acquire() noexcept
+    {
+        return sender{this};
+    }
+}    // namespace hpx::experimental
@@ -0,0 +1,323 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/synchronization/counting_semaphore.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace hpx::lcos::local {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // An unbounded channel supporting multiple producers and multiple
+    // consumers. The items are stored in a lock-free queue, producers never
+    // block. Consumers calling one of the waiting functions (get_wait,
+    // get_n_wait) suspend the calling HPX thread while the channel is empty
+    // instead of blocking the underlying worker thread.
+    //
+    // The channel keeps a signed count of the items available for retrieval.
+    // Negative values denote the number of consumers waiting for items. Every
+    // consumer reserves the items it retrieves by decrementing that count
+    // before touching the queue, which allows to avoid any locking on the fast
+    // path. The (internal) semaphore is touched only if consumers have to
+    // wait.
+    //
+    // Items set by the same producer are retrieved in the order they were set
+    // as long as the producer is not suspended in between (the underlying
+    // queue orders items per worker thread). No ordering is guaranteed for
+    // items set by different producers.
+    template <typename T>
+    class channel_mpmc_unbounded
+    {
+    public:
+        channel_mpmc_unbounded()
+          : sem_(0)
+          , closed_(false)
+        {
+            count_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        channel_mpmc_unbounded(channel_mpmc_unbounded const&) = delete;
+        channel_mpmc_unbounded(channel_mpmc_unbounded&&) = delete;
+        channel_mpmc_unbounded& operator=(
+            channel_mpmc_unbounded const&) = delete;
+        channel_mpmc_unbounded& operator=(channel_mpmc_unbounded&&) = delete;
+
+        ~channel_mpmc_unbounded()
+        {
+            if (!closed_.load(std::memory_order_relaxed))
+            {
+                close();
+            }
+        }
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+            return count_.data_.load(std::memory_order_relaxed) <= 0;
+        }
+
+        // Retrieve an item from the channel if one is available, return
+        // whether this was the case. Passing nullptr checks for the
+        // availability of an item without retrieving it.
+        bool get(T* val = nullptr) const
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            if (val == nullptr)
+            {
+                return count_.data_.load(std::memory_order_relaxed) > 0;
+            }
+
+            if (reserve(1) == 0)
+            {
+                return false;
+            }
+
+            dequeue_reserved(*val);
+            return true;
+        }
+
+        // Retrieve up to n items from the channel without waiting, return the
+        // number of items written to the output iterator.
+        template <typename OutIter>
+        std::size_t get_n(OutIter out, std::size_t n) const
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t const reserved = reserve(n);
+            dequeue_reserved(out, reserved);
+            return reserved;
+        }
+
+        // Retrieve an item from the channel, suspend the calling thread while
+        // the channel is empty. Returns false if the channel has been closed.
+        bool get_wait(T& val) const
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            if (count_.data_.fetch_sub(1) <= 0)
+            {
+                // we have registered as a waiting consumer, make sure not to
+                // miss a concurrent close()
+                if (closed_.load() && cancel_wait())
+                {
+                    return false;
+                }
+
+                // woken up either by a producer that has reserved an item
+                // for us or by close()
+                sem_.acquire();
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+            }
+
+            dequeue_reserved(val);
+            return true;
+        }
+
+        // Retrieve at least one and up to n items from the channel, suspend
+        // the calling thread while the channel is empty. Returns the number of
+        // items written to the output iterator, zero if the channel has been
+        // closed.
+        template <typename OutIter>
+        std::size_t get_n_wait(OutIter out, std::size_t n) const
+        {
+            if (n == 0 || closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            if (std::size_t const reserved = reserve(n); reserved != 0)
+            {
+                dequeue_reserved(out, reserved);
+                return reserved;
+            }
+
+            T val;
+            if (!get_wait(val))
+            {
+                return 0;
+            }
+
+            *out = HPX_MOVE(val);
+            ++out;
+
+            return 1 + get_n(out, n - 1);
+        }
+
+        // Add an item to the channel, never blocks. Returns false if the
+        // channel has been closed.
+        bool set(T&& t)
+        {
+            if (closed_.load(std::memory_order_relaxed) ||
+                !queue_.enqueue(HPX_MOVE(t)))
+            {
+                return false;
+            }
+
+            publish(1);
+            return true;
+        }
+
+        // Add n items to the channel, never blocks. The items are copied from
+        // the given range, use std::make_move_iterator to move them instead.
+        // Returns false if the channel has been closed.
+        template <typename InIter>
+        bool set_n(InIter first, std::size_t n)
+        {
+            if (n == 0)
+            {
+                return !closed_.load(std::memory_order_relaxed);
+            }
+
+            if (closed_.load(std::memory_order_relaxed) ||
+                !queue_.enqueue_bulk(first, n))
+            {
+                return false;
+            }
+
+            publish(n);
+            return true;
+        }
+
+        // Close the channel, wakes up all waiting consumers. Returns the
+        // number of consumers that were woken up. Items not retrieved so far
+        // are destroyed with the channel.
+        std::size_t close()
+        {
+            bool expected = false;
+            if (!closed_.compare_exchange_strong(expected, true))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::lcos::local::channel_mpmc_unbounded::close",
+                    "attempting to close an already closed channel");
+            }
+
+            std::size_t woken = 0;
+            while (cancel_wait())
+            {
+                sem_.release(1);
+                ++woken;
+            }
+            return woken;
+        }
+
+    private:
+        // Reserve up to n of the available items, returns the number of
+        // reserved items.
+        std::size_t reserve(std::size_t n) const noexcept
+        {
+            std::int64_t count = count_.data_.load(std::memory_order_relaxed);
+            while (count > 0)
+            {
+                std::int64_t const reserved =
+                    (std::min)(count, static_cast<std::int64_t>(n));
+                if (count_.data_.compare_exchange_weak(count, count - reserved,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return static_cast<std::size_t>(reserved);
+                }
+            }
+            return 0;
+        }
+
+        // Turn one of the waiting consumers into a non-waiting one, returns
+        // false if no consumer was waiting.
+        bool cancel_wait() const noexcept
+        {
+            std::int64_t count = count_.data_.load();
+            while (count < 0)
+            {
+                if (count_.data_.compare_exchange_weak(count, count + 1))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Make n items available to consumers, wakes up waiting consumers
+        // (if any).
+        void publish(std::size_t n)
+        {
+            std::int64_t const count = count_.data_.fetch_add(
+                static_cast<std::int64_t>(n), std::memory_order_release);
+            if (count < 0)
+            {
+                sem_.release(static_cast<std::ptrdiff_t>(
+                    (std::min)(-count, static_cast<std::int64_t>(n))));
+            }
+        }
+
+        // Producers publish items only after having inserted them into the
+        // queue, thus reserved items are guaranteed to be available. The queue
+        // however may briefly report being empty while concurrent operations
+        // are in flight.
+        void dequeue_reserved(T& val) const
+        {
+            hpx::util::yield_while([&] { return !queue_.try_dequeue(val); },
+                "channel_mpmc_unbounded::get");
+        }
+
+        template <typename OutIter>
+        void dequeue_reserved(OutIter& out, std::size_t n) const
+        {
+            while (n != 0)
+            {
+                std::size_t const retrieved = queue_.try_dequeue_bulk(out, n);
+                if (retrieved == 0)
+                {
+                    T val;
+                    dequeue_reserved(val);
+
+                    *out = HPX_MOVE(val);
+                    ++out;
+                    --n;
+                    continue;
+                }
+
+                for (std::size_t i = 0; i != retrieved; ++i)
+                {
+                    ++out;
+                }
+                n -= retrieved;
+            }
+        }
+
+    private:
+        mutable hpx::util::cache_aligned_data<std::atomic<std::int64_t>>
+            count_;
+        mutable hpx::concurrency::ConcurrentQueue<T> queue_;
+        mutable hpx::counting_semaphore<> sem_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+    };
+}    // namespace hpx::lcos::local
@@ -15,11 +15,15 @@
 #include <hpx/coroutines/coroutine_fwd.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/config/defines.hpp>
 #include <hpx/synchronization/detail/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
+#include <cstdint>
+
 namespace hpx::threads {
 
     using thread_id_ref_type = thread_id_ref;
@@ -36,6 +40,32 @@ namespace hpx::threads {
 
 namespace hpx {
 
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+    ///
+    /// \brief Contention statistics collected by an \a hpx::mutex. Those are
+    ///        available only if HPX was configured with
+    ///        \a HPX_SYNCHRONIZATION_WITH_MUTEX_STATISTICS=ON.
+    ///
+    struct mutex_statistics
+    {
+        /// number of times the mutex was acquired (excluding \a try_lock)
+        std::uint64_t acquisitions = 0;
+
+        /// number of acquisitions that had to suspend the calling thread
+        std::uint64_t contended = 0;
+
+        /// number of acquisitions that succeeded while spinning
+        std::uint64_t spin_acquisitions = 0;
+
+        /// number of times the ownership was handed directly to a waiting
+        /// thread
+        std::uint64_t handoffs = 0;
+
+        /// accumulated time threads were suspended waiting for the mutex [ns]
+        std::uint64_t wait_time = 0;
+    };
+#endif
+
     ///
     /// \brief \a mutex class is a synchronization primitive that can be used
     ///        to protect shared data from being simultaneously accessed by
@@ -60,6 +90,15 @@ namespace hpx {
     ///
     ///        \a hpx::mutex is neither copyable nor movable.
     ///
+    ///        A thread attempting to lock a contended \a mutex spins for a
+    ///        short while before suspending. The number of spin iterations
+    ///        adapts to the time it took to acquire the \a mutex in the
+    ///        past. Suspended threads are woken in FIFO order. A thread that
+    ///        has been waiting for longer than a millisecond switches the
+    ///        \a mutex into starvation mode, in which the ownership is handed
+    ///        directly to the longest waiting thread on unlock instead of
+    ///        letting it compete with newly arriving threads.
+    ///
     class mutex
     {
     public:
@@ -89,6 +128,10 @@ namespace hpx {
 #else
         HPX_HOST_DEVICE_CONSTEXPR mutex(char const* const = "") noexcept
           : owner_id_(threads::invalid_thread_id)
+          , locked_(false)
+          , spin_count_(0)
+          , handoff_(false)
+          , starving_(false)
         {
         }
 #endif
@@ -235,11 +278,54 @@ namespace hpx {
         ///
         HPX_CORE_EXPORT void unlock(error_code& ec = throws);
 
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+        ///
+        /// \brief Returns the contention statistics collected for this
+        ///        \a mutex since its construction.
+        ///
+        HPX_CORE_EXPORT mutex_statistics get_statistics() const;
+#endif
+
     protected:
         /// \cond NOPROTECTED
+        // Acquire the mutex if it is available, mtx_ has to be held.
+        bool try_acquire(threads::thread_id_type const& self_id) noexcept;
+
+        // Spin for a while trying to acquire the mutex without suspending.
+        bool spin_acquire(threads::thread_id_type const& self_id);
+
+        // Take ownership after having waited for the mutex, mtx_ has to be
+        // held.
+        bool acquire_after_wait(threads::thread_id_type const& self_id,
+            std::unique_lock<mutex_type>& l, std::uint64_t wait_start);
+
+        // Give up a pending handoff after waiting for the mutex has failed,
+        // the mutex is passed on to the next waiting thread, if any. Releases
+        // the lock.
+        void cancel_handoff(std::unique_lock<mutex_type> l);
+
         mutable mutex_type mtx_;
         threads::thread_id_type owner_id_;
         hpx::lcos::local::detail::condition_variable cond_;
+
+        // the mutex is owned or is being handed to a waiting thread, may be
+        // read without holding mtx_ while spinning
+        std::atomic<bool> locked_;
+
+        // running average of the number of spin iterations needed to acquire
+        // the mutex
+        std::atomic<std::uint16_t> spin_count_;
+
+        // the ownership has been handed to the next waiting thread
+        bool handoff_;
+
+        // a waiting thread has been starved, hand ownership to waiting
+        // threads directly on unlock
+        bool starving_;
+
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+        mutex_statistics statistics_;
+#endif
         /// \endcond NOPROTECTED
     };
 
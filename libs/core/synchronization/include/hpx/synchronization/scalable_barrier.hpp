@@ -0,0 +1,331 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/synchronization/scalable_barrier.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/synchronization/barrier.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Arrival policy counting all arrivals of a phase using a single shared
+    /// counter. Every arrival touches the same cache line.
+    class central_arrival
+    {
+    public:
+        explicit central_arrival(std::size_t expected) noexcept
+          : expected_(expected)
+        {
+            HPX_ASSERT(expected != 0);
+            count_.data_.store(expected, std::memory_order_relaxed);
+        }
+
+        // Only the number of groups is relevant for this policy.
+        explicit central_arrival(std::vector<std::size_t> const& groups)
+          : central_arrival(groups.size())
+        {
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return expected_;
+        }
+
+        // Register the arrival of the participant with the given rank,
+        // returns true for the last arrival of the current phase.
+        bool arrive(std::size_t /* rank */) noexcept
+        {
+            if (count_.data_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return false;
+            }
+
+            // no participant can arrive for the next phase before the current
+            // phase has been completed
+            count_.data_.store(expected_, std::memory_order_relaxed);
+            return true;
+        }
+
+    private:
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> count_;
+        std::size_t expected_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Arrival policy counting the arrivals of a phase in a combining tree.
+    /// Participants arrive at a leaf node that is shared only with
+    /// participants of the same group, the last participant arriving at a
+    /// node carries the arrival on to the parent node. Every node lives on
+    /// its own cache line, thus contention is limited to the participants
+    /// sharing a node.
+    ///
+    /// By default the participants are grouped by the last level cache (or
+    /// NUMA domain if no cache information is available) of the processing
+    /// unit with the same number as the participant's rank. This matches the
+    /// placement of the worker threads with the default affinity settings,
+    /// i.e. the rank of a participant running on an HPX worker thread should
+    /// be its worker thread number.
+    class HPX_CORE_EXPORT combining_tree_arrival
+    {
+    public:
+        // maximal number of participants or child nodes sharing a node
+        static constexpr std::size_t default_fanin = 8;
+
+        explicit combining_tree_arrival(std::size_t expected);
+
+        // groups[rank] is the group the participant with the given rank
+        // belongs to
+        explicit combining_tree_arrival(std::vector<std::size_t> const& groups,
+            std::size_t fanin = default_fanin);
+
+        // Return the group (cache or NUMA domain) for each of the given
+        // number of processing units.
+        static std::vector<std::size_t> cache_domains(std::size_t count);
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return leaf_of_rank_.size();
+        }
+
+        // Register the arrival of the participant with the given rank,
+        // returns true for the last arrival of the current phase.
+        bool arrive(std::size_t rank) noexcept
+        {
+            HPX_ASSERT(rank < leaf_of_rank_.size());
+
+            std::size_t index = leaf_of_rank_[rank];
+            while (true)
+            {
+                node& n = nodes_[index];
+                if (n.count_.data_.fetch_sub(1, std::memory_order_acq_rel) !=
+                    1)
+                {
+                    return false;
+                }
+
+                // no participant can arrive at this node for the next phase
+                // before the current phase has been completed
+                n.count_.data_.store(n.expected_, std::memory_order_relaxed);
+                if (n.parent_ == root)
+                {
+                    return true;
+                }
+                index = n.parent_;
+            }
+        }
+
+    private:
+        static constexpr std::size_t root = static_cast<std::size_t>(-1);
+
+        struct node
+        {
+            hpx::util::cache_aligned_data<std::atomic<std::size_t>> count_;
+            std::size_t expected_ = 0;
+            std::size_t parent_ = root;
+        };
+
+        std::unique_ptr<node[]> nodes_;
+        std::vector<std::size_t> leaf_of_rank_;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        inline std::size_t current_rank() noexcept
+        {
+            std::size_t const rank = hpx::get_worker_thread_num();
+            HPX_ASSERT_MSG(rank != static_cast<std::size_t>(-1),
+                "the rank has to be specified explicitly if the calling "
+                "thread is not an HPX worker thread");
+            return rank;
+        }
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A barrier for a fixed set of participants, each identified by a rank
+    /// in the range [0, expected), expected has to be larger than zero. The
+    /// way arrivals are counted is selected by the Arrival template parameter
+    /// (\a combining_tree_arrival or \a central_arrival). Waiting
+    /// participants spin on a phase counter and yield the calling thread (HPX
+    /// or OS thread) while the phase has not been completed, no locks are
+    /// involved.
+    ///
+    /// The completion function is invoked by the last participant arriving
+    /// at the barrier, before any of the waiting participants are released.
+    template <typename Arrival = combining_tree_arrival,
+        typename OnCompletion = hpx::detail::empty_oncompletion>
+    class scalable_barrier
+    {
+    public:
+        using arrival_token = std::uint64_t;
+
+        scalable_barrier(scalable_barrier const&) = delete;
+        scalable_barrier(scalable_barrier&&) = delete;
+        scalable_barrier& operator=(scalable_barrier const&) = delete;
+        scalable_barrier& operator=(scalable_barrier&&) = delete;
+
+        explicit scalable_barrier(
+            std::size_t expected, OnCompletion completion = OnCompletion())
+          : arrival_(expected)
+          , completion_(HPX_MOVE(completion))
+        {
+            phase_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        // groups[rank] is the group the participant with the given rank
+        // belongs to
+        explicit scalable_barrier(std::vector<std::size_t> const& groups,
+            OnCompletion completion = OnCompletion())
+          : arrival_(groups)
+          , completion_(HPX_MOVE(completion))
+        {
+            phase_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        ~scalable_barrier() = default;
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return arrival_.size();
+        }
+
+        // Every participant has to arrive exactly once per phase.
+        [[nodiscard]] arrival_token arrive(std::size_t rank)
+        {
+            // the phase can't advance before this participant has arrived
+            arrival_token const phase =
+                phase_.data_.load(std::memory_order_relaxed);
+            if (arrival_.arrive(rank))
+            {
+                completion_();
+                phase_.data_.store(phase + 1, std::memory_order_release);
+            }
+            return phase;
+        }
+
+        [[nodiscard]] arrival_token arrive()
+        {
+            return arrive(detail::current_rank());
+        }
+
+        void wait(arrival_token&& phase) const
+        {
+            hpx::util::yield_while(
+                [&] {
+                    return phase_.data_.load(std::memory_order_acquire) ==
+                        phase;
+                },
+                "hpx::experimental::scalable_barrier::wait");
+        }
+
+        void arrive_and_wait(std::size_t rank)
+        {
+            wait(arrive(rank));
+        }
+
+        void arrive_and_wait()
+        {
+            wait(arrive(detail::current_rank()));
+        }
+
+    private:
+        hpx::util::cache_aligned_data<std::atomic<arrival_token>> phase_;
+        Arrival arrival_;
+        OnCompletion completion_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A single-use latch for a fixed set of participants, each identified by
+    /// a rank in the range [0, expected), expected has to be larger than
+    /// zero. Every participant counts down the latch exactly once, the
+    /// arrivals are counted as selected by the Arrival template parameter
+    /// (\a combining_tree_arrival or \a central_arrival). Any thread may wait
+    /// for the latch, waiting threads spin and yield the calling thread (HPX
+    /// or OS thread) until the latch has been released.
+    template <typename Arrival = combining_tree_arrival>
+    class scalable_latch
+    {
+    public:
+        scalable_latch(scalable_latch const&) = delete;
+        scalable_latch(scalable_latch&&) = delete;
+        scalable_latch& operator=(scalable_latch const&) = delete;
+        scalable_latch& operator=(scalable_latch&&) = delete;
+
+        explicit scalable_latch(std::size_t expected)
+          : arrival_(expected)
+        {
+            released_.data_.store(false, std::memory_order_relaxed);
+        }
+
+        // groups[rank] is the group the participant with the given rank
+        // belongs to
+        explicit scalable_latch(std::vector<std::size_t> const& groups)
+          : arrival_(groups)
+        {
+            released_.data_.store(false, std::memory_order_relaxed);
+        }
+
+        ~scalable_latch() = default;
+
+        void count_down(std::size_t rank)
+        {
+            if (arrival_.arrive(rank))
+            {
+                released_.data_.store(true, std::memory_order_release);
+            }
+        }
+
+        void count_down()
+        {
+            count_down(detail::current_rank());
+        }
+
+        [[nodiscard]] bool try_wait() const noexcept
+        {
+            return released_.data_.load(std::memory_order_acquire);
+        }
+
+        void wait() const
+        {
+            hpx::util::yield_while([&] { return !try_wait(); },
+                "hpx::experimental::scalable_latch::wait");
+        }
+
+        void arrive_and_wait(std::size_t rank)
+        {
+            count_down(rank);
+            wait();
+        }
+
+        void arrive_and_wait()
+        {
+            arrive_and_wait(detail::current_rank());
+        }
+
+    private:
+        hpx::util::cache_aligned_data<std::atomic<bool>> released_;
+        Arrival arrival_;
+    };
+}    // namespace hpx::experimental
+
+#include <hpx/config/warnings_suffix.hpp>
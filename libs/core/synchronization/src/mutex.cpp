@@ -1,4 +1,4 @@
-//  Copyright (c) 2007-2023 Hartmut Kaiser
+//  Copyright (c) 2007-2026 Hartmut Kaiser
 //  Copyright (c) 2013-2015 Agustin Berge
 //
 //  SPDX-License-Identifier: BSL-1.0
@@ -8,6 +8,7 @@
 #include <hpx/synchronization/mutex.hpp>
 
 #include <hpx/assert.hpp>
+#include <hpx/config/compiler_fence.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/errors.hpp>
@@ -15,17 +16,35 @@
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
 namespace hpx {
 
+    namespace {
+
+        // maximal number of iterations a thread spins before suspending
+        constexpr std::int32_t max_spin_count = 100;
+
+        // a thread waiting for longer than this switches the mutex into
+        // starvation mode [ns]
+        constexpr std::uint64_t starvation_threshold = 1000000;
+    }    // namespace
+
     ///////////////////////////////////////////////////////////////////////////
 #if HPX_HAVE_ITTNOTIFY != 0
     mutex::mutex(char const* const description)
       : owner_id_(threads::invalid_thread_id)
+      , locked_(false)
+      , spin_count_(0)
+      , handoff_(false)
+      , starving_(false)
     {
         HPX_ITT_SYNC_CREATE(this, "hpx::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "hpx::mutex");
@@ -41,14 +60,133 @@ namespace hpx {
     mutex::~mutex() = default;
 #endif
 
+    bool mutex::try_acquire(threads::thread_id_type const& self_id) noexcept
+    {
+        // a handed over mutex is reserved for the waiting thread
+        if (owner_id_ != threads::invalid_thread_id || handoff_)
+        {
+            return false;
+        }
+
+        owner_id_ = self_id;
+        locked_.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool mutex::spin_acquire(threads::thread_id_type const& self_id)
+    {
+        // spin up to twice as long as it took on average in the past (see
+        // the adaptive mutexes in glibc)
+        std::int32_t const average =
+            spin_count_.load(std::memory_order_relaxed);
+        std::int32_t const limit = (std::min)(max_spin_count, 2 * average + 10);
+
+        std::int32_t spins = 0;
+        bool acquired = false;
+        for (/**/; spins != limit; ++spins)
+        {
+            if (!locked_.load(std::memory_order_relaxed))
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (try_acquire(self_id))
+                {
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+                    ++statistics_.acquisitions;
+                    if (spins != 0)
+                    {
+                        ++statistics_.spin_acquisitions;
+                    }
+#endif
+                    acquired = true;
+                    break;
+                }
+            }
+            HPX_SMT_PAUSE;
+        }
+
+        spin_count_.store(static_cast<std::uint16_t>(
+                              average + (spins - average) / 8),
+            std::memory_order_relaxed);
+
+        return acquired;
+    }
+
+    bool mutex::acquire_after_wait(threads::thread_id_type const& self_id,
+        std::unique_lock<mutex_type>& l, std::uint64_t wait_start)
+    {
+        std::uint64_t const waited =
+            hpx::chrono::high_resolution_clock::now() - wait_start;
+
+        if (handoff_)
+        {
+            // the previous owner has handed the mutex to us
+            handoff_ = false;
+            owner_id_ = self_id;
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+            ++statistics_.handoffs;
+#endif
+        }
+        else if (!try_acquire(self_id))
+        {
+            // another thread was faster, make sure we will not starve
+            if (waited > starvation_threshold)
+            {
+                starving_ = true;
+            }
+            return false;
+        }
+
+        // leave starvation mode once nobody has been waiting for long
+        if (starving_ && (waited <= starvation_threshold || cond_.empty(l)))
+        {
+            starving_ = false;
+        }
+
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+        ++statistics_.acquisitions;
+        ++statistics_.contended;
+        statistics_.wait_time += waited;
+#endif
+        return true;
+    }
+
+    void mutex::cancel_handoff(std::unique_lock<mutex_type> l)
+    {
+        if (!handoff_)
+        {
+            return;
+        }
+
+        if (cond_.empty(l))
+        {
+            // nobody else is waiting, simply release the mutex
+            handoff_ = false;
+            locked_.store(false, std::memory_order_relaxed);
+            return;
+        }
+
+        // don't leave the mutex reserved for an aborted thread, the handoff
+        // goes to the next waiting thread instead
+        error_code ec(throwmode::lightweight);
+        cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost, ec);
+    }
+
     void mutex::lock(char const* description, error_code& ec)
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type const self_id = threads::get_self_id();
+        if (spin_acquire(self_id))
+        {
+            util::register_lock(this);
+            HPX_ITT_SYNC_ACQUIRED(this);
+            return;
+        }
+
+        std::unique_lock<mutex_type> l(mtx_);
+
         if (owner_id_ == self_id)
         {
             HPX_ITT_SYNC_CANCEL(this);
@@ -58,38 +196,54 @@ namespace hpx {
             return;
         }
 
-        while (owner_id_ != threads::invalid_thread_id)
+        if (!try_acquire(self_id))
         {
-            cond_.wait(l, ec);
-            if (ec)
+            std::uint64_t const wait_start =
+                hpx::chrono::high_resolution_clock::now();
+            do
             {
-                HPX_ITT_SYNC_CANCEL(this);
-                return;
-            }
+                cond_.wait(l, ec);
+                if (ec)
+                {
+                    cancel_handoff(HPX_MOVE(l));
+                    HPX_ITT_SYNC_CANCEL(this);
+                    return;
+                }
+            } while (!acquire_after_wait(self_id, l, wait_start));
+        }
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+        else
+        {
+            ++statistics_.acquisitions;
         }
+#endif
 
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
     }
 
     bool mutex::try_lock(char const* /* description */, error_code& /* ec */)
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
+        // avoid touching the spinlock if the mutex is obviously owned
+        if (locked_.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
         HPX_ITT_SYNC_PREPARE(this);
         std::unique_lock<mutex_type> l(mtx_);
 
-        if (owner_id_ != threads::invalid_thread_id)
+        threads::thread_id_type const self_id = threads::get_self_id();
+        if (!try_acquire(self_id))
         {
             HPX_ITT_SYNC_CANCEL(this);
             return false;
         }
 
-        threads::thread_id_type const self_id = threads::get_self_id();
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
         return true;
     }
 
@@ -114,6 +268,17 @@ namespace hpx {
         HPX_ITT_SYNC_RELEASED(this);
         owner_id_ = threads::invalid_thread_id;
 
+        // in starvation mode the mutex stays locked and is handed directly
+        // to the longest waiting thread
+        if (starving_ && !cond_.empty(l))
+        {
+            handoff_ = true;
+        }
+        else
+        {
+            locked_.store(false, std::memory_order_relaxed);
+        }
+
         {
             [[maybe_unused]] util::ignore_while_checking il(&l);
 
@@ -132,6 +297,14 @@ namespace hpx {
         }
     }
 
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+    mutex_statistics mutex::get_statistics() const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return statistics_;
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     timed_mutex::timed_mutex(char const* const description)
       : mutex(description)
@@ -150,23 +323,28 @@ namespace hpx {
         std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type const self_id = threads::get_self_id();
-        if (owner_id_ != threads::invalid_thread_id)
+        if (!try_acquire(self_id))
         {
+            std::uint64_t const wait_start =
+                hpx::chrono::high_resolution_clock::now();
             threads::thread_restart_state const reason =
                 cond_.wait_until(l, abs_time, ec);
             if (ec)
             {
+                cancel_handoff(HPX_MOVE(l));
                 HPX_ITT_SYNC_CANCEL(this);
                 return false;
             }
 
-            if (reason == threads::thread_restart_state::timeout)    //-V110
+            if (reason == threads::thread_restart_state::timeout)
             {
+                // the mutex may have been handed to us while timing out
+                cancel_handoff(HPX_MOVE(l));
                 HPX_ITT_SYNC_CANCEL(this);
                 return false;
             }
 
-            if (owner_id_ != threads::invalid_thread_id)    //-V110
+            if (!acquire_after_wait(self_id, l, wait_start))    //-V110
             {
                 HPX_ITT_SYNC_CANCEL(this);
                 return false;
@@ -175,7 +353,6 @@ namespace hpx {
 
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
         return true;
     }
 }    // namespace hpx
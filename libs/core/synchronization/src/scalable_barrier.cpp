@@ -0,0 +1,109 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/scalable_barrier.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace hpx::experimental {
+
+    std::vector<std::size_t> combining_tree_arrival::cache_domains(
+        std::size_t count)
+    {
+        hpx::threads::topology const& topo = hpx::threads::create_topology();
+        std::size_t const num_pus = (std::max)(
+            topo.get_number_of_pus(), static_cast<std::size_t>(1));
+
+        // identify every domain by the first processing unit it contains
+        std::vector<std::size_t> groups(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            groups[i] = hpx::threads::find_first(
+                topo.get_cache_affinity_mask(i % num_pus, 3));
+        }
+        return groups;
+    }
+
+    combining_tree_arrival::combining_tree_arrival(std::size_t expected)
+      : combining_tree_arrival(cache_domains(expected))
+    {
+    }
+
+    combining_tree_arrival::combining_tree_arrival(
+        std::vector<std::size_t> const& groups, std::size_t fanin)
+      : leaf_of_rank_(groups.size())
+    {
+        if (groups.empty() || fanin < 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "combining_tree_arrival::combining_tree_arrival",
+                "the number of participants must be larger than zero and the "
+                "fan-in must be at least two");
+        }
+
+        // order the participants by group, keeping the rank order inside
+        // each group
+        std::vector<std::size_t> ranks(groups.size());
+        std::iota(ranks.begin(), ranks.end(), 0);
+        std::stable_sort(ranks.begin(), ranks.end(),
+            [&](std::size_t lhs, std::size_t rhs) {
+                return groups[lhs] < groups[rhs];
+            });
+
+        // every leaf is shared by at most fanin participants of the same
+        // group
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i != ranks.size(); ++i)
+        {
+            if (i == 0 || groups[ranks[i]] != groups[ranks[i - 1]] ||
+                expected.back() == fanin)
+            {
+                expected.push_back(0);
+            }
+            ++expected.back();
+            leaf_of_rank_[ranks[i]] = expected.size() - 1;
+        }
+
+        // combine consecutive nodes of each level until a single root is left
+        std::vector<std::size_t> parent(expected.size(), root);
+        std::size_t first = 0;
+        std::size_t last = expected.size();
+        while (last - first > 1)
+        {
+            for (std::size_t i = first; i != last; ++i)
+            {
+                if ((i - first) % fanin == 0)
+                {
+                    expected.push_back(0);
+                    parent.push_back(root);
+                }
+                ++expected.back();
+                parent[i] = expected.size() - 1;
+            }
+            first = last;
+            last = expected.size();
+        }
+
+        nodes_.reset(new node[expected.size()]);
+        for (std::size_t i = 0; i != expected.size(); ++i)
+        {
+            nodes_[i].count_.data_.store(
+                expected[i], std::memory_order_relaxed);
+            nodes_[i].expected_ = expected[i];
+            nodes_[i].parent_ = parent[i];
+        }
+    }
+}    // namespace hpx::experimental
@@ -0,0 +1,117 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the time per barrier phase for a growing number of participants,
+// comparing a single central arrival counter with the topology-aware
+// combining tree. Every participant is bound to its own worker thread.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+std::size_t num_iterations = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Arrival>
+double measure(std::size_t num_participants)
+{
+    hpx::experimental::scalable_barrier<Arrival> b(num_participants);
+
+    std::vector<hpx::future<std::uint64_t>> tasks;
+    tasks.reserve(num_participants);
+    for (std::size_t i = 0; i != num_participants; ++i)
+    {
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_priority::bound,
+            hpx::threads::thread_stacksize::default_,
+            hpx::threads::thread_schedule_hint(
+                hpx::threads::thread_schedule_hint_mode::thread,
+                static_cast<std::int16_t>(i)));
+
+        tasks.push_back(hpx::async(exec, [&b, i]() {
+            // make sure all participants have started before measuring
+            b.arrive_and_wait(i);
+
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                b.arrive_and_wait(i);
+            }
+            return hpx::chrono::high_resolution_clock::now() - start;
+        }));
+    }
+
+    std::uint64_t elapsed = 0;
+    for (auto& f : tasks)
+    {
+        elapsed += f.get();
+    }
+
+    // average time per phase seen by a participant, in nanoseconds
+    return static_cast<double>(elapsed) /
+        static_cast<double>(num_participants * num_iterations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    num_iterations = vm["iterations"].as<std::size_t>();
+    if (num_iterations == 0)
+    {
+        std::cerr << "the number of iterations must be larger than zero"
+                  << std::endl;
+        return hpx::local::finalize();
+    }
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    std::cout << "participants,central [ns],combining_tree [ns]\n";
+    for (std::size_t n = 1; n != 0;)
+    {
+        double const central =
+            measure<hpx::experimental::central_arrival>(n);
+        double const tree =
+            measure<hpx::experimental::combining_tree_arrival>(n);
+
+        std::cout << n << "," << central << "," << tree << std::endl;
+
+        // double the number of participants, always finish with measuring
+        // all worker threads
+        n = (n == num_threads) ? 0 : (std::min)(2 * n, num_threads);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(10000),
+         "number of barrier phases per measurement (default: 10000)")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
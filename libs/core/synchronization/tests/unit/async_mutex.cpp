@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+using hpx::experimental::async_mutex;
+using hpx::this_thread::experimental::sync_wait;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lock_unlock()
+{
+    async_mutex mtx;
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock();
+
+    bool called = false;
+    sync_wait(mtx.lock() | ex::then([&]() { called = true; }));
+    HPX_TEST(called);
+
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock();
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+// waiting operations are granted the lock in the order they were started
+void test_fifo()
+{
+    async_mutex mtx;
+    HPX_TEST(mtx.try_lock());
+
+    std::vector<int> order;
+    for (int i = 0; i != 10; ++i)
+    {
+        ex::start_detached(mtx.lock() | ex::then([&, i]() {
+            order.push_back(i);
+            mtx.unlock();
+        }));
+    }
+
+    // none of the operations may run while the mutex is locked
+    HPX_TEST(order.empty());
+
+    // the waiting operations are completed on this thread
+    mtx.unlock();
+
+    HPX_TEST_EQ(order.size(), static_cast<std::size_t>(10));
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(order[i], i);
+    }
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+// many concurrent operations serialize their accesses to a non-atomic counter
+void test_concurrent()
+{
+    std::size_t constexpr num_operations = 1000;
+
+    async_mutex mtx;
+    ex::thread_pool_scheduler sched{};
+
+    std::size_t counter = 0;
+    std::atomic<bool> inside(false);
+    hpx::latch l(num_operations + 1);
+
+    for (std::size_t i = 0; i != num_operations; ++i)
+    {
+        ex::start_detached(ex::schedule(sched) |
+            ex::let_value([&]() { return mtx.lock(); }) |
+            ex::then([&]() {
+                HPX_TEST(!inside.exchange(true));
+                ++counter;
+                HPX_TEST(inside.exchange(false));
+
+                mtx.unlock();
+                l.count_down(1);
+            }));
+    }
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(counter, num_operations);
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_lock_unlock();
+    test_fifo();
+    test_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+using hpx::experimental::async_semaphore;
+using hpx::this_thread::experimental::sync_wait;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_acquire_release()
+{
+    async_semaphore sem(2);
+
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(!sem.try_acquire());
+
+    sem.release(2);
+
+    int called = 0;
+    sync_wait(sem.acquire() | ex::then([&]() { ++called; }));
+    sync_wait(sem.acquire() | ex::then([&]() { ++called; }));
+    HPX_TEST_EQ(called, 2);
+    HPX_TEST(!sem.try_acquire());
+
+    // releasing several permits at once completes as many waiting operations
+    for (int i = 0; i != 5; ++i)
+    {
+        ex::start_detached(sem.acquire() | ex::then([&]() { ++called; }));
+    }
+    HPX_TEST_EQ(called, 2);
+
+    sem.release(3);
+    HPX_TEST_EQ(called, 5);
+
+    sem.release(4);
+    HPX_TEST_EQ(called, 7);
+
+    // two permits are left
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(!sem.try_acquire());
+}
+
+// releasing no permits doesn't complete any waiting operation
+void test_release_zero()
+{
+    async_semaphore sem(0);
+
+    int called = 0;
+    ex::start_detached(sem.acquire() | ex::then([&]() { ++called; }));
+    HPX_TEST_EQ(called, 0);
+
+    sem.release(0);
+    HPX_TEST_EQ(called, 0);
+    HPX_TEST(!sem.try_acquire());
+
+    // the next permit still goes to the waiting operation
+    sem.release(1);
+    HPX_TEST_EQ(called, 1);
+    HPX_TEST(!sem.try_acquire());
+
+    // pending completions are still counted correctly
+    ex::start_detached(sem.acquire() | ex::then([&]() { ++called; }));
+    sem.release(0);
+    HPX_TEST_EQ(called, 1);
+
+    sem.release(2);
+    HPX_TEST_EQ(called, 2);
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(!sem.try_acquire());
+}
+
+// no more than the given number of operations hold a permit at any time
+void test_concurrent()
+{
+    std::size_t constexpr num_operations = 1000;
+    std::ptrdiff_t constexpr num_permits = 3;
+
+    async_semaphore sem(num_permits);
+    ex::thread_pool_scheduler sched{};
+
+    std::atomic<std::ptrdiff_t> active(0);
+    std::atomic<std::ptrdiff_t> max_active(0);
+    hpx::latch l(num_operations + 1);
+
+    for (std::size_t i = 0; i != num_operations; ++i)
+    {
+        ex::start_detached(ex::schedule(sched) |
+            ex::let_value([&]() { return sem.acquire(); }) |
+            ex::transfer(sched) | ex::then([&]() {
+                std::ptrdiff_t const current = ++active;
+                HPX_TEST_LTE(current, num_permits);
+
+                std::ptrdiff_t max = max_active.load();
+                while (current > max &&
+                    !max_active.compare_exchange_weak(max, current))
+                {
+                }
+
+                hpx::this_thread::yield();
+
+                --active;
+                sem.release(1);
+                l.count_down(1);
+            }));
+    }
+
+    l.arrive_and_wait();
+    HPX_TEST_LTE(max_active.load(), num_permits);
+
+    // all permits are available again
+    for (std::ptrdiff_t i = 0; i != num_permits; ++i)
+    {
+        HPX_TEST(sem.try_acquire());
+    }
+    HPX_TEST(!sem.try_acquire());
+    sem.release(num_permits);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_acquire_release();
+    test_release_zero();
+    test_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
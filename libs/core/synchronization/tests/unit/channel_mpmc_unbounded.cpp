@@ -0,0 +1,293 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+using channel_type = hpx::lcos::local::channel_mpmc_unbounded<int>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_basic()
+{
+    channel_type c;
+
+    HPX_TEST(c.is_empty());
+    HPX_TEST(!c.get());
+
+    int val = 0;
+    HPX_TEST(!c.get(&val));
+
+    // the channel is unbounded, a single producer retrieves its own items in
+    // order
+    for (int i = 0; i != 10000; ++i)
+    {
+        HPX_TEST(c.set(int(i)));
+    }
+
+    HPX_TEST(!c.is_empty());
+    HPX_TEST(c.get());
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        HPX_TEST(c.get(&val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(c.is_empty());
+    HPX_TEST(!c.get(&val));
+}
+
+void test_batches()
+{
+    channel_type c;
+
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 0);
+
+    HPX_TEST(c.set_n(values.begin(), values.size()));
+    HPX_TEST(c.set_n(std::make_move_iterator(values.begin()), 10));
+
+    std::vector<int> results;
+    HPX_TEST_EQ(c.get_n(std::back_inserter(results), 60),
+        static_cast<std::size_t>(60));
+    HPX_TEST_EQ(c.get_n(std::back_inserter(results), 60),
+        static_cast<std::size_t>(50));
+    HPX_TEST_EQ(
+        c.get_n(std::back_inserter(results), 60), static_cast<std::size_t>(0));
+
+    HPX_TEST_EQ(results.size(), static_cast<std::size_t>(110));
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i], static_cast<int>(i % 100));
+    }
+
+    // get_n_wait returns whatever is available as long as there is at least
+    // one item
+    int buffer[8] = {};
+    HPX_TEST(c.set(42));
+    HPX_TEST_EQ(c.get_n_wait(buffer, 8), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(buffer[0], 42);
+}
+
+void test_wait()
+{
+    channel_type c;
+
+    // the consumer is suspended until an item becomes available
+    hpx::future<int> f = hpx::async([&c]() {
+        int val = 0;
+        HPX_TEST(c.get_wait(val));
+        return val;
+    });
+
+    hpx::this_thread::yield();
+    HPX_TEST(c.set(42));
+    HPX_TEST_EQ(f.get(), 42);
+
+    // batch retrieval waits for the first item
+    hpx::future<std::vector<int>> f2 = hpx::async([&c]() {
+        std::vector<int> values;
+        while (values.size() != 10)
+        {
+            HPX_TEST_NEQ(c.get_n_wait(std::back_inserter(values), 10),
+                static_cast<std::size_t>(0));
+        }
+        return values;
+    });
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(c.set(int(i)));
+        hpx::this_thread::yield();
+    }
+
+    std::vector<int> values = f2.get();
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(values[i], i);
+    }
+}
+
+void test_close()
+{
+    channel_type c;
+
+    // closing the channel wakes up all waiting consumers
+    std::size_t constexpr num_consumers = 10;
+    std::atomic<std::size_t> waiting(0);
+
+    std::vector<hpx::future<bool>> consumers;
+    consumers.reserve(num_consumers);
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async([&]() {
+            ++waiting;
+            int val = 0;
+            return c.get_wait(val);
+        }));
+    }
+
+    while (waiting != num_consumers)
+    {
+        hpx::this_thread::yield();
+    }
+
+    std::size_t const woken = c.close();
+    HPX_TEST_LTE(woken, num_consumers);
+
+    for (auto& f : consumers)
+    {
+        HPX_TEST(!f.get());
+    }
+
+    // no further operations are possible
+    HPX_TEST(c.is_empty());
+    HPX_TEST(!c.set(42));
+    HPX_TEST(!c.get());
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = e.get_error() == hpx::error::invalid_status;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// several producers and consumers, every item has to be consumed exactly once
+void test_concurrent(bool batched)
+{
+    std::size_t constexpr num_producers = 4;
+    std::size_t constexpr num_consumers = 4;
+    std::size_t constexpr num_items = 10000;
+    std::size_t constexpr batch_size = 16;
+
+    channel_type c;
+
+    std::vector<std::atomic<int>> consumed(num_producers * num_items);
+    for (auto& count : consumed)
+    {
+        count.store(0, std::memory_order_relaxed);
+    }
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(num_producers);
+    for (std::size_t p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async([&, p]() {
+            int const first = static_cast<int>(p * num_items);
+            if (batched)
+            {
+                std::vector<int> values(batch_size);
+                for (std::size_t i = 0; i < num_items; i += batch_size)
+                {
+                    std::size_t const n = (std::min)(batch_size, num_items - i);
+                    std::iota(values.begin(), values.begin() + n,
+                        first + static_cast<int>(i));
+                    HPX_TEST(c.set_n(values.begin(), n));
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i != num_items; ++i)
+                {
+                    HPX_TEST(c.set(first + static_cast<int>(i)));
+                }
+            }
+        }));
+    }
+
+    std::atomic<std::size_t> remaining(num_producers * num_items);
+
+    std::vector<hpx::future<void>> consumers;
+    consumers.reserve(num_consumers);
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async([&]() {
+            std::vector<int> values;
+            values.reserve(batch_size);
+            while (true)
+            {
+                values.clear();
+                if (batched)
+                {
+                    if (c.get_n_wait(std::back_inserter(values), batch_size) ==
+                        0)
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    int val = 0;
+                    if (!c.get_wait(val))
+                    {
+                        break;
+                    }
+                    values.push_back(val);
+                }
+
+                for (int val : values)
+                {
+                    ++consumed[val];
+                }
+
+                // the last consumer closes the channel to release all others
+                if (remaining.fetch_sub(values.size()) == values.size())
+                {
+                    c.close();
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(producers);
+    hpx::wait_all(consumers);
+
+    for (auto& count : consumed)
+    {
+        HPX_TEST_EQ(count.load(), 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_basic();
+    test_batches();
+    test_wait();
+    test_close();
+    test_concurrent(false);
+    test_concurrent(true);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,145 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify mutual exclusion of hpx::mutex and hpx::timed_mutex under heavy
+// contention, including phases where waiting threads are starved and the
+// ownership is handed over directly.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+std::size_t const num_tasks = 32;
+std::size_t const num_iterations = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+// The critical section is long enough (and occasionally suspends the owner)
+// for waiting threads to run into the starvation threshold.
+template <typename Mutex>
+void critical_section(Mutex& mtx, std::size_t& counter,
+    std::atomic<std::size_t>& owners, std::size_t i)
+{
+    std::lock_guard<Mutex> l(mtx);
+
+    HPX_TEST_EQ(++owners, static_cast<std::size_t>(1));
+
+    std::size_t const value = counter;
+    if (i % 100 == 0)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    else if (i % 10 == 0)
+    {
+        hpx::this_thread::yield();
+    }
+    counter = value + 1;
+
+    HPX_TEST_EQ(--owners, static_cast<std::size_t>(0));
+}
+
+void test_mutex_contention()
+{
+    hpx::mutex mtx;
+    std::size_t counter = 0;
+    std::atomic<std::size_t> owners(0);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&]() {
+            for (std::size_t i = 0; i != num_iterations; ++i)
+            {
+                critical_section(mtx, counter, owners, i);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(counter, num_tasks * num_iterations);
+
+    // the mutex is usable after the contention has ended
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+
+#if defined(HPX_SYNCHRONIZATION_HAVE_MUTEX_STATISTICS)
+    hpx::mutex_statistics const stats = mtx.get_statistics();
+    HPX_TEST_EQ(stats.acquisitions,
+        static_cast<std::uint64_t>(num_tasks * num_iterations));
+    HPX_TEST_LTE(stats.contended, stats.acquisitions);
+    HPX_TEST_LTE(stats.spin_acquisitions, stats.acquisitions);
+    HPX_TEST_LTE(stats.handoffs, stats.contended);
+#endif
+}
+
+void test_timed_mutex_contention()
+{
+    hpx::timed_mutex mtx;
+    std::size_t counter = 0;
+    std::atomic<std::size_t> owners(0);
+    std::atomic<std::size_t> timeouts(0);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&, t]() {
+            for (std::size_t i = 0; i != num_iterations; ++i)
+            {
+                // half of the threads give up waiting after a while
+                if (t % 2 == 0)
+                {
+                    critical_section(mtx, counter, owners, i);
+                }
+                else if (mtx.try_lock_for(std::chrono::microseconds(100)))
+                {
+                    std::unique_lock<hpx::timed_mutex> l(mtx, std::adopt_lock);
+                    ++counter;
+                }
+                else
+                {
+                    ++timeouts;
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(counter + timeouts, num_tasks * num_iterations);
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_mutex_contention();
+    test_timed_mutex_contention();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
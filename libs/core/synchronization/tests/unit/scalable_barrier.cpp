@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::experimental::central_arrival;
+using hpx::experimental::combining_tree_arrival;
+
+std::size_t constexpr num_phases = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+// Every participant increments the counter once per phase, all participants
+// have to observe the counter value of the completed phase after each wait.
+template <typename Arrival, typename Launch>
+void test_barrier(std::size_t num_participants,
+    std::vector<std::size_t> const& groups, Launch&& launch)
+{
+    std::atomic<std::size_t> counter(0);
+    std::atomic<std::size_t> completions(0);
+
+    auto on_completion = [&]() noexcept {
+        HPX_TEST_EQ(counter.load(),
+            (completions.load() + 1) * num_participants);
+        ++completions;
+    };
+
+    using barrier_type = hpx::experimental::scalable_barrier<Arrival,
+        decltype(on_completion)>;
+
+    auto run = [&](barrier_type& b) {
+        launch([&](std::size_t rank) {
+            for (std::size_t phase = 0; phase != num_phases; ++phase)
+            {
+                ++counter;
+                b.arrive_and_wait(rank);
+                HPX_TEST_LTE((phase + 1) * num_participants, counter.load());
+                HPX_TEST_LTE(phase + 1, completions.load());
+            }
+        });
+    };
+
+    if (groups.empty())
+    {
+        barrier_type b(num_participants, on_completion);
+        HPX_TEST_EQ(b.size(), num_participants);
+        run(b);
+    }
+    else
+    {
+        barrier_type b(groups, on_completion);
+        HPX_TEST_EQ(b.size(), num_participants);
+        run(b);
+    }
+
+    HPX_TEST_EQ(counter.load(), num_phases * num_participants);
+    HPX_TEST_EQ(completions.load(), num_phases);
+}
+
+template <typename Arrival>
+void test_latch(std::size_t num_participants)
+{
+    hpx::experimental::scalable_latch<Arrival> l(num_participants);
+    HPX_TEST(!l.try_wait());
+
+    std::atomic<std::size_t> counter(0);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_participants);
+    for (std::size_t rank = 0; rank != num_participants; ++rank)
+    {
+        tasks.push_back(hpx::async([&, rank]() {
+            ++counter;
+            if (rank % 2 == 0)
+            {
+                l.arrive_and_wait(rank);
+                HPX_TEST_EQ(counter.load(), num_participants);
+            }
+            else
+            {
+                l.count_down(rank);
+            }
+        }));
+    }
+
+    l.wait();
+    HPX_TEST(l.try_wait());
+    HPX_TEST_EQ(counter.load(), num_participants);
+
+    hpx::wait_all(tasks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// participants running as HPX threads
+template <typename F>
+void launch_hpx(std::size_t num_participants, F const& f)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_participants);
+    for (std::size_t rank = 0; rank != num_participants; ++rank)
+    {
+        tasks.push_back(hpx::async([&f, rank]() { f(rank); }));
+    }
+    hpx::wait_all(tasks);
+}
+
+// participants running as OS threads
+template <typename F>
+void launch_os(std::size_t num_participants, F const& f)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(num_participants);
+    for (std::size_t rank = 0; rank != num_participants; ++rank)
+    {
+        threads.emplace_back([&f, rank]() { f(rank); });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+template <typename Arrival>
+void test_arrival_policy()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    for (std::size_t n : {std::size_t(1), std::size_t(3), num_threads,
+             4 * num_threads + 1})
+    {
+        test_barrier<Arrival>(n, {}, [n](auto&& f) { launch_hpx(n, f); });
+        test_barrier<Arrival>(n, {}, [n](auto&& f) { launch_os(n, f); });
+
+        // explicit groups, several levels of tree nodes are necessary for
+        // the larger participant counts
+        std::vector<std::size_t> groups(n);
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            groups[i] = (i * 7) % 3;
+        }
+        test_barrier<Arrival>(n, groups, [n](auto&& f) { launch_hpx(n, f); });
+        test_barrier<Arrival>(n, groups, [n](auto&& f) { launch_os(n, f); });
+
+        test_latch<Arrival>(n);
+    }
+}
+
+void test_default_rank()
+{
+    // the rank of a participant defaults to its worker thread number
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    hpx::experimental::scalable_barrier<> b(num_threads);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_priority::bound,
+            hpx::threads::thread_stacksize::default_,
+            hpx::threads::thread_schedule_hint(
+                hpx::threads::thread_schedule_hint_mode::thread,
+                static_cast<std::int16_t>(i)));
+
+        tasks.push_back(hpx::async(exec, [&]() {
+            for (std::size_t phase = 0; phase != num_phases; ++phase)
+            {
+                b.arrive_and_wait();
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_arrival_policy<central_arrival>();
+    test_arrival_policy<combining_tree_arrival>();
+    test_default_rank();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -84,6 +84,9 @@ namespace hpx::threads::detail {
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
 
+        void create_work_batch(std::vector<thread_init_data>& data,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -189,6 +192,12 @@ namespace hpx::threads::detail {
             return active_os_thread_count;
         }
 
+        std::int64_t get_num_missed_deadlines(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_missed_deadlines(num, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num, bool reset) override
@@ -225,7 +234,67 @@ namespace hpx::threads::detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_same_core(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_same_core(num, reset);
+        }
+
+        std::int64_t get_num_stolen_same_cache(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_same_cache(num, reset);
+        }
+
+        std::int64_t get_num_stolen_same_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_same_numa_domain(
+                num, reset);
+        }
+
+        std::int64_t get_num_stolen_remote(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_remote(num, reset);
+        }
 #endif
+        std::int64_t get_num_steal_requests_same_core(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_by_distance(
+                num, 0, reset);
+        }
+
+        std::int64_t get_num_steal_requests_same_cache(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_by_distance(
+                num, 1, reset);
+        }
+
+        std::int64_t get_num_steal_requests_same_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_by_distance(
+                num, 2, reset);
+        }
+
+        std::int64_t get_num_steal_requests_remote(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_by_distance(
+                num, 3, reset);
+        }
+
+        std::int64_t get_num_steal_requests_skipping_closer(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_skipping_closer(
+                num, reset);
+        }
+
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
         {
@@ -240,7 +240,8 @@ namespace hpx::threads::detail {
             sched_->Scheduler::set_all_states_at_least(hpx::state::stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(static_cast<std::size_t>(-1));
+            sched_->Scheduler::do_some_work(
+                static_cast<std::size_t>(-1), static_cast<std::size_t>(-1));
 
             if (blocking)
             {
@@ -254,6 +255,7 @@ namespace hpx::threads::detail {
                     LTM_(info).format("stop: {} notify_all", id_.name());
 
                     sched_->Scheduler::do_some_work(
+                        static_cast<std::size_t>(-1),
                         static_cast<std::size_t>(-1));
 
                     LTM_(info).format("stop: {} join:{}", id_.name(), i);
@@ -664,6 +666,36 @@ namespace hpx::threads::detail {
         return id;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_batch(
+        std::vector<thread_init_data>& data, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 &&
+            !sched_->Scheduler::is_state(hpx::state::running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                "thread_pool<Scheduler>::create_work_batch",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        if (!sched_->Scheduler::supports_direct_execution())
+        {
+            for (auto& d : data)
+            {
+                d.schedulehint.runs_as_child_mode(
+                    hpx::threads::thread_execution_hint::none);
+            }
+        }
+
+        detail::create_work_batch(sched_.get(), data, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(data.size());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -405,6 +405,13 @@ namespace hpx::threads::detail {
                     ++counters.executed_threads_;
 #endif
                     HPX_ASSERT(!thrdptr->runs_as_child());
+                    if (std::uint64_t const deadline =
+                            thrdptr->get_deadline();
+                        deadline != 0)
+                    {
+                        scheduler.SchedulingPolicy::count_missed_deadline(
+                            num_thread, deadline);
+                    }
                     thrd = thread_id_type();
                 }
             }
@@ -8,11 +8,19 @@
 
 #include <hpx/config.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
+#include <vector>
+
 namespace hpx::threads::detail {
 
     HPX_CORE_EXPORT thread_id_ref_type create_work(
         policies::scheduler_base* scheduler, threads::thread_init_data& data,
         error_code& ec = throws);
+
+    // Create all given work items at once. All of them have to be pending,
+    // the ids of the new threads are not returned.
+    HPX_CORE_EXPORT void create_work_batch(policies::scheduler_base* scheduler,
+        std::vector<threads::thread_init_data>& data, error_code& ec = throws);
 }    // namespace hpx::threads::detail
@@ -103,8 +103,10 @@ namespace hpx::threads::policies {
 
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// possibly idling OS threads. It wakes up to \a count parked worker
+        /// threads (preferring \a num_thread), passing std::size_t(-1) as
+        /// \a count wakes up all of them.
+        void do_some_work(std::size_t num_thread, std::size_t count = 1);
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -182,8 +184,50 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // number of threads stolen by the given core, broken down by the
+        // topological distance to the victim core (not all schedulers keep
+        // track of those)
+        virtual std::int64_t get_num_stolen_same_core(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_same_cache(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_same_numa_domain(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_remote(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
 #endif
 
+        // number of steal requests sent on behalf of the given core, broken
+        // down by the topological distance between the given core and the
+        // asked victim (0: same core, 1: same cache, 2: same NUMA domain,
+        // 3: remote), and the number of those requests that were sent while
+        // a closer core had not been asked yet (not all schedulers keep track
+        // of those)
+        virtual std::int64_t get_num_steal_requests_by_distance(
+            std::size_t /* num_thread */, std::size_t /* distance */,
+            bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_skipping_closer(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = static_cast<std::size_t>(-1)) const = 0;
 
@@ -201,6 +245,12 @@ namespace hpx::threads::policies {
         void increment_background_thread_count() noexcept;
         void decrement_background_thread_count() noexcept;
 
+        // count threads which finished after their deadline had passed
+        void count_missed_deadline(
+            std::size_t num_thread, std::uint64_t deadline) noexcept;
+        std::int64_t get_num_missed_deadlines(
+            std::size_t num_thread, bool reset) noexcept;
+
         // Enumerate all matching threads
         virtual bool enumerate_threads(
             hpx::function<bool(thread_id_type)> const& f,
@@ -216,6 +266,12 @@ namespace hpx::threads::policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create a batch of new pending threads. Schedulers may override this
+        // to distribute the threads over their queues more efficiently, by
+        // default the threads are created one by one.
+        virtual void create_thread_batch(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual void schedule_thread(threads::thread_id_ref_type thrd,
             threads::thread_schedule_hint schedulehint,
             bool allow_fallback = false,
@@ -282,15 +338,29 @@ namespace hpx::threads::policies {
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
+        // support for parking worker threads on idle queues
         struct idle_backoff_data
         {
-            std::uint32_t wait_count_;
-            double max_idle_backoff_time_;
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+
+            // the worker thread is parked (waiting on cond_)
+            std::atomic<bool> parked_ = false;
+
+            std::uint32_t wait_count_ = 0;
+            std::uint32_t spin_count_ = 0;
+            double max_idle_backoff_time_ = 0.0;
+
+            // moving average of the time (in microseconds) the worker thread
+            // stayed parked
+            double idle_time_estimate_ = 0.0;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // number of currently parked worker threads
+        util::cache_line_data<std::atomic<std::size_t>> num_parked_;
+
+        bool wake_parked_thread(std::size_t num_thread);
 #endif
 
         // support for suspension of pus
@@ -309,6 +379,10 @@ namespace hpx::threads::policies {
 
         std::atomic<std::int64_t> background_thread_count_;
 
+        // number of threads per core which have missed their deadline
+        std::vector<util::cache_line_data<std::atomic<std::int64_t>>>
+            missed_deadlines_;
+
         std::atomic<polling_function_ptr> polling_function_mpi_;
         std::atomic<polling_function_ptr> polling_function_cuda_;
         std::atomic<polling_function_ptr> polling_function_sycl_;
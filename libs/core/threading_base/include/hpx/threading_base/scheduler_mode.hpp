@@ -80,6 +80,13 @@ namespace hpx::threads::policies {
         /// 'normal' work scheduling is performed.
         do_background_work_only = 0x1000,
 
+        /// This option tells schedulers that support it to select the victims
+        /// for stealing by their topological distance, i.e. trying the cores
+        /// sharing the same physical core first, then the cores sharing the
+        /// same (L3) cache, then the cores in the same NUMA domain, and only
+        /// then all remaining cores
+        steal_hierarchically = 0x2000,
+
         // clang-format off
         /// This option represents the default mode.
         default_ =
@@ -106,7 +113,8 @@ namespace hpx::threads::policies {
             steal_high_priority_first |
             steal_after_local |
             enable_idle_backoff |
-            do_background_work_only
+            do_background_work_only |
+            steal_hierarchically
         // clang-format on
     };
 
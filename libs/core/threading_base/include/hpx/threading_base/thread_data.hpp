@@ -443,6 +443,34 @@ namespace hpx::threads {
             priority_ = priority;
         }
 
+        // the point in time this thread should have finished running by (see
+        // thread_init_data::deadline), zero if none
+        constexpr std::uint64_t get_deadline() const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(std::uint64_t deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
+        // the deadline applied to the threads created by this thread (see
+        // scoped_thread_deadline), zero if none
+        constexpr std::uint64_t get_scoped_deadline() const noexcept
+        {
+            return scoped_deadline_;
+        }
+        std::uint64_t exchange_scoped_deadline(std::uint64_t deadline) noexcept
+        {
+            return std::exchange(scoped_deadline_, deadline);
+        }
+
+        // the scheduling hint this thread was created with
+        constexpr thread_schedule_hint get_schedule_hint() const noexcept
+        {
+            return schedulehint_;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -634,6 +662,9 @@ namespace hpx::threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::uint64_t deadline_;
+        std::uint64_t scoped_deadline_;
+        thread_schedule_hint schedulehint_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
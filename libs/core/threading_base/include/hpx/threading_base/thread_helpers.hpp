@@ -419,6 +419,75 @@ namespace hpx::threads {
 
     HPX_CORE_EXPORT std::size_t& get_continuation_recursion_count() noexcept;
     HPX_CORE_EXPORT void reset_continuation_recursion_count() noexcept;
+
+    // returns whether a task or continuation can be run directly on the
+    // calling thread, i.e. whether the calling thread is an HPX thread and the
+    // depth of the nested continuations does not exceed the configured limit
+    HPX_CORE_EXPORT bool can_run_continuation_inline() noexcept;
+
+    // keeps track of the depth of the nested continuations run directly
+    struct scoped_continuation_recursion_count
+    {
+        scoped_continuation_recursion_count() noexcept
+          : count_(get_continuation_recursion_count())
+        {
+            ++count_;
+        }
+
+        scoped_continuation_recursion_count(
+            scoped_continuation_recursion_count const&) = delete;
+        scoped_continuation_recursion_count(
+            scoped_continuation_recursion_count&&) = delete;
+        scoped_continuation_recursion_count& operator=(
+            scoped_continuation_recursion_count const&) = delete;
+        scoped_continuation_recursion_count& operator=(
+            scoped_continuation_recursion_count&&) = delete;
+
+        ~scoped_continuation_recursion_count()
+        {
+            --count_;
+        }
+
+        std::size_t& count_;
+    };
+
+    // returns the deadline applied to the threads created by the calling
+    // thread that don't have a deadline of their own, zero if none
+    HPX_CORE_EXPORT std::uint64_t get_scoped_deadline() noexcept;
+
+    // sets the deadline returned by get_scoped_deadline, returns the previous
+    // value
+    HPX_CORE_EXPORT std::uint64_t exchange_scoped_deadline(
+        std::uint64_t deadline) noexcept;
+
+    // applies the given deadline (see thread_init_data::deadline) to all
+    // threads created by the calling thread while this object is alive, does
+    // nothing if the given deadline is zero
+    struct scoped_thread_deadline
+    {
+        explicit scoped_thread_deadline(std::uint64_t deadline) noexcept
+          : active_(deadline != 0)
+          , prev_(active_ ? exchange_scoped_deadline(deadline) : 0)
+        {
+        }
+
+        scoped_thread_deadline(scoped_thread_deadline const&) = delete;
+        scoped_thread_deadline(scoped_thread_deadline&&) = delete;
+        scoped_thread_deadline& operator=(
+            scoped_thread_deadline const&) = delete;
+        scoped_thread_deadline& operator=(scoped_thread_deadline&&) = delete;
+
+        ~scoped_thread_deadline()
+        {
+            if (active_)
+            {
+                exchange_scoped_deadline(prev_);
+            }
+        }
+
+        bool active_;
+        std::uint64_t prev_;
+    };
     /// \endcond
 
     /// Returns a pointer to the pool that was used to run the current thread
@@ -11,10 +11,12 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -47,6 +49,7 @@ namespace hpx::threads {
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
           , scheduler_base(nullptr)
+          , deadline(0)
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -66,6 +69,7 @@ namespace hpx::threads {
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
             scheduler_base = rhs.scheduler_base;
+            deadline = rhs.deadline;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
 #endif
@@ -105,6 +109,7 @@ namespace hpx::threads {
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
           , scheduler_base(rhs.scheduler_base)
+          , deadline(rhs.deadline)
         {
         }
 
@@ -139,6 +144,7 @@ namespace hpx::threads {
           , initial_state(initial_state_)
           , run_now(run_now_)
           , scheduler_base(scheduler_base_)
+          , deadline(0)
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -171,5 +177,26 @@ namespace hpx::threads {
         bool run_now;
 
         policies::scheduler_base* scheduler_base;
+
+        // The point in time (as returned by
+        // hpx::chrono::high_resolution_clock::now()) the new thread should
+        // have finished running by. Threads with a deadline are run in
+        // earliest-deadline-first order before all other threads of the same
+        // queue. Zero means no deadline.
+        std::uint64_t deadline;
     };
+
+    // Return the deadline for a thread that should have finished running
+    // after the given amount of time has passed from now. Returns zero (no
+    // deadline) if the given duration is zero.
+    inline std::uint64_t make_thread_deadline(
+        std::chrono::nanoseconds timeout) noexcept
+    {
+        if (timeout.count() <= 0)
+        {
+            return 0;
+        }
+        return hpx::chrono::high_resolution_clock::now() +
+            static_cast<std::uint64_t>(timeout.count());
+    }
 }    // namespace hpx::threads
@@ -29,6 +29,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -198,6 +199,8 @@ namespace hpx::threads {
             thread_init_data& data, thread_id_ref_type& id, error_code& ec) = 0;
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work_batch(
+            std::vector<thread_init_data>& data, error_code& ec);
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
@@ -352,6 +355,12 @@ namespace hpx::threads {
             return 0;
         }
 
+        virtual std::int64_t get_num_missed_deadlines(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
 #if defined(HPX_HAVE_THREAD_QUEUE_WAITTIME)
         virtual std::int64_t get_average_thread_wait_time(
             std::size_t /*thread_num*/, bool /*reset*/)
@@ -397,7 +406,53 @@ namespace hpx::threads {
         {
             return 0;
         }
+
+        virtual std::int64_t get_num_stolen_same_core(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_same_cache(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_same_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_remote(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
+        virtual std::int64_t get_num_steal_requests_same_core(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_same_cache(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_same_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_remote(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_skipping_closer(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
             bool /*reset*/)
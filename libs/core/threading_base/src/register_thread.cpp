@@ -12,9 +12,12 @@
 #include <hpx/threading_base/detail/get_default_pool.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
+#include <vector>
+
 namespace hpx::threads {
 
     ///////////////////////////////////////////////////////////////////////////
@@ -38,6 +41,16 @@ namespace hpx::threads {
                 threads::thread_schedule_state::terminated,
                 threads::invalid_thread_id);
         }
+
+        // threads without a deadline of their own inherit the one set by the
+        // creating thread (see scoped_thread_deadline)
+        void apply_scoped_deadline(threads::thread_init_data& data) noexcept
+        {
+            if (data.deadline == 0)
+            {
+                data.deadline = get_scoped_deadline();
+            }
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -48,6 +61,7 @@ namespace hpx::threads {
 
         threads::thread_id_ref_type id = threads::invalid_thread_id;
         data.run_now = true;
+        detail::apply_scoped_deadline(data);
         pool->create_thread(data, id, ec);
         return id;
     }
@@ -59,6 +73,7 @@ namespace hpx::threads {
         HPX_ASSERT(pool);
 
         data.run_now = true;
+        detail::apply_scoped_deadline(data);
         pool->create_thread(data, id, ec);
     }
 
@@ -69,6 +84,7 @@ namespace hpx::threads {
         HPX_ASSERT(pool);
 
         data.run_now = true;
+        detail::apply_scoped_deadline(data);
         pool->create_thread(data, id, ec);
     }
 
@@ -80,6 +96,7 @@ namespace hpx::threads {
 
         threads::thread_id_ref_type id = threads::invalid_thread_id;
         data.run_now = true;
+        detail::apply_scoped_deadline(data);
         pool->create_thread(data, id, ec);
         return id;
     }
@@ -90,6 +107,7 @@ namespace hpx::threads {
     {
         HPX_ASSERT(pool);
         data.run_now = false;
+        detail::apply_scoped_deadline(data);
         return pool->create_work(data, ec);
     }
 
@@ -100,6 +118,25 @@ namespace hpx::threads {
         HPX_ASSERT(pool);
 
         data.run_now = false;
+        detail::apply_scoped_deadline(data);
         return pool->create_work(data, ec);
     }
+
+    void register_work_batch(std::vector<threads::thread_init_data>& data,
+        threads::thread_pool_base* pool, error_code& ec)
+    {
+        HPX_ASSERT(pool);
+        for (auto& d : data)
+        {
+            d.run_now = false;
+            detail::apply_scoped_deadline(d);
+        }
+        pool->create_work_batch(data, ec);
+    }
+
+    void register_work_batch(
+        std::vector<threads::thread_init_data>& data, error_code& ec)
+    {
+        register_work_batch(data, detail::get_self_or_default_pool(), ec);
+    }
 }    // namespace hpx::threads
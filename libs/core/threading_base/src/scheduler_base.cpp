@@ -12,6 +12,7 @@
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
 #endif
@@ -39,7 +40,13 @@ namespace hpx::threads::policies {
         char const* description,
         thread_queue_init_parameters const& thread_queue_init,
         scheduler_mode mode)
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+      : wait_counts_(num_threads)
+      , num_parked_(0)
+      , suspend_mtxs_(num_threads)
+#else
       : suspend_mtxs_(num_threads)
+#endif
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
       , states_(num_threads)
@@ -47,6 +54,7 @@ namespace hpx::threads::policies {
       , thread_queue_init_(thread_queue_init)
       , parent_pool_(nullptr)
       , background_thread_count_(0)
+      , missed_deadlines_(num_threads)
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
       , polling_function_sycl_(&null_polling_function)
@@ -58,19 +66,35 @@ namespace hpx::threads::policies {
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double const max_time = thread_queue_init.max_idle_backoff_time_;
-
-        wait_counts_.resize(num_threads);
         for (auto&& data : wait_counts_)
         {
-            data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
+        {
             states_[i].data_.store(hpx::state::initialized);
+            missed_deadlines_[i].data_.store(0, std::memory_order_relaxed);
+        }
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+
+        // weight of a new sample in the moving average of the idle times
+        constexpr double idle_time_estimate_weight = 0.125;
+
+        // idle times (in microseconds) below this threshold are expected to
+        // be shorter than the cost of parking and waking up a worker thread
+        constexpr double idle_time_spin_threshold = 1000.0;
+
+        // maximal number of consecutive idle rounds a worker thread keeps
+        // spinning instead of being parked
+        constexpr std::uint32_t max_idle_spin_count = 4;
+    }    // namespace
+#endif
+
     void scheduler_base::idle_callback([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
@@ -82,6 +106,17 @@ namespace hpx::threads::policies {
 
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
+            // Keep spinning for a couple of rounds if new work has recently
+            // arrived shortly after this thread was parked.
+            if (data.wait_count_ == 0 &&
+                data.idle_time_estimate_ < idle_time_spin_threshold &&
+                data.spin_count_ < max_idle_spin_count)
+            {
+                ++data.spin_count_;
+                return;
+            }
+            data.spin_count_ = 0;
+
             // Exponential back-off with a maximum sleep time.
             static constexpr std::int64_t const max_exponent =
                 std::numeric_limits<double>::max_exponent;
@@ -94,9 +129,46 @@ namespace hpx::threads::policies {
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) ==    //-V1089
-                std::cv_status::no_timeout)
+            auto const start = std::chrono::steady_clock::now();
+            bool woken_up = false;
+
+            {
+                std::unique_lock<pu_mutex_type> l(data.mtx_);
+
+                // Announce that this thread is about to be parked before
+                // looking for new work a last time, this pairs with the check
+                // for parked threads in do_some_work.
+                data.parked_.store(true, std::memory_order_relaxed);
+                ++num_parked_.data_;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (get_queue_length() == 0)
+                {
+                    woken_up = data.cond_.wait_for(l, period, [&] {
+                        return !data.parked_.load(std::memory_order_relaxed);
+                    });
+                }
+                else
+                {
+                    woken_up = true;
+                }
+
+                // unregister, if nobody has done so while waking us up
+                if (data.parked_.load(std::memory_order_relaxed))
+                {
+                    data.parked_.store(false, std::memory_order_relaxed);
+                    --num_parked_.data_;
+                }
+            }
+
+            double const idle_time =
+                std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+            data.idle_time_estimate_ += idle_time_estimate_weight *
+                (idle_time - data.idle_time_estimate_);
+
+            if (woken_up)
             {
                 // reset counter if thread was woken up
                 data.wait_count_ = 0;
@@ -105,16 +177,66 @@ namespace hpx::threads::policies {
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    // Wake up one parked worker thread, preferring the given one
+    bool scheduler_base::wake_parked_thread(std::size_t num_thread)
+    {
+        std::size_t const num_threads = wait_counts_.size();
+        if (num_thread >= num_threads)
+        {
+            num_thread = 0;
+        }
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            idle_backoff_data& data =
+                wait_counts_[(num_thread + i) % num_threads].data_;
+
+            if (!data.parked_.load(std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            std::unique_lock<pu_mutex_type> l(data.mtx_);
+            if (data.parked_.load(std::memory_order_relaxed))
+            {
+                data.parked_.store(false, std::memory_order_relaxed);
+                --num_parked_.data_;
+
+                l.unlock();
+                data.cond_.notify_one();
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work([[maybe_unused]] std::size_t num_thread,
+        [[maybe_unused]] std::size_t count)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        bool const wake_all = count == static_cast<std::size_t>(-1);
+        if (wake_all ||
+            (mode_.data_.load(std::memory_order_relaxed) &
+                policies::scheduler_mode::enable_idle_backoff))
         {
-            cond_.notify_all();
+            // avoid touching any of the parked threads if there are none
+            while (count != 0 &&
+                num_parked_.data_.load(std::memory_order_seq_cst) != 0)
+            {
+                if (!wake_parked_thread(num_thread))
+                {
+                    break;
+                }
+                if (!wake_all)
+                {
+                    --count;
+                }
+            }
         }
 #endif
     }
@@ -324,7 +446,8 @@ namespace hpx::threads::policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(static_cast<std::size_t>(-1));
+        do_some_work(
+            static_cast<std::size_t>(-1), static_cast<std::size_t>(-1));
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode) noexcept
@@ -376,6 +499,56 @@ namespace hpx::threads::policies {
         --background_thread_count_;
     }
 
+    void scheduler_base::create_thread_batch(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
+    void scheduler_base::count_missed_deadline(
+        std::size_t num_thread, std::uint64_t deadline) noexcept
+    {
+        if (deadline == 0 || num_thread >= missed_deadlines_.size())
+            return;
+
+        if (static_cast<std::uint64_t>(hpx::chrono::high_resolution_clock::
+                    now()) > deadline)
+        {
+            missed_deadlines_[num_thread].data_.fetch_add(
+                1, std::memory_order_relaxed);
+        }
+    }
+
+    std::int64_t scheduler_base::get_num_missed_deadlines(
+        std::size_t num_thread, bool reset) noexcept
+    {
+        auto const get_value = [reset](auto& value) {
+            return reset ? value.data_.exchange(0, std::memory_order_relaxed) :
+                           value.data_.load(std::memory_order_relaxed);
+        };
+
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            if (num_thread >= missed_deadlines_.size())
+                return 0;
+            return get_value(missed_deadlines_[num_thread]);
+        }
+
+        std::int64_t result = 0;
+        for (auto& value : missed_deadlines_)
+        {
+            result += get_value(value);
+        }
+        return result;
+    }
+
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     coroutines::detail::tss_data_node* scheduler_base::find_tss_data(
         void const* key)
@@ -71,6 +71,9 @@ namespace hpx::threads {
       , backtrace_(nullptr)
 #endif
       , priority_(init_data.priority)
+      , deadline_(init_data.deadline)
+      , scoped_deadline_(0)
+      , schedulehint_(init_data.schedulehint)
       , requested_interrupt_(false)
       , enabled_interrupt_(true)
       , ran_exit_funcs_(false)
@@ -220,6 +223,9 @@ namespace hpx::threads {
         backtrace_ = nullptr;
 #endif
         priority_ = init_data.priority;
+        deadline_ = init_data.deadline;
+        scoped_deadline_ = 0;
+        schedulehint_ = init_data.schedulehint;
         requested_interrupt_ = false;
         enabled_interrupt_ = true;
         ran_exit_funcs_ = false;
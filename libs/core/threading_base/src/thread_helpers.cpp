@@ -8,6 +8,7 @@
 #include <hpx/threading_base/thread_helpers.hpp>
 
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
@@ -32,6 +33,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -297,6 +299,7 @@ namespace hpx::threads {
     namespace {
 
         thread_local std::size_t continuation_recursion_count(0);
+        thread_local std::uint64_t scoped_deadline(0);
     }
 
     std::size_t& get_continuation_recursion_count() noexcept
@@ -313,6 +316,40 @@ namespace hpx::threads {
         continuation_recursion_count = 0;
     }
 
+    // HPX threads keep the deadline in their thread data as they may be
+    // suspended (and resumed on a different OS thread) while it is in effect
+    std::uint64_t get_scoped_deadline() noexcept
+    {
+        if (auto const* thrd = get_self_id_data())
+        {
+            return thrd->get_scoped_deadline();
+        }
+        return scoped_deadline;
+    }
+
+    std::uint64_t exchange_scoped_deadline(std::uint64_t deadline) noexcept
+    {
+        if (auto* thrd = get_self_id_data())
+        {
+            return thrd->exchange_scoped_deadline(deadline);
+        }
+        return std::exchange(scoped_deadline, deadline);
+    }
+
+    bool can_run_continuation_inline() noexcept
+    {
+        if (get_self_ptr() == nullptr)
+        {
+            return false;
+        }
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        return hpx::this_thread::has_sufficient_stack_space();
+#else
+        return get_continuation_recursion_count() <
+            HPX_CONTINUATION_MAX_RECURSION_DEPTH;
+#endif
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void run_thread_exit_callbacks(thread_id_type const& id, error_code& ec)
     {
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 namespace hpx::threads {
 
@@ -129,6 +130,19 @@ namespace hpx::threads {
             thread_priority::default_, num_thread, reset);
     }
 
+    void thread_pool_base::create_work_batch(
+        std::vector<thread_init_data>& data, error_code& ec)
+    {
+        for (auto& d : data)
+        {
+            create_work(d, ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
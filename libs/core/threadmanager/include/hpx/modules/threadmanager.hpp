@@ -224,6 +224,7 @@ namespace hpx::threads {
     public:
         // performance counters
         std::int64_t get_queue_length(bool reset) const;
+        std::int64_t get_num_missed_deadlines(bool reset) const;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(bool reset) const;
         std::int64_t get_average_task_wait_time(bool reset) const;
@@ -277,7 +278,17 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_from_staged(bool reset) const;
         std::int64_t get_num_stolen_to_pending(bool reset) const;
         std::int64_t get_num_stolen_to_staged(bool reset) const;
+        std::int64_t get_num_stolen_same_core(bool reset) const;
+        std::int64_t get_num_stolen_same_cache(bool reset) const;
+        std::int64_t get_num_stolen_same_numa_domain(bool reset) const;
+        std::int64_t get_num_stolen_remote(bool reset) const;
 #endif
+        std::int64_t get_num_steal_requests_same_core(bool reset) const;
+        std::int64_t get_num_steal_requests_same_cache(bool reset) const;
+        std::int64_t get_num_steal_requests_same_numa_domain(
+            bool reset) const;
+        std::int64_t get_num_steal_requests_remote(bool reset) const;
+        std::int64_t get_num_steal_requests_skipping_closer(bool reset) const;
 
     private:
         policies::thread_queue_init_parameters get_init_parameters() const;
@@ -293,6 +304,9 @@ namespace hpx::threads {
         void create_scheduler_local_priority_lifo(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_priority_chase_lev(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static(thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static_priority(
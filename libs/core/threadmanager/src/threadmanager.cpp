@@ -130,6 +130,10 @@ namespace hpx::threads {
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.init_threads_count",
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
+        std::int64_t const max_runnext_count =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_runnext_count",
+                HPX_THREAD_QUEUE_MAX_RUNNEXT_COUNT);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
 
@@ -147,7 +151,7 @@ namespace hpx::threads {
             min_add_new_count, max_add_new_count, min_delete_count,
             max_delete_count, max_terminated_threads, init_threads_count,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            large_stacksize, huge_stacksize, max_runnext_count);
     }
 
     void threadmanager::create_scheduler_user_defined(
@@ -278,6 +282,46 @@ namespace hpx::threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_local_priority_chase_lev(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::chase_lev_lifo>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_priority_queue_scheduler-chase_lev");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_scheduler_static(
         thread_pool_init_parameters const& thread_pool_init,
         policies::thread_queue_init_parameters const& thread_queue_init,
@@ -773,6 +817,11 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_priority_chase_lev:
+                create_scheduler_local_priority_chase_lev(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::static_:
                 create_scheduler_static(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -1193,6 +1242,14 @@ namespace hpx::threads {
         return result;
     }
 
+    std::int64_t threadmanager::get_num_missed_deadlines(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_missed_deadlines(all_threads, reset);
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     std::int64_t threadmanager::get_average_thread_wait_time(bool reset) const
     {
@@ -1463,8 +1520,92 @@ namespace hpx::threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_same_core(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_same_core(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_same_cache(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_same_cache(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_same_numa_domain(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_same_numa_domain(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_remote(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_remote(all_threads, reset);
+        return result;
+    }
 #endif
 
+    std::int64_t threadmanager::get_num_steal_requests_same_core(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_requests_same_core(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_requests_same_cache(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_requests_same_cache(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_requests_same_numa_domain(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_requests_same_numa_domain(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_requests_remote(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_steal_requests_remote(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_requests_skipping_closer(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_requests_skipping_closer(
+                all_threads, reset);
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool threadmanager::run() const
     {
@@ -190,6 +190,21 @@ namespace hpx::threads {
         mask_cref_type get_core_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the cache of the given level with
+        ///        the processing unit the given thread is running on.
+        ///
+        /// \param num_thread [in]
+        /// \param level      [in] the cache level (1 to 5)
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        ///
+        /// \note  If no cache of the requested level is known for the given
+        ///        thread, the NUMA domain mask of that thread is returned.
+        mask_type get_cache_affinity_mask(std::size_t num_thread, int level,
+            error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -126,6 +126,31 @@ namespace hpx::threads::detail {
         return node;
     }
 
+#if HWLOC_API_VERSION >= 0x00020000
+    // map the given cache level onto the corresponding hwloc object type
+    hwloc_obj_type_t get_cache_obj_type(int level) noexcept
+    {
+        switch (level)
+        {
+        case 2:
+            return HWLOC_OBJ_L2CACHE;
+
+        case 3:
+            return HWLOC_OBJ_L3CACHE;
+
+        case 4:
+            return HWLOC_OBJ_L4CACHE;
+
+        case 5:
+            return HWLOC_OBJ_L5CACHE;
+
+        default:
+            break;
+        }
+        return HWLOC_OBJ_L1CACHE;
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     // abstract away memory page size
     std::size_t get_memory_page_size_impl()
@@ -463,6 +488,55 @@ namespace hpx::threads {
         return empty_mask;
     }
 
+    mask_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, int level, error_code& ec) const
+    {
+        std::size_t const num_pu = (num_thread + pu_offset) % num_of_pus_;
+        hwloc_obj_t cache_obj = nullptr;
+
+        if (level >= 1 && level <= 5)
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+
+            hwloc_obj_t const pu_obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+            if (pu_obj != nullptr)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                cache_obj = hwloc_get_ancestor_obj_by_type(
+                    topo, detail::get_cache_obj_type(level), pu_obj);
+#else
+                for (hwloc_obj_t obj = pu_obj->parent; obj != nullptr;
+                     obj = obj->parent)
+                {
+                    if (obj->type == HWLOC_OBJ_CACHE &&
+                        obj->attr->cache.depth ==
+                            static_cast<unsigned>(level))
+                    {
+                        cache_obj = obj;
+                        break;
+                    }
+                }
+#endif
+            }
+        }
+
+        // fall back to the NUMA domain if the cache level is not known
+        if (cache_obj == nullptr)
+        {
+            return get_numa_node_affinity_mask(num_thread, ec);
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        auto mask = mask_type();
+        resize(mask, get_number_of_pus());
+
+        extract_node_mask(cache_obj, mask);
+        return mask;
+    }
+
     mask_cref_type topology::get_thread_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {
@@ -1493,28 +1567,7 @@ namespace hpx::threads {
         std::size_t cache_size = 0;
 
 #if HWLOC_API_VERSION >= 0x00020000
-        hwloc_obj_type_t type = HWLOC_OBJ_L1CACHE;
-        switch (level)
-        {
-        case 2:
-            type = HWLOC_OBJ_L2CACHE;
-            break;
-
-        case 3:
-            type = HWLOC_OBJ_L3CACHE;
-            break;
-
-        case 4:
-            type = HWLOC_OBJ_L4CACHE;
-            break;
-
-        case 5:
-            type = HWLOC_OBJ_L5CACHE;
-            break;
-
-        default:
-            break;
-        }
+        hwloc_obj_type_t const type = detail::get_cache_obj_type(level);
 #endif
 
         iterate(cpuset, [&](auto num_pu) {
@@ -427,6 +427,18 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            threads::coroutines::detail::posix::stack_pool_size =
+                cmdline.rtcfg_.get_stack_pool_size();
+            threads::coroutines::detail::posix::use_huge_pages =
+                cmdline.rtcfg_.use_stack_huge_pages();
+#endif
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            threads::coroutines::detail::posix::use_growable_stacks =
+                cmdline.rtcfg_.use_growable_stacks();
+            threads::coroutines::detail::posix::growable_stack_initial_size =
+                cmdline.rtcfg_.get_growable_stack_initial_size();
+#endif
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
@@ -327,6 +327,30 @@ namespace hpx::performance_counters::detail {
                 hpx::bind_front(&threads::coroutine_type::impl_type::
                                     get_stack_unbind_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                                    get_stack_pool_hit_count),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-bytes-reclaimed
+            {"count/stack-bytes-reclaimed",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                                    get_stack_bytes_reclaimed),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+#endif
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            // /threads{locality#%d/total}/stack-high-water/max
+            {"stack-high-water/max",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                                    get_stack_high_water_max),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/stack-high-water/average
+            {"stack-high-water/average",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                                    get_stack_high_water_average),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+#endif
 #endif
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
@@ -368,6 +392,16 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_queue_length,
                     &threads::thread_pool_base::get_queue_length),
                 &locality_pool_thread_counter_discoverer, ""},
+            // number of threads which finished after their deadline
+            {"/threads/count/missed-deadlines",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads with a deadline which "
+                "finished executing after the deadline had passed",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_missed_deadlines,
+                    &threads::thread_pool_base::get_num_missed_deadlines),
+                &locality_pool_thread_counter_discoverer, ""},
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             // average thread wait time for queue(s)
             {"/threads/wait-time/pending", counter_type::average_timer,
@@ -614,6 +648,35 @@ namespace hpx::performance_counters {
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            {"/threads/count/stack-pool-hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks that were "
+                "reused from the stack pool instead of being newly mapped "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-bytes-reclaimed",
+                counter_type::monotonically_increasing,
+                "returns the total number of bytes of HPX-thread stack memory "
+                "released to the operating system for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
+#endif
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+            {"/threads/stack-high-water/max",
+                counter_type::raw,
+                "returns the maximal stack high-water mark of all HPX-threads "
+                "that have run on growable stacks on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/stack-high-water/average",
+                counter_type::raw,
+                "returns the average stack high-water mark of all HPX-threads "
+                "that have run on growable stacks on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
+#endif
 #endif
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
@@ -677,7 +740,110 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-same-core",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from "
+                "worker threads running on the same core (SMT siblings) for "
+                "the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_stolen_same_core,
+                    &threads::thread_pool_base::get_num_stolen_same_core),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-same-cache",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from "
+                "worker threads running on cores sharing the same (L3) cache "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_stolen_same_cache,
+                    &threads::thread_pool_base::get_num_stolen_same_cache),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-same-numa-domain",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from "
+                "worker threads running in the same NUMA domain for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_same_numa_domain,
+                    &threads::thread_pool_base::
+                        get_num_stolen_same_numa_domain),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-remote",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from "
+                "worker threads running in a different NUMA domain for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_stolen_remote,
+                    &threads::thread_pool_base::get_num_stolen_remote),
+                &locality_pool_thread_counter_discoverer, ""},
 #endif
+            // steal requests by topological distance to the victim
+            {"/threads/count/steal-requests-same-core",
+                counter_type::monotonically_increasing,
+                "returns the overall number of steal requests sent to worker "
+                "threads running on the same core (SMT siblings) for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_steal_requests_same_core,
+                    &threads::thread_pool_base::
+                        get_num_steal_requests_same_core),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-requests-same-cache",
+                counter_type::monotonically_increasing,
+                "returns the overall number of steal requests sent to worker "
+                "threads running on cores sharing the same (L3) cache for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_steal_requests_same_cache,
+                    &threads::thread_pool_base::
+                        get_num_steal_requests_same_cache),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-requests-same-numa-domain",
+                counter_type::monotonically_increasing,
+                "returns the overall number of steal requests sent to worker "
+                "threads running in the same NUMA domain for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::
+                        get_num_steal_requests_same_numa_domain,
+                    &threads::thread_pool_base::
+                        get_num_steal_requests_same_numa_domain),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-requests-remote",
+                counter_type::monotonically_increasing,
+                "returns the overall number of steal requests sent to worker "
+                "threads running in a different NUMA domain for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_steal_requests_remote,
+                    &threads::thread_pool_base::get_num_steal_requests_remote),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-requests-skipping-closer",
+                counter_type::monotonically_increasing,
+                "returns the overall number of steal requests sent while a "
+                "topologically closer worker thread had not been asked yet "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::
+                        get_num_steal_requests_skipping_closer,
+                    &threads::thread_pool_base::
+                        get_num_steal_requests_skipping_closer),
+                &locality_pool_thread_counter_discoverer, ""},
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
                 "returns the current scheduler utilization",
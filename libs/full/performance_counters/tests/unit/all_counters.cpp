@@ -21,6 +21,7 @@
 char const* const locality_pool_thread_counter_names[] =
 {
     "/threadqueue/length",
+    "/threads/count/missed-deadlines",
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     "/threads/wait-time/pending",
     "/threads/wait-time/staged",
@@ -58,6 +59,10 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/stolen-from-staged",
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
+    "/threads/count/stolen-same-core",
+    "/threads/count/stolen-same-cache",
+    "/threads/count/stolen-same-numa-domain",
+    "/threads/count/stolen-remote",
 #endif
     nullptr
 };
@@ -81,6 +86,14 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-recycles",
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-bytes-reclaimed",
+#endif
+#if defined(HPX_COROUTINES_HAVE_GROWABLE_STACKS)
+    "/threads/stack-high-water/max",
+    "/threads/stack-high-water/average",
+#endif
 #endif
 #endif
     "/scheduler/utilization/instantaneous", nullptr};
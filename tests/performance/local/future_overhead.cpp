@@ -196,6 +196,51 @@ void measure_function_futures_wait_all(
     print_stats("async", "WaitAll", exec_name(exec), count, duration, csv);
 }
 
+// Time a chain of continuations, each of which allocates a new shared state
+template <typename Policy>
+void measure_function_futures_then_chain(
+    std::uint64_t count, bool csv, Policy policy, char const* policy_name)
+{
+    // start the clock
+    high_resolution_timer const walltime;
+
+    future<double> f = hpx::make_ready_future(0.0);
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        f = f.then(policy,
+            [](future<double>&& r) { return r.get() + null_function(); });
+    }
+    global_scratch = global_scratch + f.get();
+
+    // stop the clock
+    double const duration = walltime.elapsed();
+    print_stats("then", "Chain", policy_name, count, duration, csv);
+}
+
+// Time async execution where the shared states are released on other worker
+// threads than the ones they were allocated on
+template <typename Executor>
+void measure_function_futures_remote_release(
+    std::uint64_t count, bool csv, Executor& exec)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer const walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+        futures.push_back(async(exec, &null_function));
+    hpx::wait_all(futures);
+
+    hpx::experimental::for_loop(hpx::execution::par, 0, count,
+        [&](std::uint64_t i) { futures[i] = future<double>(); });
+
+    // stop the clock
+    double const duration = walltime.elapsed();
+    print_stats(
+        "async", "RemoteRelease", exec_name(exec), count, duration, csv);
+}
+
 template <typename Executor>
 void measure_function_futures_limiting_executor(
     std::uint64_t count, bool csv, Executor exec)
@@ -525,6 +570,13 @@ int hpx_main(variables_map& vm)
 #endif
                 measure_function_futures_wait_each(count, csv, par);
                 measure_function_futures_wait_all(count, csv, par);
+                measure_function_futures_then_chain(
+                    count, csv, hpx::launch::sync, "launch::sync");
+                measure_function_futures_then_chain(
+                    count, csv, hpx::launch::async, "launch::async");
+                measure_function_futures_then_chain(
+                    count, csv, hpx::launch::inline_, "launch::inline_");
+                measure_function_futures_remote_release(count, csv, par);
                 measure_function_futures_sliding_semaphore(count, csv, par);
                 measure_function_futures_for_loop(count, csv, par);
                 measure_function_futures_for_loop(count, csv, sched_exec_tps);
@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures how quickly idle worker threads pick up new work and
+// how much CPU time they burn while idling. Bursts of tasks are scheduled
+// after the runtime was left idle for a given amount of time. For each task
+// the time between scheduling the burst and the task starting to run is
+// recorded. The CPU utilization of the process (CPU time consumed divided by
+// the wall clock time and the number of worker threads) serves as a proxy for
+// the power consumed by idle worker threads.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+double percentile(std::vector<double> const& sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+
+    auto const index = static_cast<std::size_t>(
+        p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[(std::min)(index, sorted.size() - 1)];
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const bursts = vm["bursts"].as<std::uint64_t>();
+    std::uint64_t const idle_time = vm["idle-time"].as<std::uint64_t>();
+    std::uint64_t burst_size = vm["burst-size"].as<std::uint64_t>();
+    if (burst_size == 0)
+        burst_size = hpx::get_num_worker_threads();
+
+    std::vector<double> latencies;
+    latencies.reserve(bursts * burst_size);
+
+    std::vector<double> burst_latencies(burst_size);
+
+    std::clock_t const cpu_start = std::clock();
+    hpx::chrono::high_resolution_timer wall_timer;
+
+    for (std::uint64_t i = 0; i != bursts; ++i)
+    {
+        // leave the worker threads idle for a while
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(idle_time));
+
+        hpx::latch done(static_cast<std::ptrdiff_t>(burst_size + 1));
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        for (std::uint64_t j = 0; j != burst_size; ++j)
+        {
+            hpx::post([&, j]() {
+                burst_latencies[j] =
+                    static_cast<double>(
+                        hpx::chrono::high_resolution_clock::now() - start) *
+                    1e-3;
+                done.count_down(1);
+            });
+        }
+
+        done.arrive_and_wait();
+        latencies.insert(
+            latencies.end(), burst_latencies.begin(), burst_latencies.end());
+    }
+
+    double const wall_time = wall_timer.elapsed();
+    double const cpu_time =
+        static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    double const cpu_utilization = cpu_time /
+        (wall_time * static_cast<double>(hpx::get_num_worker_threads()));
+
+    std::sort(latencies.begin(), latencies.end());
+
+    double const p50 = percentile(latencies, 0.5);
+    double const p99 = percentile(latencies, 0.99);
+    double const max = latencies.empty() ? 0.0 : latencies.back();
+
+    std::cout << "threads, bursts, burst size, idle time [ms], "
+                 "p50 [us], p99 [us], max [us], cpu utilization\n"
+              << hpx::get_num_worker_threads() << ", " << bursts << ", "
+              << burst_size << ", " << idle_time << ", " << p50 << ", " << p99
+              << ", " << max << ", " << cpu_utilization << std::endl;
+
+    hpx::util::print_cdash_timing("IdleWakeupLatencyP50", p50 * 1e-6);
+    hpx::util::print_cdash_timing("IdleWakeupLatencyP99", p99 * 1e-6);
+    hpx::util::print_cdash_timing("IdleCpuUtilization", cpu_utilization);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("bursts",
+         hpx::program_options::value<std::uint64_t>()->default_value(100),
+         "number of bursts of tasks to schedule")
+        ("burst-size",
+         hpx::program_options::value<std::uint64_t>()->default_value(0),
+         "number of tasks per burst (default: number of worker threads)")
+        ("idle-time",
+         hpx::program_options::value<std::uint64_t>()->default_value(10),
+         "time (in milliseconds) to leave the worker threads idle before "
+         "each burst");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
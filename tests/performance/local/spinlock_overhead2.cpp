@@ -18,12 +18,15 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/mutex.hpp>
 
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 using hpx::program_options::options_description;
@@ -49,6 +52,11 @@ double global_scratch = 0;
 double global_init[N] = {0};
 std::uint64_t num_iterations = 0;
 
+// number of locks the futures are distributed over, fewer locks create more
+// contention
+std::size_t num_locks = N;
+bool use_hpx_mutex = false;
+
 std::size_t k1 = 0;
 std::size_t k2 = 0;
 std::size_t k3 = 0;
@@ -177,14 +185,16 @@ namespace test {
 }    // namespace test
 
 test::local_spinlock mtx[N];
+hpx::mutex hpx_mtx[N];
 
 ///////////////////////////////////////////////////////////////////////////////
-double null_function(std::size_t i)
+template <typename Mutex>
+double locked_function(Mutex* mutexes, std::size_t i)
 {
     double d = 0.;
-    std::size_t idx = i % N;
+    std::size_t idx = i % num_locks;
     {
-        std::lock_guard<test::local_spinlock> l(mtx[idx]);
+        std::lock_guard<Mutex> l(mutexes[idx]);
         d = global_init[idx];
     }
     for (double j = 0; j < num_iterations; ++j)
@@ -192,12 +202,19 @@ double null_function(std::size_t i)
         d += 1 / (2. * j + 1);
     }
     {
-        std::lock_guard<test::local_spinlock> l(mtx[idx]);
+        std::lock_guard<Mutex> l(mutexes[idx]);
         global_init[idx] = d;
     }
     return d;
 }
 
+double null_function(std::size_t i)
+{
+    if (use_hpx_mutex)
+        return locked_function(hpx_mtx, i);
+    return locked_function(mtx, i);
+}
+
 HPX_PLAIN_ACTION(null_function, null_action)
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -208,6 +225,16 @@ int hpx_main(variables_map& vm)
 
         const std::uint64_t count = vm["futures"].as<std::uint64_t>();
 
+        num_locks = vm["locks"].as<std::size_t>();
+        if (HPX_UNLIKELY(0 == num_locks || num_locks > N))
+            throw std::logic_error("error: invalid number of locks\n");
+
+        std::string const mutex_type = vm["mutex"].as<std::string>();
+        if (mutex_type == "hpx")
+            use_hpx_mutex = true;
+        else if (HPX_UNLIKELY(mutex_type != "spinlock"))
+            throw std::logic_error("error: invalid mutex type\n");
+
         k1 = vm["k1"].as<std::size_t>();
         k2 = vm["k2"].as<std::size_t>();
         k3 = vm["k3"].as<std::size_t>();
@@ -248,10 +275,13 @@ int hpx_main(variables_map& vm)
                 else
                     hpx::util::format_to(cout,
                         "invoked {1} futures in {2} seconds "
-                        "(k1 = {3}, k2 = {4}, k3 = {5})\n",
-                        count, duration, k1, k2, k3)
+                        "(k1 = {3}, k2 = {4}, k3 = {5}, {6} locks of type "
+                        "{7})\n",
+                        count, duration, k1, k2, k3, num_locks, mutex_type)
                         << std::flush;
-                hpx::util::print_cdash_timing("Spinlock2", duration);
+                hpx::util::print_cdash_timing(
+                    use_hpx_mutex ? "Spinlock2HpxMutex" : "Spinlock2",
+                    duration);
             }
         }
     }
@@ -272,6 +302,10 @@ int main(int argc, char* argv[])
             "number of futures to invoke")
         ("delay-iterations", value<std::uint64_t>()->default_value(0),
             "number of iterations in the delay loop")
+        ("locks", value<std::size_t>()->default_value(N),
+            "number of locks to distribute the futures over (max: 100)")
+        ("mutex", value<std::string>()->default_value("spinlock"),
+            "type of the locks to use (spinlock or hpx)")
         ("k1", value<std::size_t>()->default_value(4), "")
         ("k2", value<std::size_t>()->default_value(16), "")
         ("k3", value<std::size_t>()->default_value(32), "")
@@ -1,4 +1,4 @@
-//  Copyright (c) 2016 Hartmut Kaiser
+//  Copyright (c) 2016-2026 Hartmut Kaiser
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -13,6 +13,8 @@
 #include <hpx/modules/testing.hpp>
 #include <hpx/program_options.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -20,28 +22,71 @@
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
-std::vector<hpx::future<void>> create_tasks(
-    std::size_t num_tasks, std::size_t delay)
+// If pending is set, all futures are made ready by a separate thread while
+// they are being waited for, otherwise those are ready (or become ready after
+// the given delay).
+struct tasks_data
 {
     std::vector<hpx::future<void>> tasks;
-    tasks.reserve(num_tasks);
+    std::vector<hpx::promise<void>> promises;
+};
+
+tasks_data create_tasks(std::size_t num_tasks, std::size_t delay, bool pending)
+{
+    tasks_data data;
+    data.tasks.reserve(num_tasks);
+    if (pending)
+    {
+        data.promises.resize(num_tasks);
+        for (auto& p : data.promises)
+        {
+            data.tasks.push_back(p.get_future());
+        }
+        return data;
+    }
+
     for (std::size_t i = 0; i != num_tasks; ++i)
     {
         if (delay == 0)
         {
-            tasks.push_back(hpx::make_ready_future());
+            data.tasks.push_back(hpx::make_ready_future());
         }
         else
         {
-            tasks.push_back(
+            data.tasks.push_back(
                 hpx::make_ready_future_after(std::chrono::microseconds(delay)));
         }
     }
-    return tasks;
+    return data;
+}
+
+hpx::future<void> make_tasks_ready(std::vector<tasks_data>& chunks)
+{
+    return hpx::async([&chunks]() {
+        for (auto& chunk : chunks)
+        {
+            for (auto& p : chunk.promises)
+            {
+                p.set_value();
+            }
+        }
+    });
+}
+
+void wait_chunk(std::vector<hpx::future<void>>& tasks, bool use_when_all)
+{
+    if (use_when_all)
+    {
+        hpx::when_all(tasks).get();
+    }
+    else
+    {
+        hpx::wait_all(tasks);
+    }
 }
 
 double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
-    std::size_t num_chunks, std::size_t delay)
+    std::size_t num_chunks, std::size_t delay, bool pending, bool use_when_all)
 {
     std::size_t num_chunk_tasks = ((num_tasks + num_chunks) / num_chunks) - 1;
     std::size_t last_num_chunk_tasks =
@@ -51,38 +96,102 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
 
     for (std::size_t k = 0; k != num_samples; ++k)
     {
-        std::vector<std::vector<hpx::future<void>>> chunks;
+        std::vector<tasks_data> chunks;
         chunks.reserve(num_chunks);
         for (std::size_t c = 0; c != num_chunks - 1; ++c)
         {
-            chunks.push_back(create_tasks(num_chunk_tasks, delay));
+            chunks.push_back(create_tasks(num_chunk_tasks, delay, pending));
         }
-        chunks.push_back(create_tasks(last_num_chunk_tasks, delay));
+        chunks.push_back(create_tasks(last_num_chunk_tasks, delay, pending));
 
         std::vector<hpx::future<void>> chunk_results;
         chunk_results.reserve(num_chunks);
 
         // wait of tasks in chunks
         hpx::chrono::high_resolution_timer t;
+
+        hpx::future<void> ready;
+        if (pending)
+        {
+            ready = make_tasks_ready(chunks);
+        }
+
         if (num_chunks == 1)
         {
-            hpx::wait_all(chunks[0]);
+            wait_chunk(chunks[0].tasks, use_when_all);
         }
         else
         {
             for (std::size_t c = 0; c != num_chunks; ++c)
             {
                 chunk_results.push_back(
-                    hpx::async([&chunks, c]() { hpx::wait_all(chunks[c]); }));
+                    hpx::async([&chunks, c, use_when_all]() {
+                        wait_chunk(chunks[c].tasks, use_when_all);
+                    }));
             }
             hpx::wait_all(chunk_results);
         }
         result += t.elapsed();
+
+        if (pending)
+        {
+            ready.get();
+        }
     }
 
     return result / num_samples;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void print_timings(std::size_t num_samples, std::size_t num_tasks,
+    std::size_t num_chunks, std::size_t delay, bool pending, bool use_when_all)
+{
+    char const* const name = use_when_all ? "WhenAll" : "WaitAll";
+
+    // wait for all of the tasks sequentially
+    double elapsed_seq =
+        wait_tasks(num_samples, num_tasks, 1, delay, pending, use_when_all);
+
+    // wait of tasks in chunks
+    double elapsed_chunks = 0;
+    if (num_chunks != 1)
+    {
+        elapsed_chunks = wait_tasks(
+            num_samples, num_tasks, num_chunks, delay, pending, use_when_all);
+    }
+
+    std::string const tasks_str = hpx::util::format("{}", num_tasks);
+    std::string const chunks_str = hpx::util::format("{}", num_chunks);
+    std::string const delay_str = hpx::util::format("{}", delay);
+
+    hpx::util::format_to(std::cout, "{:10},{:10},{:10},{:10},{:10.12},{}\n",
+        tasks_str, std::string("1"), delay_str, elapsed_seq,
+        elapsed_seq / num_tasks, name)
+        << std::endl;
+    hpx::util::print_cdash_timing(name, elapsed_seq / num_tasks);
+
+    if (num_chunks != 1)
+    {
+        hpx::util::format_to(std::cout,
+            "{:10},{:10},{:10},{:10},{:10.12},{}\n", tasks_str, chunks_str,
+            delay_str, elapsed_chunks, elapsed_chunks / num_tasks, name)
+            << std::endl;
+        hpx::util::print_cdash_timing(
+            hpx::util::format("{}Chunks", name).c_str(),
+            elapsed_chunks / num_tasks);
+    }
+}
+
+void print_all_timings(std::size_t num_samples, std::size_t num_tasks,
+    std::size_t num_chunks, std::size_t delay, bool pending, bool when_all)
+{
+    print_timings(num_samples, num_tasks, num_chunks, delay, pending, false);
+    if (when_all)
+    {
+        print_timings(num_samples, num_tasks, num_chunks, delay, pending, true);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -91,6 +200,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::size_t num_chunks = 1;
     std::size_t delay = 0;
     bool header = true;
+    bool pending = false;
+    bool when_all = false;
 
     if (vm.count("no-header"))
         header = false;
@@ -102,44 +213,38 @@ int hpx_main(hpx::program_options::variables_map& vm)
         num_chunks = vm["chunks"].as<std::size_t>();
     if (vm.count("delay"))
         delay = vm["delay"].as<std::size_t>();
+    if (vm.count("pending"))
+        pending = true;
+    if (vm.count("when-all"))
+        when_all = true;
 
     if (num_chunks == 0)
         num_chunks = 1;
 
-    // wait for all of the tasks sequentially
-    double elapsed_seq = wait_tasks(num_samples, num_tasks, 1, delay);
-
-    // wait of tasks in chunks
-    double elapsed_chunks = 0;
-    if (num_chunks != 1)
-        elapsed_chunks = wait_tasks(num_samples, num_tasks, num_chunks, delay);
-
     if (header)
     {
-        std::cout
-            << "Tasks,Chunks,Delay[s],Total Walltime[s],Walltime per Task[s]"
-            << std::endl;
+        std::cout << "Tasks,Chunks,Delay[s],Total Walltime[s],Walltime per "
+                     "Task[s],Combinator"
+                  << std::endl;
     }
 
-    std::string const tasks_str = hpx::util::format("{}", num_tasks);
-    std::string const chunks_str = hpx::util::format("{}", num_chunks);
-    std::string const delay_str = hpx::util::format("{}", delay);
-
-    hpx::util::format_to(std::cout, "{:10},{:10},{:10},{:10},{:10.12}\n",
-        tasks_str, std::string("1"), delay_str, elapsed_seq,
-        elapsed_seq / num_tasks)
-        << std::endl;
-    hpx::util::print_cdash_timing("WaitAll", elapsed_seq / num_tasks);
-
-    if (num_chunks != 1)
+    if (vm.count("sweep"))
     {
-        hpx::util::format_to(std::cout,
-            "{:10},{:10},{:10},{:10},{:10.12},{:10.12}\n", tasks_str,
-            chunks_str, delay_str, elapsed_chunks, elapsed_chunks / num_tasks)
-            << std::endl;
-        hpx::util::print_cdash_timing(
-            "WaitAllChunks", elapsed_chunks / num_tasks);
+        // keep the overall number of futures waited for (roughly) constant
+        std::size_t const total = num_samples * num_tasks;
+        for (std::size_t n = 10; n <= 10000000; n *= 10)
+        {
+            std::size_t const samples = (std::max)(total / n, std::size_t(1));
+            print_all_timings(samples, n, (std::min)(num_chunks, n), delay,
+                pending, when_all);
+        }
     }
+    else
+    {
+        print_all_timings(
+            num_samples, num_tasks, num_chunks, delay, pending, when_all);
+    }
+
     return hpx::local::finalize();
 }
 
@@ -151,17 +256,26 @@ int main(int argc, char* argv[])
     // Configure application-specific options.
     po::options_description cmdline(
         "usage: " HPX_APPLICATION_STRING " [options]");
-    cmdline.add_options()("samples,s",
-        po::value<std::size_t>()->default_value(1000),
-        "number of tasks to concurrently wait for (default: 1000)")("futures,f",
-        po::value<std::size_t>()->default_value(100),
-        "number of tasks to concurrently wait for (default: 100)")("chunks,c",
-        po::value<std::size_t>()->default_value(1),
-        "number of chunks to split tasks into (default: 1)")("delay,d",
-        po::value<std::size_t>()->default_value(0),
-        "number of iterations in the delay loop")("no-header,n",
-        po::value<bool>()->default_value(true),
-        "do not print out the csv header row");
+    // clang-format off
+    cmdline.add_options()
+        ("samples,s", po::value<std::size_t>()->default_value(1000),
+         "number of tasks to concurrently wait for (default: 1000)")
+        ("futures,f", po::value<std::size_t>()->default_value(100),
+         "number of tasks to concurrently wait for (default: 100)")
+        ("chunks,c", po::value<std::size_t>()->default_value(1),
+         "number of chunks to split tasks into (default: 1)")
+        ("delay,d", po::value<std::size_t>()->default_value(0),
+         "number of iterations in the delay loop")
+        ("no-header,n", po::value<bool>()->default_value(true),
+         "do not print out the csv header row")
+        ("pending,p",
+         "make the futures ready concurrently while waiting for them")
+        ("when-all,w", "measure hpx::when_all in addition to hpx::wait_all")
+        ("sweep",
+         "measure for 10 to 10M futures (the number of samples is adjusted "
+         "such that the overall number of futures stays the same)")
+        ;
+    // clang-format on
 
     // Initialize and run HPX.
     hpx::local::init_params init_args;